@@ -23,12 +23,14 @@
 #include <G3D/AABox.h>
 
 #include "Define.h"
+#include "Float4.h"
 
 #include <stdexcept>
 #include <vector>
 #include <algorithm>
 #include <limits>
 #include <cmath>
+#include <concepts>
 #include "string.h"
 
 #define MAX_STACK_SIZE 64
@@ -118,35 +120,13 @@ class TC_COMMON_API BIH
         template<typename RayCallback>
         void intersectRay(const G3D::Ray &r, RayCallback& intersectCallback, float &maxDist, bool stopAtFirst = false) const
         {
-            float intervalMin = -1.f;
-            float intervalMax = -1.f;
+            float intervalMin;
+            float intervalMax;
             G3D::Vector3 org = r.origin();
             G3D::Vector3 dir = r.direction();
             G3D::Vector3 invDir;
-            for (int i=0; i<3; ++i)
-            {
-                invDir[i] = 1.f / dir[i];
-                if (G3D::fuzzyNe(dir[i], 0.0f))
-                {
-                    float t1 = (bounds.low()[i]  - org[i]) * invDir[i];
-                    float t2 = (bounds.high()[i] - org[i]) * invDir[i];
-                    if (t1 > t2)
-                        std::swap(t1, t2);
-                    if (t1 > intervalMin)
-                        intervalMin = t1;
-                    if (t2 < intervalMax || intervalMax < 0.f)
-                        intervalMax = t2;
-                    // intervalMax can only become smaller for other axis,
-                    //  and intervalMin only larger respectively, so stop early
-                    if (intervalMax <= 0 || intervalMin >= maxDist)
-                        return;
-                }
-            }
-
-            if (intervalMin > intervalMax)
+            if (!clipToBounds(r, maxDist, invDir, intervalMin, intervalMax))
                 return;
-            intervalMin = std::max(intervalMin, 0.f);
-            intervalMax = std::min(intervalMax, maxDist);
 
             uint32 offsetFront[3];
             uint32 offsetBack[3];
@@ -213,13 +193,8 @@ class TC_COMMON_API BIH
                         else
                         {
                             // leaf - test some objects
-                            int n = tree[node + 1];
-                            while (n > 0) {
-                                bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirst);
-                                if (stopAtFirst && hit) return;
-                                --n;
-                                ++offset;
-                            }
+                            if (intersectLeaf(intersectCallback, r, &objects[offset], tree[node + 1], maxDist, stopAtFirst))
+                                return;
                             break;
                         }
                     }
@@ -254,6 +229,185 @@ class TC_COMMON_API BIH
             }
         }
 
+        static constexpr uint32 RayPacketSize = 4;
+
+        /**
+            Traces up to RayPacketSize rays through the tree together, callbacks[i] and maxDist[i] belong to rays[i].
+            A node is entered when any ray of the packet passes it and every ray clips its own interval, so each
+            ray gets the same result as from intersectRay. Packets of rays with the same direction signs and
+            similar origins visit the fewest nodes.
+        */
+        template<typename RayCallback>
+        void intersectRayPacket(G3D::Ray const* rays, RayCallback* callbacks, float* maxDist, uint32 count, bool stopAtFirst = false) const
+        {
+            using VMAP::Float4;
+
+            float org[3][RayPacketSize] = { };
+            float invDir[3][RayPacketSize] = { };
+            bool dirNegative[3][RayPacketSize] = { };
+            float intervalMin[RayPacketSize];
+            float intervalMax[RayPacketSize];
+            uint32 liveLanes = 0;
+            for (uint32 lane = 0; lane < RayPacketSize; ++lane)
+            {
+                // unused lanes get an empty interval
+                intervalMin[lane] = 1.f;
+                intervalMax[lane] = 0.f;
+                if (lane >= count)
+                    continue;
+
+                G3D::Vector3 laneInvDir;
+                if (!clipToBounds(rays[lane], maxDist[lane], laneInvDir, intervalMin[lane], intervalMax[lane]))
+                {
+                    intervalMin[lane] = 1.f;
+                    intervalMax[lane] = 0.f;
+                    continue;
+                }
+
+                for (int i = 0; i < 3; ++i)
+                {
+                    org[i][lane] = rays[lane].origin()[i];
+                    invDir[i][lane] = laneInvDir[i];
+                    dirNegative[i][lane] = (floatToRawIntBits(rays[lane].direction()[i]) >> 31) != 0;
+                }
+
+                liveLanes |= 1 << lane;
+            }
+
+            if (!liveLanes)
+                return;
+
+            Float4 packetOrg[3];
+            Float4 packetInvDir[3];
+            Float4 packetDirNegative[3];
+            for (int i = 0; i < 3; ++i)
+            {
+                packetOrg[i] = Float4::Load(org[i]);
+                packetInvDir[i] = Float4::Load(invDir[i]);
+                packetDirNegative[i] = Float4::Mask(dirNegative[i][0], dirNegative[i][1], dirNegative[i][2], dirNegative[i][3]);
+            }
+
+            Float4 tMin = Float4::Load(intervalMin);
+            Float4 tMax = Float4::Load(intervalMax);
+            // rays that already hit something and were asked to stop there
+            uint32 finishedLanes = 0;
+
+            PacketStackNode stack[MAX_STACK_SIZE];
+            int stackPos = 0;
+            int node = 0;
+
+            while (true) {
+                while (true)
+                {
+                    uint32 activeLanes = MoveMask(tMin <= tMax) & liveLanes & ~finishedLanes;
+                    if (!activeLanes)
+                        break;
+
+                    uint32 tn = tree[node];
+                    uint32 axis = (tn & (3 << 30)) >> 30;
+                    bool BVH2 = (tn & (1 << 29)) != 0;
+                    int offset = tn & ~(7 << 29);
+                    if (!BVH2)
+                    {
+                        if (axis < 3)
+                        {
+                            // "normal" interior node, every lane computes the intervals of both children
+                            // rays going in negative direction meet the right child first
+                            Float4 tl = (Float4::Broadcast(intBitsToFloat(tree[node + 1])) - packetOrg[axis]) * packetInvDir[axis];
+                            Float4 tr = (Float4::Broadcast(intBitsToFloat(tree[node + 2])) - packetOrg[axis]) * packetInvDir[axis];
+                            Float4 leftMin = Select(packetDirNegative[axis], Max(tl, tMin), tMin);
+                            Float4 leftMax = Select(packetDirNegative[axis], tMax, Min(tl, tMax));
+                            Float4 rightMin = Select(packetDirNegative[axis], tMin, Max(tr, tMin));
+                            Float4 rightMax = Select(packetDirNegative[axis], Min(tr, tMax), tMax);
+                            uint32 leftLanes = MoveMask(leftMin <= leftMax) & activeLanes;
+                            uint32 rightLanes = MoveMask(rightMin <= rightMax) & activeLanes;
+                            // packet passes between clip zones
+                            if (!leftLanes && !rightLanes)
+                                break;
+
+                            if (!rightLanes)
+                            {
+                                node = offset;
+                                tMin = leftMin;
+                                tMax = leftMax;
+                                continue;
+                            }
+
+                            if (!leftLanes)
+                            {
+                                node = offset + 3;
+                                tMin = rightMin;
+                                tMax = rightMax;
+                                continue;
+                            }
+
+                            // both children are needed, visit them in the order of the first active ray
+                            uint32 firstLane = 0;
+                            while (!(activeLanes & (1 << firstLane)))
+                                ++firstLane;
+
+                            if (dirNegative[axis][firstLane])
+                            {
+                                stack[stackPos] = { uint32(offset), leftMin, leftMax };
+                                node = offset + 3;
+                                tMin = rightMin;
+                                tMax = rightMax;
+                            }
+                            else
+                            {
+                                stack[stackPos] = { uint32(offset + 3), rightMin, rightMax };
+                                node = offset;
+                                tMin = leftMin;
+                                tMax = leftMax;
+                            }
+                            stackPos++;
+                            continue;
+                        }
+                        else
+                        {
+                            // leaf - test some objects with every ray passing it
+                            for (uint32 lane = 0; lane < RayPacketSize; ++lane)
+                                if (activeLanes & (1 << lane))
+                                    if (intersectLeaf(callbacks[lane], rays[lane], &objects[offset], tree[node + 1], maxDist[lane], stopAtFirst))
+                                        finishedLanes |= 1 << lane;
+
+                            if ((liveLanes & ~finishedLanes) == 0)
+                                return;
+                            break;
+                        }
+                    }
+                    else
+                    {
+                        if (axis>2)
+                            return; // should not happen
+                        Float4 t1 = (Float4::Broadcast(intBitsToFloat(tree[node + 1])) - packetOrg[axis]) * packetInvDir[axis];
+                        Float4 t2 = (Float4::Broadcast(intBitsToFloat(tree[node + 2])) - packetOrg[axis]) * packetInvDir[axis];
+                        node = offset;
+                        tMin = Max(Select(packetDirNegative[axis], t2, t1), tMin);
+                        tMax = Min(Select(packetDirNegative[axis], t1, t2), tMax);
+                        continue;
+                    }
+                } // traversal loop
+                do
+                {
+                    // stack is empty?
+                    if (stackPos == 0)
+                        return;
+                    // move back up the stack
+                    stackPos--;
+                    tMin = stack[stackPos].tnear;
+                    tMax = stack[stackPos].tfar;
+                    // drop rays that found a hit closer than the node
+                    Float4 packetMaxDist = Float4::Load(maxDist);
+                    if (!(MoveMask((tMin <= tMax) & (tMin <= packetMaxDist)) & liveLanes & ~finishedLanes))
+                        continue;
+                    tMax = Select(tMin <= packetMaxDist, tMax, Float4::Broadcast(-1.f));
+                    node = stack[stackPos].node;
+                    break;
+                } while (true);
+            }
+        }
+
         template<typename IsectCallback>
         void intersectPoint(const G3D::Vector3 &p, IsectCallback& intersectCallback) const
         {
@@ -353,6 +507,69 @@ class TC_COMMON_API BIH
             float tnear;
             float tfar;
         };
+        struct PacketStackNode
+        {
+            uint32 node;
+            VMAP::Float4 tnear;
+            VMAP::Float4 tfar;
+        };
+
+        // Clips the ray to the tree bounds, false if it misses them
+        bool clipToBounds(G3D::Ray const& r, float maxDist, G3D::Vector3& invDir, float& intervalMin, float& intervalMax) const
+        {
+            intervalMin = -1.f;
+            intervalMax = -1.f;
+            G3D::Vector3 org = r.origin();
+            G3D::Vector3 dir = r.direction();
+            for (int i=0; i<3; ++i)
+            {
+                invDir[i] = 1.f / dir[i];
+                if (G3D::fuzzyNe(dir[i], 0.0f))
+                {
+                    float t1 = (bounds.low()[i]  - org[i]) * invDir[i];
+                    float t2 = (bounds.high()[i] - org[i]) * invDir[i];
+                    if (t1 > t2)
+                        std::swap(t1, t2);
+                    if (t1 > intervalMin)
+                        intervalMin = t1;
+                    if (t2 < intervalMax || intervalMax < 0.f)
+                        intervalMax = t2;
+                    // intervalMax can only become smaller for other axis,
+                    //  and intervalMin only larger respectively, so stop early
+                    if (intervalMax <= 0 || intervalMin >= maxDist)
+                        return false;
+                }
+            }
+
+            if (intervalMin > intervalMax)
+                return false;
+            intervalMin = std::max(intervalMin, 0.f);
+            intervalMax = std::min(intervalMax, maxDist);
+            return true;
+        }
+
+        /**
+            Tests the objects of a leaf, true if traversal can stop.
+            Callbacks may handle a whole leaf at once with
+            bool operator()(G3D::Ray const& ray, uint32 const* entries, uint32 count, float& maxDist, bool stopAtFirst)
+            instead of being called for each object.
+        */
+        template<typename RayCallback>
+        static bool intersectLeaf(RayCallback& intersectCallback, G3D::Ray const& r, uint32 const* entries, uint32 count, float& maxDist, bool stopAtFirst)
+        {
+            if constexpr (requires { { intersectCallback(r, entries, count, maxDist, stopAtFirst) } -> std::convertible_to<bool>; })
+                return intersectCallback(r, entries, count, maxDist, stopAtFirst) && stopAtFirst;
+            else
+            {
+                for (uint32 i = 0; i < count; ++i)
+                {
+                    bool hit = intersectCallback(r, entries[i], maxDist, stopAtFirst);
+                    if (stopAtFirst && hit)
+                        return true;
+                }
+                return false;
+            }
+        }
 
         class BuildStats
         {
@@ -0,0 +1,131 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_FLOAT4_H
+#define TRINITYCORE_FLOAT4_H
+
+#include "Define.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TRINITY_FLOAT4_SSE2
+#include <emmintrin.h>
+#else
+#include <algorithm>
+#include <array>
+#include <bit>
+#endif
+
+namespace VMAP
+{
+/*
+ * Four floats processed together, SSE2 where available (always on x86-64) and plain arrays elsewhere.
+ * Comparisons return masks with all bits of a lane set or cleared, Min and Max follow SSE semantics
+ * (the second operand is returned when the comparison fails, also for NaN) on every platform,
+ * so both implementations compute bit identical results.
+ */
+struct Float4
+{
+#ifdef TRINITY_FLOAT4_SSE2
+    __m128 V;
+
+    static Float4 Broadcast(float value) { return { _mm_set1_ps(value) }; }
+    static Float4 Load(float const* values) { return { _mm_loadu_ps(values) }; }
+    static Float4 Mask(bool l0, bool l1, bool l2, bool l3) { return { _mm_castsi128_ps(_mm_set_epi32(-int32(l3), -int32(l2), -int32(l1), -int32(l0))) }; }
+    void Store(float* values) const { _mm_storeu_ps(values, V); }
+
+    friend Float4 operator+(Float4 left, Float4 right) { return { _mm_add_ps(left.V, right.V) }; }
+    friend Float4 operator-(Float4 left, Float4 right) { return { _mm_sub_ps(left.V, right.V) }; }
+    friend Float4 operator*(Float4 left, Float4 right) { return { _mm_mul_ps(left.V, right.V) }; }
+    friend Float4 operator/(Float4 left, Float4 right) { return { _mm_div_ps(left.V, right.V) }; }
+    friend Float4 operator<(Float4 left, Float4 right) { return { _mm_cmplt_ps(left.V, right.V) }; }
+    friend Float4 operator<=(Float4 left, Float4 right) { return { _mm_cmple_ps(left.V, right.V) }; }
+    friend Float4 operator>(Float4 left, Float4 right) { return { _mm_cmpgt_ps(left.V, right.V) }; }
+    friend Float4 operator>=(Float4 left, Float4 right) { return { _mm_cmpge_ps(left.V, right.V) }; }
+    friend Float4 operator&(Float4 left, Float4 right) { return { _mm_and_ps(left.V, right.V) }; }
+    friend Float4 operator|(Float4 left, Float4 right) { return { _mm_or_ps(left.V, right.V) }; }
+
+    // left < right ? left : right
+    friend Float4 Min(Float4 left, Float4 right) { return { _mm_min_ps(left.V, right.V) }; }
+    // left > right ? left : right
+    friend Float4 Max(Float4 left, Float4 right) { return { _mm_max_ps(left.V, right.V) }; }
+    friend Float4 Abs(Float4 value) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), value.V) }; }
+    // mask ? ifSet : ifCleared, per lane
+    friend Float4 Select(Float4 mask, Float4 ifSet, Float4 ifCleared) { return { _mm_or_ps(_mm_and_ps(mask.V, ifSet.V), _mm_andnot_ps(mask.V, ifCleared.V)) }; }
+    // Bit i is set when lane i of the mask is set
+    friend uint32 MoveMask(Float4 mask) { return uint32(_mm_movemask_ps(mask.V)); }
+#else
+    std::array<float, 4> V;
+
+    static Float4 Broadcast(float value) { return { { value, value, value, value } }; }
+    static Float4 Load(float const* values) { return { { values[0], values[1], values[2], values[3] } }; }
+    static Float4 Mask(bool l0, bool l1, bool l2, bool l3) { return { { MaskLane(l0), MaskLane(l1), MaskLane(l2), MaskLane(l3) } }; }
+    void Store(float* values) const { std::copy(V.begin(), V.end(), values); }
+
+    friend Float4 operator+(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return l + r; }); }
+    friend Float4 operator-(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return l - r; }); }
+    friend Float4 operator*(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return l * r; }); }
+    friend Float4 operator/(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return l / r; }); }
+    friend Float4 operator<(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return MaskLane(l < r); }); }
+    friend Float4 operator<=(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return MaskLane(l <= r); }); }
+    friend Float4 operator>(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return MaskLane(l > r); }); }
+    friend Float4 operator>=(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return MaskLane(l >= r); }); }
+    friend Float4 operator&(Float4 left, Float4 right) { return ApplyBits(left, right, [](uint32 l, uint32 r) { return l & r; }); }
+    friend Float4 operator|(Float4 left, Float4 right) { return ApplyBits(left, right, [](uint32 l, uint32 r) { return l | r; }); }
+
+    friend Float4 Min(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return l < r ? l : r; }); }
+    friend Float4 Max(Float4 left, Float4 right) { return Apply(left, right, [](float l, float r) { return l > r ? l : r; }); }
+    friend Float4 Abs(Float4 value) { return ApplyBits(value, value, [](uint32 l, uint32) { return l & 0x7FFFFFFFu; }); }
+    friend Float4 Select(Float4 mask, Float4 ifSet, Float4 ifCleared)
+    {
+        Float4 result;
+        for (std::size_t i = 0; i < 4; ++i)
+            result.V[i] = std::bit_cast<uint32>(mask.V[i]) ? ifSet.V[i] : ifCleared.V[i];
+        return result;
+    }
+    friend uint32 MoveMask(Float4 mask)
+    {
+        uint32 bits = 0;
+        for (std::size_t i = 0; i < 4; ++i)
+            bits |= (std::bit_cast<uint32>(mask.V[i]) >> 31) << i;
+        return bits;
+    }
+
+private:
+    static float MaskLane(bool set) { return std::bit_cast<float>(set ? 0xFFFFFFFFu : 0u); }
+
+    template<typename Operation>
+    static Float4 Apply(Float4 left, Float4 right, Operation operation)
+    {
+        Float4 result;
+        for (std::size_t i = 0; i < 4; ++i)
+            result.V[i] = operation(left.V[i], right.V[i]);
+        return result;
+    }
+
+    template<typename Operation>
+    static Float4 ApplyBits(Float4 left, Float4 right, Operation operation)
+    {
+        Float4 result;
+        for (std::size_t i = 0; i < 4; ++i)
+            result.V[i] = std::bit_cast<float>(operation(std::bit_cast<uint32>(left.V[i]), std::bit_cast<uint32>(right.V[i])));
+        return result;
+    }
+#endif
+};
+}
+
+#endif // TRINITYCORE_FLOAT4_H
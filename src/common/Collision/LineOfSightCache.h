@@ -0,0 +1,129 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_LINE_OF_SIGHT_CACHE_H
+#define TRINITYCORE_LINE_OF_SIGHT_CACHE_H
+
+#include "Define.h"
+#include "Hash.h"
+#include "Optional.h"
+#include <array>
+#include <bit>
+#include <cmath>
+#include <vector>
+
+namespace VMAP
+{
+/*
+ * Fixed size, direct mapped cache of line of sight results.
+ * Ray endpoints are snapped to a grid of Quantum yards, so rays between nearly the same points share an entry.
+ * Every entry remembers the generation of the geometry it was computed against, entries of any other
+ * generation are misses, so invalidating the whole cache is a counter increment at the owner.
+ * Storage is only allocated by the first Store.
+ */
+class LineOfSightCache
+{
+public:
+    static constexpr float Quantum = 0.25f;
+
+    struct Key
+    {
+        std::array<int32, 6> Ends = { };
+        uint32 Filter = 0;                          // anything else the result depends on, like a phase mask
+
+        bool operator==(Key const& right) const = default;
+    };
+
+    explicit LineOfSightCache(std::size_t size) : _size(size ? std::bit_ceil(size) : 0) { }
+
+    bool IsEnabled() const { return _size != 0; }
+
+    // Fails for coordinates that can not be snapped, such rays are not cached
+    static bool MakeKey(float x1, float y1, float z1, float x2, float y2, float z2, uint32 filter, Key& key)
+    {
+        float const coords[] = { x1, y1, z1, x2, y2, z2 };
+        for (std::size_t i = 0; i < key.Ends.size(); ++i)
+        {
+            float snapped = std::floor(coords[i] / Quantum);
+            if (!(std::fabs(snapped) < float(1 << 30)))
+                return false;
+
+            key.Ends[i] = int32(snapped);
+        }
+
+        key.Filter = filter;
+        return true;
+    }
+
+    Optional<bool> Find(Key const& key, uint32 generation) const
+    {
+        if (_entries.empty())
+            return {};
+
+        Entry const& entry = _entries[IndexOf(key)];
+        if (!entry.Used || entry.Generation != generation || !(entry.CachedKey == key))
+            return {};
+
+        return entry.Result;
+    }
+
+    void Store(Key const& key, uint32 generation, bool result)
+    {
+        if (!_size)
+            return;
+
+        if (_entries.empty())
+            _entries.resize(_size);
+
+        Entry& entry = _entries[IndexOf(key)];
+        entry.CachedKey = key;
+        entry.Generation = generation;
+        entry.Result = result;
+        entry.Used = true;
+    }
+
+    void Clear()
+    {
+        _entries.clear();
+        _entries.shrink_to_fit();
+    }
+
+private:
+    struct Entry
+    {
+        Key CachedKey;
+        uint32 Generation = 0;
+        bool Result = false;
+        bool Used = false;
+    };
+
+    std::size_t IndexOf(Key const& key) const
+    {
+        std::size_t hash = 0;
+        for (int32 end : key.Ends)
+            Trinity::hash_combine(hash, end);
+
+        Trinity::hash_combine(hash, key.Filter);
+        return hash & (_size - 1);
+    }
+
+    std::size_t _size;
+    std::vector<Entry> _entries;
+};
+}
+
+#endif // TRINITYCORE_LINE_OF_SIGHT_CACHE_H
@@ -49,6 +49,14 @@ namespace VMAP
     #define VMAP_INVALID_HEIGHT       -100000.0f            // for check
     #define VMAP_INVALID_HEIGHT_VALUE -200000.0f            // real assigned value in unknown height case
 
+    // One ray of a batched line of sight query
+    struct LineOfSightRay
+    {
+        float X1 = 0.0f, Y1 = 0.0f, Z1 = 0.0f;
+        float X2 = 0.0f, Y2 = 0.0f, Z2 = 0.0f;
+        bool InLineOfSight = true;
+    };
+
     struct AreaAndLiquidData
     {
         struct AreaInfo
@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <numeric>
 #include <string>
 #include <sstream>
 #include "VMapManager2.h"
@@ -180,6 +181,59 @@ namespace VMAP
         return true;
     }
 
+    void VMapManager2::isInLineOfSight(unsigned int mapId, std::span<LineOfSightRay> rays, ModelIgnoreFlags ignoreFlags)
+    {
+        for (LineOfSightRay& ray : rays)
+            ray.InLineOfSight = true;
+
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+            return;
+
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+            return;
+
+        // rays with the same direction signs walk the tree in the same order, trace them in the same packets
+        auto octant = [](LineOfSightRay const& ray)
+        {
+            return uint32(ray.X2 < ray.X1) | uint32(ray.Y2 < ray.Y1) << 1 | uint32(ray.Z2 < ray.Z1) << 2;
+        };
+
+        std::vector<uint32> order(rays.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](uint32 left, uint32 right) { return octant(rays[left]) < octant(rays[right]); });
+
+        for (std::size_t first = 0; first < order.size(); first += BIH::RayPacketSize)
+        {
+            uint32 count = uint32(std::min<std::size_t>(order.size() - first, BIH::RayPacketSize));
+            Vector3 pos1[BIH::RayPacketSize];
+            Vector3 pos2[BIH::RayPacketSize];
+            bool results[BIH::RayPacketSize];
+            for (uint32 i = 0; i < count; ++i)
+            {
+                LineOfSightRay const& ray = rays[order[first + i]];
+                pos1[i] = convertPositionToInternalRep(ray.X1, ray.Y1, ray.Z1);
+                pos2[i] = convertPositionToInternalRep(ray.X2, ray.Y2, ray.Z2);
+            }
+
+            instanceTree->second->isInLineOfSight(pos1, pos2, results, count, ignoreFlags);
+            for (uint32 i = 0; i < count; ++i)
+                rays[order[first + i]].InLineOfSight = results[i];
+        }
+    }
+
+    uint32 VMapManager2::getLineOfSightGeneration(unsigned int mapId) const
+    {
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+            return 0;
+
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+            return 0;
+
+        return instanceTree->second->getGeneration();
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
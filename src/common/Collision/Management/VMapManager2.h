@@ -19,6 +19,7 @@
 #define _VMAPMANAGER2_H
 
 #include <mutex>
+#include <span>
 #include <unordered_map>
 #include <vector>
 #include "Define.h"
@@ -107,6 +108,10 @@ namespace VMAP
             void unloadMap(unsigned int mapId) override;
 
             bool isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2, ModelIgnoreFlags ignoreFlags) override ;
+            // Same as isInLineOfSight for every ray, the map tree is looked up once
+            void isInLineOfSight(unsigned int mapId, std::span<LineOfSightRay> rays, ModelIgnoreFlags ignoreFlags);
+            // Changes whenever line of sight results of the map may change, 0 if they are not computed at all
+            uint32 getLineOfSightGeneration(unsigned int mapId) const;
             /**
             fill the hit pos and return true, if an object was hit
             */
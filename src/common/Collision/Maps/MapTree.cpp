@@ -89,7 +89,7 @@ namespace VMAP
 
     StaticMapTree::StaticMapTree(uint32 mapID, std::string const& basePath) :
         iMapID(mapID), iIsTiled(false), iTreeValues(nullptr),
-        iNTreeValues(0), iBasePath(basePath)
+        iNTreeValues(0), iBasePath(basePath), iGeneration(1)
     {
         if (iBasePath.length() > 0 && iBasePath[iBasePath.length()-1] != '/' && iBasePath[iBasePath.length()-1] != '\\')
         {
@@ -139,6 +139,50 @@ namespace VMAP
 
         return true;
     }
+
+    void StaticMapTree::isInLineOfSight(Vector3 const* pos1, Vector3 const* pos2, bool* results, uint32 count, ModelIgnoreFlags ignoreFlags) const
+    {
+        ASSERT(count <= BIH::RayPacketSize);
+
+        G3D::Ray rays[BIH::RayPacketSize];
+        float maxDist[BIH::RayPacketSize];
+        uint32 rayIndex[BIH::RayPacketSize];
+        uint32 numRays = 0;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            results[i] = true;
+            float dist = (pos2[i] - pos1[i]).magnitude();
+            // same special cases as for a single ray
+            if (dist == std::numeric_limits<float>::max() || !std::isfinite(dist))
+            {
+                results[i] = false;
+                continue;
+            }
+
+            if (dist < 1e-10f)
+                continue;
+
+            rays[numRays] = G3D::Ray::fromOriginAndDirection(pos1[i], (pos2[i] - pos1[i]) / dist);
+            maxDist[numRays] = dist;
+            rayIndex[numRays] = i;
+            ++numRays;
+        }
+
+        if (!numRays)
+            return;
+
+        MapRayCallback callbacks[BIH::RayPacketSize] =
+        {
+            { iTreeValues, ignoreFlags }, { iTreeValues, ignoreFlags }, { iTreeValues, ignoreFlags }, { iTreeValues, ignoreFlags }
+        };
+        static_assert(BIH::RayPacketSize == 4);
+
+        iTree.intersectRayPacket(rays, callbacks, maxDist, numRays, true);
+        for (uint32 i = 0; i < numRays; ++i)
+            if (callbacks[i].didHit())
+                results[rayIndex[i]] = false;
+    }
+
     //=========================================================
     /**
     When moving from pos1 to pos2 check if we hit an object. Return true and the position if we hit one
@@ -289,6 +333,7 @@ namespace VMAP
         }
 
         fclose(rf);
+        iGeneration.fetch_add(1, std::memory_order_release);
         return success;
     }
 
@@ -304,6 +349,7 @@ namespace VMAP
         }
         iLoadedSpawns.clear();
         iLoadedTiles.clear();
+        iGeneration.fetch_add(1, std::memory_order_release);
     }
 
     //=========================================================
@@ -383,6 +429,7 @@ namespace VMAP
         }
         else
             iLoadedTiles[packTileID(tileX, tileY)] = false;
+        iGeneration.fetch_add(1, std::memory_order_release);
         TC_METRIC_EVENT("map_events", "LoadMapTile",
             "Map: " + std::to_string(iMapID) + " TileX: " + std::to_string(tileX) + " TileY: " + std::to_string(tileY));
         return result;
@@ -443,6 +490,7 @@ namespace VMAP
             }
         }
         iLoadedTiles.erase(tile);
+        iGeneration.fetch_add(1, std::memory_order_release);
         TC_METRIC_EVENT("map_events", "UnloadMapTile",
             "Map: " + std::to_string(iMapID) + " TileX: " + std::to_string(tileX) + " TileY: " + std::to_string(tileY));
     }
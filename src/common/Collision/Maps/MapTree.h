@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "BoundingIntervalHierarchy.h"
+#include <atomic>
 #include <unordered_map>
 
 namespace VMAP
@@ -63,6 +64,8 @@ namespace VMAP
             // stores <tree_index, reference_count> to invalidate tree values, unload map, and to be able to report errors
             loadedSpawnMap iLoadedSpawns;
             std::string iBasePath;
+            // changes whenever geometry is loaded or unloaded
+            std::atomic<uint32> iGeneration;
 
         private:
             bool getIntersectionTime(const G3D::Ray& pRay, float &pMaxDist, bool pStopAtFirstHit, ModelIgnoreFlags ignoreFlags) const;
@@ -77,6 +80,8 @@ namespace VMAP
             ~StaticMapTree();
 
             bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2, ModelIgnoreFlags ignoreFlags) const;
+            // Same as isInLineOfSight for up to BIH::RayPacketSize pairs of points, the rays are traced through the tree as one packet
+            void isInLineOfSight(G3D::Vector3 const* pos1, G3D::Vector3 const* pos2, bool* results, uint32 count, ModelIgnoreFlags ignoreFlags) const;
             bool getObjectHitPos(const G3D::Vector3& pos1, const G3D::Vector3& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
             float getHeight(const G3D::Vector3& pPos, float maxSearchDist) const;
             bool GetLocationInfo(const G3D::Vector3 &pos, LocationInfo &info) const;
@@ -86,6 +91,7 @@ namespace VMAP
             bool LoadMapTile(uint32 tileX, uint32 tileY, VMapManager2* vm);
             void UnloadMapTile(uint32 tileX, uint32 tileY, VMapManager2* vm);
             bool isTiled() const { return iIsTiled; }
+            uint32 getGeneration() const { return iGeneration.load(std::memory_order_acquire); }
             uint32 numLoadedTiles() const { return uint32(iLoadedTiles.size()); }
             void getModelInstances(ModelInstance* &models, uint32 &count);
 
@@ -20,6 +20,7 @@
 #include "MapTree.h"
 #include "ModelInstance.h"
 #include "ModelIgnoreFlags.h"
+#include "Float4.h"
 #include <array>
 
 using G3D::Vector3;
@@ -81,6 +82,68 @@ namespace VMAP
         return false;
     }
 
+    // Same as IntersectTriangle for up to 4 triangles at once
+    bool IntersectTriangles(std::vector<MeshTriangle>::const_iterator triangles, uint32 const* entries, uint32 count, std::vector<Vector3>::const_iterator points, G3D::Ray const& ray, float& distance)
+    {
+        static const float EPS = 1e-5f;
+
+        float v0[3][4], e1[3][4], e2[3][4];
+        for (uint32 lane = 0; lane < 4; ++lane)
+        {
+            // unused lanes repeat the first triangle, they can not find a hit it does not find
+            MeshTriangle const& tri = triangles[entries[lane < count ? lane : 0]];
+            Vector3 const& p0 = points[tri.idx0];
+            Vector3 const edge1 = points[tri.idx1] - p0;
+            Vector3 const edge2 = points[tri.idx2] - p0;
+            for (int i = 0; i < 3; ++i)
+            {
+                v0[i][lane] = p0[i];
+                e1[i][lane] = edge1[i];
+                e2[i][lane] = edge2[i];
+            }
+        }
+
+        Float4 const e1x = Float4::Load(e1[0]), e1y = Float4::Load(e1[1]), e1z = Float4::Load(e1[2]);
+        Float4 const e2x = Float4::Load(e2[0]), e2y = Float4::Load(e2[1]), e2z = Float4::Load(e2[2]);
+        Float4 const dx = Float4::Broadcast(ray.direction().x), dy = Float4::Broadcast(ray.direction().y), dz = Float4::Broadcast(ray.direction().z);
+
+        // same operations in the same order as IntersectTriangle
+        Float4 const px = dy * e2z - dz * e2y;
+        Float4 const py = dz * e2x - dx * e2z;
+        Float4 const pz = dx * e2y - dy * e2x;
+        Float4 const a = e1x * px + e1y * py + e1z * pz;
+        Float4 valid = Abs(a) >= Float4::Broadcast(EPS);
+
+        Float4 const f = Float4::Broadcast(1.0f) / a;
+        Float4 const sx = Float4::Broadcast(ray.origin().x) - Float4::Load(v0[0]);
+        Float4 const sy = Float4::Broadcast(ray.origin().y) - Float4::Load(v0[1]);
+        Float4 const sz = Float4::Broadcast(ray.origin().z) - Float4::Load(v0[2]);
+        Float4 const u = f * (sx * px + sy * py + sz * pz);
+        valid = valid & (u >= Float4::Broadcast(0.0f)) & (u <= Float4::Broadcast(1.0f));
+
+        Float4 const qx = sy * e1z - sz * e1y;
+        Float4 const qy = sz * e1x - sx * e1z;
+        Float4 const qz = sx * e1y - sy * e1x;
+        Float4 const v = f * (dx * qx + dy * qy + dz * qz);
+        valid = valid & (v >= Float4::Broadcast(0.0f)) & ((u + v) <= Float4::Broadcast(1.0f));
+
+        Float4 const t = f * (e2x * qx + e2y * qy + e2z * qz);
+        valid = valid & (t > Float4::Broadcast(0.0f)) & (t < Float4::Broadcast(distance));
+
+        uint32 hits = MoveMask(valid) & ((1u << count) - 1);
+        if (!hits)
+            return false;
+
+        // IntersectTriangle keeps the closest hit
+        float laneT[4];
+        t.Store(laneT);
+        for (uint32 lane = 0; lane < count; ++lane)
+            if (hits & (1 << lane) && laneT[lane] < distance)
+                distance = laneT[lane];
+
+        return true;
+    }
+
     class TriBoundFunc
     {
         public:
@@ -401,6 +464,12 @@ namespace VMAP
             hit = IntersectTriangle(triangles[entry], vertices, ray, distance) || hit;
             return hit;
         }
+        bool operator()(G3D::Ray const& ray, uint32 const* entries, uint32 count, float& distance, bool /*pStopAtFirstHit*/)
+        {
+            for (uint32 i = 0; i < count; i += 4)
+                hit = IntersectTriangles(triangles, entries + i, std::min(count - i, 4u), vertices, ray, distance) || hit;
+            return hit;
+        }
         std::vector<Vector3>::const_iterator vertices;
         std::vector<MeshTriangle>::const_iterator triangles;
         bool hit;
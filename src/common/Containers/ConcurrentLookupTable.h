@@ -0,0 +1,250 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_CONCURRENT_LOOKUP_TABLE_H
+#define TRINITYCORE_CONCURRENT_LOOKUP_TABLE_H
+
+#include "Define.h"
+#include "EpochReclaimer.h"
+#include "Errors.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Trinity::Containers
+{
+// Open addressing hash table mapping non-zero 64 bit keys to object pointers.
+// Find is wait-free and safe to call from any thread at any time,
+// Insert/Add/Remove must be serialized by the caller (single writer).
+// Removed slots keep their key and are only ever reused for the same key, so a reader
+// matching a key never observes a value that was stored for a different one.
+// Tables replaced by a rehash are freed through Trinity::Epoch once no reader can see them.
+template <class T>
+class ConcurrentLookupTable
+{
+    struct Slot
+    {
+        std::atomic<uint64> Key = 0;
+        std::atomic<T*> Value = nullptr;
+    };
+
+    struct Table
+    {
+        explicit Table(std::size_t capacity) : Mask(capacity - 1), Slots(std::make_unique<Slot[]>(capacity)) { }
+
+        std::size_t Mask;
+        std::unique_ptr<Slot[]> Slots;
+    };
+
+    struct RetiredTable
+    {
+        Table* Data;
+        uint64 Epoch;
+    };
+
+public:
+    explicit ConcurrentLookupTable(std::size_t initialCapacity = 64) : _table(new Table(RoundCapacity(initialCapacity))), _live(0), _used(0) { }
+
+    ~ConcurrentLookupTable()
+    {
+        delete _table.load(std::memory_order_relaxed);
+        for (RetiredTable const& retired : _retired)
+            delete retired.Data;
+    }
+
+    ConcurrentLookupTable(ConcurrentLookupTable const&) = delete;
+    ConcurrentLookupTable& operator=(ConcurrentLookupTable const&) = delete;
+
+    T* Find(uint64 key) const
+    {
+        return Find(key, [](T const*) { return true; });
+    }
+
+    // returns the first value stored under key that satisfies pred, used when keys are hashes that may collide
+    template <class Pred>
+    T* Find(uint64 key, Pred&& pred) const
+    {
+        Trinity::Epoch::ReadGuard guard;
+        Table const* table = _table.load(std::memory_order_acquire);
+        for (std::size_t i = Hash(key) & table->Mask; ; i = (i + 1) & table->Mask)
+        {
+            uint64 slotKey = table->Slots[i].Key.load(std::memory_order_acquire);
+            if (!slotKey)
+                return nullptr;
+
+            if (slotKey == key)
+                if (T* value = table->Slots[i].Value.load(std::memory_order_acquire))
+                    if (pred(value))
+                        return value;
+        }
+    }
+
+    // stores value under key, replacing the previous value for that key
+    void Insert(uint64 key, T* value)
+    {
+        if (Slot* slot = FindSlot(key, [](T const*) { return true; }))
+        {
+            slot->Value.store(value, std::memory_order_release);
+            return;
+        }
+
+        Add(key, value);
+    }
+
+    // stores value under key without replacing other values stored under the same key
+    void Add(uint64 key, T* value)
+    {
+        ASSERT(key && value);
+        Table* table = _table.load(std::memory_order_relaxed);
+        if ((_used + 1) * 2 > table->Mask + 1)
+            table = Rehash();
+
+        for (std::size_t i = Hash(key) & table->Mask; ; i = (i + 1) & table->Mask)
+        {
+            Slot& slot = table->Slots[i];
+            uint64 slotKey = slot.Key.load(std::memory_order_relaxed);
+            if (!slotKey)
+            {
+                slot.Value.store(value, std::memory_order_relaxed);
+                slot.Key.store(key, std::memory_order_release);
+                ++_used;
+                break;
+            }
+
+            if (slotKey == key && !slot.Value.load(std::memory_order_relaxed))
+            {
+                slot.Value.store(value, std::memory_order_release);
+                break;
+            }
+        }
+
+        ++_live;
+    }
+
+    bool Remove(uint64 key)
+    {
+        return RemoveIf(key, [](T const*) { return true; });
+    }
+
+    bool Remove(uint64 key, T const* value)
+    {
+        return RemoveIf(key, [value](T const* stored) { return stored == value; });
+    }
+
+    std::size_t Size() const { return _live; }
+
+private:
+    template <class Pred>
+    bool RemoveIf(uint64 key, Pred&& pred)
+    {
+        Slot* slot = FindSlot(key, pred);
+        if (!slot)
+            return false;
+
+        slot->Value.store(nullptr, std::memory_order_release);
+        --_live;
+        ReclaimRetired();
+        return true;
+    }
+
+    template <class Pred>
+    Slot* FindSlot(uint64 key, Pred&& pred)
+    {
+        Table* table = _table.load(std::memory_order_relaxed);
+        for (std::size_t i = Hash(key) & table->Mask; ; i = (i + 1) & table->Mask)
+        {
+            Slot& slot = table->Slots[i];
+            uint64 slotKey = slot.Key.load(std::memory_order_relaxed);
+            if (!slotKey)
+                return nullptr;
+
+            if (slotKey == key)
+                if (T* value = slot.Value.load(std::memory_order_relaxed))
+                    if (pred(value))
+                        return &slot;
+        }
+    }
+
+    // rebuilds the table without tombstones, growing it if live entries would keep it over a quarter full
+    Table* Rehash()
+    {
+        Table* oldTable = _table.load(std::memory_order_relaxed);
+        std::size_t capacity = oldTable->Mask + 1;
+        while ((_live + 1) * 4 > capacity)
+            capacity *= 2;
+
+        Table* newTable = new Table(capacity);
+        _used = 0;
+        for (std::size_t i = 0; i <= oldTable->Mask; ++i)
+        {
+            T* value = oldTable->Slots[i].Value.load(std::memory_order_relaxed);
+            if (!value)
+                continue;
+
+            uint64 key = oldTable->Slots[i].Key.load(std::memory_order_relaxed);
+            std::size_t j = Hash(key) & newTable->Mask;
+            while (newTable->Slots[j].Key.load(std::memory_order_relaxed))
+                j = (j + 1) & newTable->Mask;
+
+            newTable->Slots[j].Key.store(key, std::memory_order_relaxed);
+            newTable->Slots[j].Value.store(value, std::memory_order_relaxed);
+            ++_used;
+        }
+
+        _table.store(newTable, std::memory_order_release);
+        _retired.push_back({ oldTable, Trinity::Epoch::Retire() });
+        ReclaimRetired();
+        return newTable;
+    }
+
+    void ReclaimRetired()
+    {
+        while (!_retired.empty() && Trinity::Epoch::CanReclaim(_retired.front().Epoch))
+        {
+            delete _retired.front().Data;
+            _retired.erase(_retired.begin());
+        }
+    }
+
+    static std::size_t RoundCapacity(std::size_t capacity)
+    {
+        std::size_t rounded = 16;
+        while (rounded < capacity)
+            rounded *= 2;
+
+        return rounded;
+    }
+
+    static std::size_t Hash(uint64 key)
+    {
+        // splitmix64 finalizer, guid counters are sequential and would otherwise cluster
+        key ^= key >> 30;
+        key *= UI64LIT(0xBF58476D1CE4E5B9);
+        key ^= key >> 27;
+        key *= UI64LIT(0x94D049BB133111EB);
+        key ^= key >> 31;
+        return std::size_t(key);
+    }
+
+    std::atomic<Table*> _table;
+    std::size_t _live;
+    std::size_t _used;
+    std::vector<RetiredTable> _retired;
+};
+}
+
+#endif // TRINITYCORE_CONCURRENT_LOOKUP_TABLE_H
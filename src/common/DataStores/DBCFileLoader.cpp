@@ -21,15 +21,23 @@
 
 #include "DBCFileLoader.h"
 #include "Errors.h"
+#include "MappedFile.h"
+
+namespace
+{
+    constexpr std::size_t HeaderSize = 20;                  // magic, record count, field count, record size, string size
+}
 
 DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
 
 bool DBCFileLoader::Load(char const* filename, char const* fmt)
 {
-    uint32 header;
     if (data)
     {
-        delete [] data;
+        if (mapping)
+            mapping.reset();
+        else
+            delete [] data;
         data = nullptr;
     }
 
@@ -37,52 +45,67 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
     if (!f)
         return false;
 
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
+    unsigned char header[HeaderSize];
+    if (fread(header, HeaderSize, 1, f) != 1 || !ReadHeader(header, fmt))
     {
         fclose(f);
         return false;
     }
 
-    EndianConvert(header);
+    data = new unsigned char[recordSize * recordCount + stringSize];
+    stringTable = data + recordSize*recordCount;
 
-    if (header != 0x43424457)                                //'WDBC'
+    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
     {
         fclose(f);
         return false;
     }
 
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
-    {
-        fclose(f);
-        return false;
-    }
+    fclose(f);
 
-    EndianConvert(recordCount);
+    return true;
+}
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
+bool DBCFileLoader::LoadMapped(char const* filename, char const* fmt)
+{
+    if (data)
     {
-        fclose(f);
-        return false;
+        if (mapping)
+            mapping.reset();
+        else
+            delete [] data;
+        data = nullptr;
     }
 
-    EndianConvert(fieldCount);
+    std::unique_ptr<Trinity::MappedFile> file = std::make_unique<Trinity::MappedFile>();
+    if (!file->Open(filename) || file->GetSize() < HeaderSize || !ReadHeader(file->GetData(), fmt))
+        return false;
 
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
-    {
-        fclose(f);
+    if (file->GetSize() - HeaderSize < std::size_t(recordSize) * recordCount + stringSize)
         return false;
-    }
 
-    EndianConvert(recordSize);
+    mapping = std::move(file);
+    data = mapping->GetData() + HeaderSize;
+    stringTable = data + recordSize*recordCount;
+    return true;
+}
 
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
-    {
-        fclose(f);
+bool DBCFileLoader::ReadHeader(unsigned char const* header, char const* fmt)
+{
+    uint32 fields[HeaderSize / 4];
+    memcpy(fields, header, HeaderSize);
+    for (uint32& field : fields)
+        EndianConvert(field);
+
+    if (fields[0] != 0x43424457)                             //'WDBC'
         return false;
-    }
 
-    EndianConvert(stringSize);
+    recordCount = fields[1];                                 // Number of records
+    fieldCount = fields[2];                                  // Number of fields
+    recordSize = fields[3];                                  // Size of a record
+    stringSize = fields[4];                                  // String size
 
+    delete[] fieldsOffset;
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
     for (uint32 i = 1; i < fieldCount; ++i)
@@ -94,23 +117,13 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
             fieldsOffset[i] += sizeof(uint32);
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
-    stringTable = data + recordSize*recordCount;
-
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
+    if (!mapping)
+        delete[] data;
 
     delete[] fieldsOffset;
 }
@@ -166,6 +179,70 @@ uint32 DBCFileLoader::GetFormatRecordSize(char const* format, int32* index_pos)
     return recordsize;
 }
 
+bool DBCFileLoader::IsInPlaceFormat(char const* format)
+{
+#if TRINITY_ENDIAN == TRINITY_LITTLEENDIAN
+    // strings are offsets on disk but pointers in memory, skipped fields are not in memory at all
+    for (uint32 x = 0; format[x]; ++x)
+        if (format[x] != FT_IND && format[x] != FT_INT && format[x] != FT_FLOAT && format[x] != FT_BYTE)
+            return false;
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+char** DBCFileLoader::ProduceInPlaceIndex(char const* format, std::size_t alignment, uint32& records)
+{
+    typedef char* ptr;
+    if (!mapping || !IsInPlaceFormat(format) || strlen(format) != fieldCount)
+        return nullptr;
+
+    // every record has to start at an address suitable for the structure
+    int32 i;
+    if (GetFormatRecordSize(format, &i) != recordSize || HeaderSize % alignment || recordSize % alignment)
+        return nullptr;
+
+    char** indexTable;
+    if (i >= 0)
+    {
+        uint32 maxi = 0;
+        //find max index
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            uint32 ind = getRecord(y).getUInt(i);
+            if (ind > maxi)
+                maxi = ind;
+        }
+
+        ++maxi;
+        records = maxi;
+        indexTable = new ptr[maxi];
+        memset(indexTable, 0, maxi * sizeof(ptr));
+        for (uint32 y = 0; y < recordCount; ++y)
+            indexTable[getRecord(y).getUInt(i)] = reinterpret_cast<char*>(data + y * recordSize);
+    }
+    else
+    {
+        records = recordCount;
+        indexTable = new ptr[recordCount];
+        for (uint32 y = 0; y < recordCount; ++y)
+            indexTable[y] = reinterpret_cast<char*>(data + y * recordSize);
+    }
+
+    return indexTable;
+}
+
+std::unique_ptr<Trinity::MappedFile> DBCFileLoader::ReleaseMapping()
+{
+    // records stay where they are, only this loader forgets about them
+    std::unique_ptr<Trinity::MappedFile> released = std::move(mapping);
+    data = nullptr;
+    stringTable = nullptr;
+    return released;
+}
+
 char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**& indexTable)
 {
     /*
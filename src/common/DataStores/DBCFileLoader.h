@@ -21,6 +21,12 @@
 #include "Define.h"
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
+
+namespace Trinity
+{
+    class MappedFile;
+}
 
 enum DbcFieldFormat
 {
@@ -44,6 +50,8 @@ class TC_COMMON_API DBCFileLoader
         ~DBCFileLoader();
 
         bool Load(const char *filename, const char *fmt);
+        // Same as Load, but the file is mapped into memory instead of copied
+        bool LoadMapped(char const* filename, char const* fmt);
 
         class Record
         {
@@ -96,8 +104,14 @@ class TC_COMMON_API DBCFileLoader
         bool IsLoaded() const { return data != nullptr; }
         char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
         char* AutoProduceStrings(char const* fmt, char* dataTable);
+        // Index table pointing at the records right inside a mapped file, nullptr if their layout on disk differs from fmt
+        char** ProduceInPlaceIndex(char const* fmt, std::size_t alignment, uint32& count);
+        std::unique_ptr<Trinity::MappedFile> ReleaseMapping();
         static uint32 GetFormatRecordSize(const char * format, int32 * index_pos = nullptr);
+        // Formats whose C++ structures have exactly the layout of the records on disk
+        static bool IsInPlaceFormat(char const* format);
     private:
+        bool ReadHeader(unsigned char const* header, char const* fmt);
 
         uint32 recordSize;
         uint32 recordCount;
@@ -106,6 +120,7 @@ class TC_COMMON_API DBCFileLoader
         uint32 *fieldsOffset;
         unsigned char *data;
         unsigned char *stringTable;
+        std::unique_ptr<Trinity::MappedFile> mapping;
 
         DBCFileLoader(DBCFileLoader const& right) = delete;
         DBCFileLoader& operator=(DBCFileLoader const& right) = delete;
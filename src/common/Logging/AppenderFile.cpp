@@ -16,6 +16,7 @@
  */
 
 #include "AppenderFile.h"
+#include "AsyncFileWriter.h"
 #include "Log.h"
 #include "LogMessage.h"
 #include "StringConvert.h"
@@ -47,7 +48,7 @@ AppenderFile::AppenderFile(uint8 id, std::string const& name, LogLevel level, Ap
             _fileName += sLog->GetLogsTimestamp();
     }
 
-    if (5 < args.size())
+    if (5 < args.size() && !args[5].empty())
     {
         if (Optional<uint32> size = Trinity::StringTo<uint32>(args[5]))
             _maxFileSize = *size;
@@ -55,20 +56,54 @@ AppenderFile::AppenderFile(uint8 id, std::string const& name, LogLevel level, Ap
             throw InvalidAppenderArgsException(Trinity::StringFormat("Log::CreateAppenderFromConfig: Invalid size '{}' for appender {}", args[5], name));
     }
 
+    uint32 queueSize = 8192;
+    if (6 < args.size() && !args[6].empty())
+    {
+        if (Optional<uint32> size = Trinity::StringTo<uint32>(args[6]); size && *size)
+            queueSize = *size;
+        else
+            throw InvalidAppenderArgsException(Trinity::StringFormat("Log::CreateAppenderFromConfig: Invalid queue size '{}' for appender {}", args[6], name));
+    }
+
+    AsyncLogFullPolicy fullPolicy = AsyncLogFullPolicy::Drop;
+    if (7 < args.size())
+    {
+        Optional<uint8> policy = Trinity::StringTo<uint8>(args[7]);
+        if (!policy || *policy > uint8(AsyncLogFullPolicy::Block))
+            throw InvalidAppenderArgsException(Trinity::StringFormat("Log::CreateAppenderFromConfig: Invalid queue full policy '{}' for appender {}", args[7], name));
+
+        fullPolicy = AsyncLogFullPolicy(*policy);
+    }
+
     _dynamicName = std::string::npos != _fileName.find("%s");
     _backup = (flags & APPENDER_FLAGS_MAKE_FILE_BACKUP) != 0;
 
     if (!_dynamicName)
         logfile = OpenFile(_fileName, mode, (mode == "w") && _backup);
+
+    // dynamic file names are opened per message, those appenders always write synchronously
+    if ((flags & APPENDER_FLAGS_ASYNC_WRITE) && !_dynamicName)
+        _asyncWriter = std::make_unique<AsyncFileWriter>(queueSize, fullPolicy, [this](std::string_view batch) { WriteBatch(batch); });
 }
 
 AppenderFile::~AppenderFile()
 {
+    // flushes everything still queued through WriteBatch
+    _asyncWriter.reset();
     CloseFile();
 }
 
 void AppenderFile::_write(LogMessage const* message)
 {
+    if (_asyncWriter)
+    {
+        std::string line;
+        line.reserve(message->Size() + 1);
+        line.append(message->prefix).append(message->text).push_back('\n');
+        _asyncWriter->Write(std::move(line));
+        return;
+    }
+
     bool exceedMaxSize = _maxFileSize > 0 && (_fileSize.load() + message->Size()) > _maxFileSize;
 
     if (_dynamicName)
@@ -96,6 +131,20 @@ void AppenderFile::_write(LogMessage const* message)
     _fileSize += uint64(message->Size());
 }
 
+// Writer thread of _asyncWriter, size limit is checked once per batch
+void AppenderFile::WriteBatch(std::string_view batch)
+{
+    if (_maxFileSize > 0 && _fileSize.load() + batch.size() > _maxFileSize)
+        logfile = OpenFile(_fileName, "w", true);
+
+    if (!logfile)
+        return;
+
+    fwrite(batch.data(), 1, batch.size(), logfile);
+    fflush(logfile);
+    _fileSize += uint64(batch.size());
+}
+
 FILE* AppenderFile::OpenFile(std::string const& filename, std::string const& mode, bool backup)
 {
     std::string fullName(_logDir + filename);
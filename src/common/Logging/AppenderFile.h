@@ -20,6 +20,10 @@
 
 #include "Appender.h"
 #include <atomic>
+#include <memory>
+#include <string_view>
+
+class AsyncFileWriter;
 
 class TC_COMMON_API AppenderFile : public Appender
 {
@@ -34,6 +38,7 @@ class TC_COMMON_API AppenderFile : public Appender
     private:
         void CloseFile();
         void _write(LogMessage const* message) override;
+        void WriteBatch(std::string_view batch);
         FILE* logfile;
         std::string _fileName;
         std::string _logDir;
@@ -41,6 +46,7 @@ class TC_COMMON_API AppenderFile : public Appender
         bool _backup;
         uint64 _maxFileSize;
         std::atomic<uint64> _fileSize;
+        std::unique_ptr<AsyncFileWriter> _asyncWriter;
 };
 
 #endif
@@ -0,0 +1,196 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AsyncFileWriter.h"
+#include "StringFormat.h"
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    std::atomic<uint64> NextInstanceId(0);
+    constexpr std::chrono::milliseconds WriterIdleWait(100);
+}
+
+// Single producer / single consumer ring, the producer is the owning thread and the consumer the writer thread
+struct AsyncFileWriter::Queue
+{
+    explicit Queue(std::size_t size) : Lines(size), Mask(size - 1), Head(0), Tail(0) { }
+
+    std::vector<std::string> Lines;
+    std::size_t const Mask;
+    alignas(64) std::atomic<std::size_t> Head;  // next line the writer thread takes
+    alignas(64) std::atomic<std::size_t> Tail;  // next free slot of the producer
+};
+
+AsyncFileWriter::AsyncFileWriter(std::size_t queueSize, AsyncLogFullPolicy fullPolicy, Sink sink) :
+    _queueSize(std::bit_ceil(std::max<std::size_t>(queueSize, 2))), _fullPolicy(fullPolicy), _sink(std::move(sink)), _instanceId(++NextInstanceId),
+    _wakeRequested(false), _stop(false), _flushRequested(0), _flushed(0), _dropped(0), _droppedTotal(0)
+{
+    _batch.reserve(MaxBatchSize);
+    _thread = std::thread(&AsyncFileWriter::WorkerThread, this);
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(_wakeLock);
+        _stop = true;
+    }
+
+    _wakeCondition.notify_one();
+    _thread.join();
+}
+
+void AsyncFileWriter::Write(std::string line)
+{
+    Queue& queue = GetThreadQueue();
+    std::size_t tail = queue.Tail.load(std::memory_order_relaxed);
+    while (tail - queue.Head.load(std::memory_order_acquire) >= _queueSize)
+    {
+        if (_fullPolicy == AsyncLogFullPolicy::Drop)
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            _droppedTotal.fetch_add(1, std::memory_order_relaxed);
+            Wake();
+            return;
+        }
+
+        Wake();
+        std::this_thread::yield();
+    }
+
+    queue.Lines[tail & queue.Mask] = std::move(line);
+    queue.Tail.store(tail + 1, std::memory_order_release);
+
+    // the writer wakes up on its own regularly, only hurry it when the ring fills up
+    if (tail + 1 - queue.Head.load(std::memory_order_relaxed) == _queueSize / 2)
+        Wake();
+}
+
+void AsyncFileWriter::Flush()
+{
+    std::unique_lock<std::mutex> lock(_wakeLock);
+    uint64 ticket = ++_flushRequested;
+    _wakeRequested = true;
+    _wakeCondition.notify_one();
+    _flushedCondition.wait(lock, [&] { return _flushed >= ticket; });
+}
+
+AsyncFileWriter::Queue& AsyncFileWriter::GetThreadQueue()
+{
+    // rings of writers that no longer exist are only referenced from here and get dropped on the next registration
+    thread_local std::vector<std::pair<uint64, std::shared_ptr<Queue>>> threadQueues;
+    for (std::pair<uint64, std::shared_ptr<Queue>> const& threadQueue : threadQueues)
+        if (threadQueue.first == _instanceId)
+            return *threadQueue.second;
+
+    std::erase_if(threadQueues, [](std::pair<uint64, std::shared_ptr<Queue>> const& threadQueue) { return threadQueue.second.use_count() == 1; });
+
+    std::shared_ptr<Queue> queue = std::make_shared<Queue>(_queueSize);
+    {
+        std::lock_guard<std::mutex> lock(_queuesLock);
+        _queues.push_back(queue);
+    }
+
+    return *threadQueues.emplace_back(_instanceId, std::move(queue)).second;
+}
+
+void AsyncFileWriter::Wake()
+{
+    {
+        std::lock_guard<std::mutex> lock(_wakeLock);
+        _wakeRequested = true;
+    }
+
+    _wakeCondition.notify_one();
+}
+
+void AsyncFileWriter::WorkerThread()
+{
+    std::unique_lock<std::mutex> lock(_wakeLock);
+    while (true)
+    {
+        _wakeCondition.wait_for(lock, WriterIdleWait, [this] { return _wakeRequested || _stop; });
+        _wakeRequested = false;
+        bool stop = _stop;
+        uint64 flushRequested = _flushRequested;
+
+        lock.unlock();
+        Drain();
+        lock.lock();
+
+        if (_flushed != flushRequested)
+        {
+            _flushed = flushRequested;
+            _flushedCondition.notify_all();
+        }
+
+        if (stop)
+            break;
+    }
+}
+
+void AsyncFileWriter::Drain()
+{
+    auto writeBatch = [this]()
+    {
+        if (!_batch.empty())
+            _sink(_batch);
+
+        _batch.clear();
+    };
+
+    // the sink may be slow, threads logging their first line must not wait for it
+    {
+        std::lock_guard<std::mutex> lock(_queuesLock);
+        _drainQueues.assign(_queues.begin(), _queues.end());
+    }
+
+    for (std::shared_ptr<Queue> const& queue : _drainQueues)
+    {
+        std::size_t head = queue->Head.load(std::memory_order_relaxed);
+        std::size_t const tail = queue->Tail.load(std::memory_order_acquire);
+        for (; head != tail; ++head)
+        {
+            std::string& line = queue->Lines[head & queue->Mask];
+            if (_batch.size() + line.size() > MaxBatchSize)
+            {
+                queue->Head.store(head, std::memory_order_release);
+                writeBatch();
+            }
+
+            _batch.append(line);
+            line.clear();
+        }
+
+        queue->Head.store(head, std::memory_order_release);
+    }
+
+    if (uint64 dropped = _dropped.exchange(0, std::memory_order_relaxed))
+        _batch.append(Trinity::StringFormat("AsyncFileWriter: {} log lines dropped, logging queue was full\n", dropped));
+
+    writeBatch();
+    _drainQueues.clear();
+
+    // rings of exited threads are only referenced from here
+    std::lock_guard<std::mutex> lock(_queuesLock);
+    std::erase_if(_queues, [](std::shared_ptr<Queue> const& queue)
+    {
+        return queue.use_count() == 1 && queue->Head.load(std::memory_order_relaxed) == queue->Tail.load(std::memory_order_relaxed);
+    });
+}
@@ -0,0 +1,100 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_ASYNC_FILE_WRITER_H
+#define TRINITYCORE_ASYNC_FILE_WRITER_H
+
+#include "Define.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+enum class AsyncLogFullPolicy : uint8
+{
+    Drop    = 0,    // discard the line and report how many were lost
+    Block   = 1     // wait until the writer thread made room
+};
+
+/*
+ * Moves file appender output off the logging threads.
+ * Every thread writing through an instance gets its own single producer ring of formatted lines,
+ * pushing a line is a move and two atomic operations. A dedicated writer thread drains all
+ * rings and hands the lines to the sink in batches of up to MaxBatchSize bytes, so the file
+ * sees one large write instead of a write and a flush per line.
+ */
+class TC_COMMON_API AsyncFileWriter
+{
+public:
+    // Called on the writer thread only
+    using Sink = std::function<void(std::string_view batch)>;
+
+    static constexpr std::size_t MaxBatchSize = 64 * 1024;
+
+    AsyncFileWriter(std::size_t queueSize, AsyncLogFullPolicy fullPolicy, Sink sink);
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(AsyncFileWriter const&) = delete;
+    AsyncFileWriter(AsyncFileWriter&&) = delete;
+    AsyncFileWriter& operator=(AsyncFileWriter const&) = delete;
+    AsyncFileWriter& operator=(AsyncFileWriter&&) = delete;
+
+    // line must already end with a newline
+    void Write(std::string line);
+
+    // Blocks until every line written by any thread before the call reached the sink
+    void Flush();
+
+    uint64 GetDroppedLines() const { return _droppedTotal.load(std::memory_order_relaxed); }
+
+private:
+    struct Queue;
+
+    Queue& GetThreadQueue();
+    void Wake();
+    void WorkerThread();
+    void Drain();
+
+    std::size_t const _queueSize;
+    AsyncLogFullPolicy const _fullPolicy;
+    Sink const _sink;
+    uint64 const _instanceId;
+
+    std::mutex _queuesLock;
+    std::vector<std::shared_ptr<Queue>> _queues;
+    std::vector<std::shared_ptr<Queue>> _drainQueues;
+
+    std::mutex _wakeLock;
+    std::condition_variable _wakeCondition;
+    std::condition_variable _flushedCondition;
+    bool _wakeRequested;
+    bool _stop;
+    uint64 _flushRequested;
+    uint64 _flushed;
+
+    std::atomic<uint64> _dropped;
+    std::atomic<uint64> _droppedTotal;
+    std::string _batch;
+    std::thread _thread;
+};
+
+#endif // TRINITYCORE_ASYNC_FILE_WRITER_H
@@ -0,0 +1,77 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_BOUNDED_THREAD_POOL_H
+#define TRINITY_BOUNDED_THREAD_POOL_H
+
+#include "ThreadPool.h"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace Trinity
+{
+/**
+  Thread pool that refuses new work once a fixed number of jobs is queued or running.
+  Callers are expected to handle the rejection (back-pressure) instead of letting an
+  unbounded backlog build up behind a burst of requests.
+*/
+class BoundedThreadPool
+{
+public:
+    BoundedThreadPool(std::size_t numThreads, std::size_t maxPendingTasks) : _impl(numThreads), _maxPendingTasks(maxPendingTasks), _pendingTasks(0) { }
+
+    /// Queues work, returns an empty optional when the pool is saturated
+    template<typename T>
+    std::optional<std::future<std::invoke_result_t<T>>> TryPostWork(T&& work)
+    {
+        std::size_t pending = _pendingTasks.load(std::memory_order_relaxed);
+        do
+        {
+            if (pending >= _maxPendingTasks)
+                return std::nullopt;
+        } while (!_pendingTasks.compare_exchange_weak(pending, pending + 1, std::memory_order_relaxed));
+
+        auto task = std::make_shared<std::packaged_task<std::invoke_result_t<T>()>>(std::forward<T>(work));
+        std::future<std::invoke_result_t<T>> future = task->get_future();
+        _impl.PostWork([this, task]()
+        {
+            (*task)();
+            _pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+        });
+
+        return future;
+    }
+
+    std::size_t GetPendingTasks() const { return _pendingTasks.load(std::memory_order_relaxed); }
+    std::size_t GetMaxPendingTasks() const { return _maxPendingTasks; }
+
+    void Join()
+    {
+        _impl.Join();
+    }
+
+private:
+    ThreadPool _impl;
+    std::size_t const _maxPendingTasks;
+    std::atomic<std::size_t> _pendingTasks;
+};
+}
+
+#endif // TRINITY_BOUNDED_THREAD_POOL_H
@@ -0,0 +1,120 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EpochReclaimer.h"
+#include <atomic>
+
+namespace
+{
+struct alignas(64) ThreadRecord
+{
+    // 0 while the owning thread is outside of any ReadGuard
+    std::atomic<uint64> Epoch = 0;
+    std::atomic<bool> InUse = true;
+    ThreadRecord* Next = nullptr;
+    // only accessed by the owning thread, allows nesting guards
+    uint32 Depth = 0;
+};
+
+std::atomic<uint64> GlobalEpoch = 1;
+
+// records are never freed, threads that exit give theirs back for reuse
+std::atomic<ThreadRecord*> Records = nullptr;
+
+ThreadRecord* AcquireRecord()
+{
+    for (ThreadRecord* record = Records.load(std::memory_order_acquire); record; record = record->Next)
+    {
+        bool inUse = false;
+        if (!record->InUse.load(std::memory_order_relaxed) && record->InUse.compare_exchange_strong(inUse, true, std::memory_order_acq_rel))
+            return record;
+    }
+
+    ThreadRecord* record = new ThreadRecord();
+    ThreadRecord* head = Records.load(std::memory_order_relaxed);
+    do
+    {
+        record->Next = head;
+    } while (!Records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+    return record;
+}
+
+struct ThreadRecordOwner
+{
+    ThreadRecordOwner() : Record(AcquireRecord()) { }
+
+    ~ThreadRecordOwner()
+    {
+        Record->Epoch.store(0, std::memory_order_release);
+        Record->InUse.store(false, std::memory_order_release);
+    }
+
+    ThreadRecord* Record;
+};
+
+// plain pointer keeps the fast path free of thread_local initialization guards
+thread_local ThreadRecord* CurrentRecord = nullptr;
+
+ThreadRecord* GetThreadRecord()
+{
+    if (!CurrentRecord)
+    {
+        thread_local ThreadRecordOwner owner;
+        CurrentRecord = owner.Record;
+    }
+
+    return CurrentRecord;
+}
+}
+
+Trinity::Epoch::ReadGuard::ReadGuard()
+{
+    ThreadRecord* record = GetThreadRecord();
+    if (record->Depth++)
+        return;
+
+    // seq_cst pairs with the fence in Retire - either the writer sees our epoch or we see the unlinked state
+    record->Epoch.exchange(GlobalEpoch.load(std::memory_order_acquire), std::memory_order_seq_cst);
+}
+
+Trinity::Epoch::ReadGuard::~ReadGuard()
+{
+    ThreadRecord* record = GetThreadRecord();
+    if (--record->Depth)
+        return;
+
+    record->Epoch.store(0, std::memory_order_release);
+}
+
+uint64 Trinity::Epoch::Retire()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return GlobalEpoch.fetch_add(1, std::memory_order_acq_rel) + 1;
+}
+
+bool Trinity::Epoch::CanReclaim(uint64 retireEpoch)
+{
+    for (ThreadRecord* record = Records.load(std::memory_order_acquire); record; record = record->Next)
+    {
+        uint64 epoch = record->Epoch.load(std::memory_order_acquire);
+        if (epoch && epoch < retireEpoch)
+            return false;
+    }
+
+    return true;
+}
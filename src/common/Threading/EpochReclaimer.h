@@ -0,0 +1,47 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_EPOCH_RECLAIMER_H
+#define TRINITYCORE_EPOCH_RECLAIMER_H
+
+#include "Define.h"
+
+namespace Trinity::Epoch
+{
+// Epoch based memory reclamation for read-mostly lock free containers.
+// Readers wrap every access in a ReadGuard, which only writes to a cache line owned by the calling thread.
+// Writers unlink memory, call Retire() to obtain the epoch it was retired in and free it once CanReclaim() returns true.
+class TC_COMMON_API ReadGuard
+{
+public:
+    ReadGuard();
+    ~ReadGuard();
+
+    ReadGuard(ReadGuard const&) = delete;
+    ReadGuard(ReadGuard&&) = delete;
+    ReadGuard& operator=(ReadGuard const&) = delete;
+    ReadGuard& operator=(ReadGuard&&) = delete;
+};
+
+// Must be called after the retired memory was unlinked from the shared structure
+TC_COMMON_API uint64 Retire();
+
+// True when no reader that could still observe memory retired in retireEpoch is inside a ReadGuard
+TC_COMMON_API bool CanReclaim(uint64 retireEpoch);
+}
+
+#endif // TRINITYCORE_EPOCH_RECLAIMER_H
@@ -20,8 +20,8 @@
 
 void EventMap::Reset()
 {
-    _eventMap.clear();
-    _time = TimePoint::min();
+    _eventMap.Reset();
+    _time = 0ms;
     _phaseMask = 0;
 }
 
@@ -41,7 +41,7 @@ void EventMap::ScheduleEvent(EventId eventId, Milliseconds time, GroupIndex grou
     if (phase > sizeof(PhaseMask) * 8)
         return;
 
-    _eventMap.insert(EventStore::value_type(_time + time, Event(eventId, group, phase)));
+    _eventMap.Schedule(ToKey(_time + time), Event(eventId, group, phase));
 }
 
 void EventMap::ScheduleEvent(EventId eventId, Milliseconds minTime, Milliseconds maxTime, GroupIndex group /*= 0*/, PhaseIndex phase /*= 0*/)
@@ -62,7 +62,7 @@ void EventMap::RescheduleEvent(EventId eventId, Milliseconds minTime, Millisecon
 
 void EventMap::Repeat(Milliseconds time)
 {
-    _eventMap.insert(EventStore::value_type(_time + time, _lastEvent));
+    _eventMap.Schedule(ToKey(_time + time), _lastEvent);
 }
 
 void EventMap::Repeat(Milliseconds minTime, Milliseconds maxTime)
@@ -72,21 +72,15 @@ void EventMap::Repeat(Milliseconds minTime, Milliseconds maxTime)
 
 EventMap::EventId EventMap::ExecuteEvent()
 {
-    while (!Empty())
+    EventStore::Handle handle;
+    while ((handle = _eventMap.PeekDue(ToKey(_time))) != EventStore::InvalidHandle)
     {
-        auto itr = _eventMap.begin();
-
-        if (itr->first > _time)
-            return 0;
-        else if (_phaseMask && itr->second._phaseMask && !(itr->second._phaseMask & _phaseMask))
-            _eventMap.erase(itr);
-        else
-        {
-            auto eventId = itr->second._id;
-            _lastEvent = itr->second;
-            _eventMap.erase(itr);
-            return eventId;
-        }
+        Event event = _eventMap.Remove(handle);
+        if (_phaseMask && event._phaseMask && !(event._phaseMask & _phaseMask))
+            continue;
+
+        _lastEvent = event;
+        return event._id;
     }
 
     return 0;
@@ -97,13 +91,9 @@ void EventMap::DelayEvents(Milliseconds delay)
     if (Empty())
         return;
 
-    EventStore delayed = std::move(_eventMap);
-    for (auto itr = delayed.begin(); itr != delayed.end();)
-    {
-        EventStore::node_type node = delayed.extract(itr++);
-        node.key() = node.key() + delay;
-        _eventMap.insert(_eventMap.end(), std::move(node));
-    }
+    // rescheduling in expiry order keeps events with equal times in their order
+    for (EventStore::Handle handle : _eventMap.Select([](Event const&) { return true; }))
+        _eventMap.Reschedule(handle, ToKey(Milliseconds(_eventMap.GetKey(handle)) + delay));
 }
 
 void EventMap::DelayEvents(Milliseconds delay, GroupIndex group)
@@ -111,20 +101,9 @@ void EventMap::DelayEvents(Milliseconds delay, GroupIndex group)
     if (!group || group > sizeof(GroupMask) * 8 || Empty())
         return;
 
-    EventStore delayed;
-
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (itr->second._groupMask & GroupMask(1u << (group - 1u)))
-        {
-            delayed.insert(EventStore::value_type(itr->first + delay, itr->second));
-            _eventMap.erase(itr++);
-        }
-        else
-            ++itr;
-    }
-
-    _eventMap.insert(delayed.begin(), delayed.end());
+    GroupMask groupMask = GroupMask(1u << (group - 1u));
+    for (EventStore::Handle handle : _eventMap.Select([groupMask](Event const& event) { return (event._groupMask & groupMask) != 0; }))
+        _eventMap.Reschedule(handle, ToKey(Milliseconds(_eventMap.GetKey(handle)) + delay));
 }
 
 void EventMap::SetMinimalDelay(EventId eventId, Milliseconds delay)
@@ -132,20 +111,10 @@ void EventMap::SetMinimalDelay(EventId eventId, Milliseconds delay)
     if (Empty())
         return;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (eventId == itr->second._id)
-        {
-            if (itr->first < (_time + delay))
-            {
-                _eventMap.insert(EventStore::value_type(_time + delay, itr->second));
-                itr = _eventMap.erase(itr);
-                continue;
-            }
-
-        }
-        ++itr;
-    }
+    uint64 minimalKey = ToKey(_time + delay);
+    for (EventStore::Handle handle : _eventMap.Select([eventId](Event const& event) { return event._id == eventId; }))
+        if (_eventMap.GetKey(handle) < minimalKey)
+            _eventMap.Reschedule(handle, minimalKey);
 }
 
 void EventMap::CancelEvent(EventId eventId)
@@ -153,13 +122,7 @@ void EventMap::CancelEvent(EventId eventId)
     if (Empty())
         return;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (eventId == itr->second._id)
-            _eventMap.erase(itr++);
-        else
-            ++itr;
-    }
+    _eventMap.RemoveIf([eventId](Event const& event) { return event._id == eventId; });
 }
 
 void EventMap::CancelEventGroup(GroupIndex group)
@@ -167,22 +130,17 @@ void EventMap::CancelEventGroup(GroupIndex group)
     if (!group || group > sizeof(GroupMask) * 8 || Empty())
         return;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (itr->second._groupMask & GroupMask(1u << (group - 1u)))
-            _eventMap.erase(itr++);
-        else
-            ++itr;
-    }
+    GroupMask groupMask = GroupMask(1u << (group - 1u));
+    _eventMap.RemoveIf([groupMask](Event const& event) { return (event._groupMask & groupMask) != 0; });
 }
 
 Milliseconds EventMap::GetTimeUntilEvent(EventId eventId) const
 {
-    for (auto const& [time, event] : _eventMap)
-        if (eventId == event._id)
-            return std::chrono::duration_cast<Milliseconds>(time - _time);
+    EventStore::Handle handle = _eventMap.FindFirst([eventId](Event const& event) { return event._id == eventId; });
+    if (handle == EventStore::InvalidHandle)
+        return Milliseconds::max();
 
-    return Milliseconds::max();
+    return Milliseconds(_eventMap.GetKey(handle)) - _time;
 }
 
 bool EventMap::HasEventScheduled(EventId eventId) const
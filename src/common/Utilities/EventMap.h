@@ -20,7 +20,7 @@
 
 #include "Define.h"
 #include "Duration.h"
-#include <map>
+#include "TimerWheel.h"
 
 class TC_COMMON_API EventMap
 {
@@ -46,12 +46,12 @@ class TC_COMMON_API EventMap
 
     /**
      * Internal storage type.
-     * Key: Time as TimePoint when the event should occur.
+     * Key: Time in milliseconds when the event should occur.
      */
-    using EventStore = std::multimap<TimePoint, Event>;
+    using EventStore = Trinity::TimerWheel<Event>;
 
 public:
-    EventMap() : _time(TimePoint::min()), _phaseMask(0) { }
+    EventMap() : _time(0), _phaseMask(0) { }
 
     /**
     * @name Reset
@@ -94,7 +94,7 @@ public:
     */
     bool Empty() const
     {
-        return _eventMap.empty();
+        return _eventMap.IsEmpty();
     }
 
     /**
@@ -256,6 +256,17 @@ public:
     bool HasEventScheduled(EventId eventId) const;
 
 private:
+    /**
+    * @name ToKey
+    * @brief Converts a time of the internal timer to its key in the event store.
+    * @param time Time as std::chrono type, times before the start of the timer are clamped to it.
+    * @return Key of the time.
+    */
+    static uint64 ToKey(Milliseconds time)
+    {
+        return uint64(std::max(time.count(), Milliseconds::rep(0)));
+    }
+
     /**
     * @name _time
     * @brief Internal timer.
@@ -266,7 +277,7 @@ private:
     * has reached their time value. Its value is changed in the
     * Update method.
     */
-    TimePoint _time;
+    Milliseconds _time;
 
     /**
     * @name _phaseMask
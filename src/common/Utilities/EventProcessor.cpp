@@ -43,12 +43,11 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    std::multimap<uint64, BasicEvent*>::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    BasicEventQueue::Handle handle;
+    while ((handle = m_events.PeekDue(m_time)) != BasicEventQueue::InvalidHandle)
     {
         // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        BasicEvent* event = m_events.Remove(handle);
 
         if (event->IsRunning())
         {
@@ -81,33 +80,31 @@ void EventProcessor::Update(uint32 p_time)
 
 void EventProcessor::KillAllEvents(bool force)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    for (BasicEventQueue::Handle handle : m_events.Select([](BasicEvent*) { return true; }))
     {
+        BasicEvent* event = m_events[handle];
+
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
-        {
-            ++itr;
+        if (!force && !event->IsDeletable())
             continue;
-        }
 
-        delete itr->second;
+        delete event;
 
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
+        // Clear the whole container at once when forcing
+        if (!force)
+            m_events.Remove(handle);
     }
 
     if (force)
-        m_events.clear();
+        m_events.Clear();
 }
 
 void EventProcessor::AddEvent(BasicEvent* event, Milliseconds e_time, bool set_addtime)
@@ -115,19 +112,14 @@ void EventProcessor::AddEvent(BasicEvent* event, Milliseconds e_time, bool set_a
     if (set_addtime)
         event->m_addTime = m_time;
     event->m_execTime = e_time.count();
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time.count(), event));
+    event->m_queueHandle = m_events.Schedule(e_time.count(), event);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
+    if (!m_events.IsScheduled(event->m_queueHandle) || m_events[event->m_queueHandle] != event)
+        return;
 
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime.count(), event));
-        break;
-    }
+    event->m_execTime = newTime.count();
+    m_events.Reschedule(event->m_queueHandle, newTime.count());
 }
@@ -21,11 +21,14 @@
 #include "Define.h"
 #include "Duration.h"
 #include "Random.h"
-#include <map>
+#include "TimerWheel.h"
 #include <type_traits>
 
+class BasicEvent;
 class EventProcessor;
 
+using BasicEventQueue = Trinity::TimerWheel<BasicEvent*>;
+
 // Note. All times are in milliseconds here.
 
 class TC_COMMON_API BasicEvent
@@ -41,7 +44,7 @@ class TC_COMMON_API BasicEvent
 
     public:
         BasicEvent()
-          : m_abortState(AbortState::STATE_RUNNING), m_addTime(0), m_execTime(0) { }
+          : m_abortState(AbortState::STATE_RUNNING), m_addTime(0), m_execTime(0), m_queueHandle(BasicEventQueue::InvalidHandle) { }
 
         virtual ~BasicEvent() { }                           // override destructor to perform some actions on event removal
 
@@ -68,6 +71,8 @@ class TC_COMMON_API BasicEvent
         // these can be used for time offset control
         uint64 m_addTime;                                   // time when the event was added to queue, filled by event handler
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
+
+        BasicEventQueue::Handle m_queueHandle;              // position in the queue of the event handler
 };
 
 template<typename T>
@@ -113,7 +118,7 @@ class TC_COMMON_API EventProcessor
 
     protected:
         uint64 m_time;
-        std::multimap<uint64, BasicEvent*> m_events;
+        BasicEventQueue m_events;
 };
 
 #endif
@@ -0,0 +1,104 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MappedFile.h"
+
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Trinity::MappedFile::MappedFile() : _data(nullptr), _size(0)
+{
+}
+
+Trinity::MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool Trinity::MappedFile::Open(char const* fileName)
+{
+    Close();
+
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+        return false;
+
+    // the view keeps the mapping object alive
+    void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data)
+        return false;
+
+    _size = std::size_t(size.QuadPart);
+#else
+    int file = open(fileName, O_RDONLY);
+    if (file < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size <= 0)
+    {
+        close(file);
+        return false;
+    }
+
+    // the mapping stays valid after closing the descriptor
+    void* data = mmap(nullptr, std::size_t(info.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+    close(file);
+    if (data == MAP_FAILED)
+        return false;
+
+    _size = std::size_t(info.st_size);
+#endif
+
+    _data = static_cast<unsigned char*>(data);
+    return true;
+}
+
+void Trinity::MappedFile::Close()
+{
+    if (!_data)
+        return;
+
+#if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
+    UnmapViewOfFile(_data);
+#else
+    munmap(_data, _size);
+#endif
+
+    _data = nullptr;
+    _size = 0;
+}
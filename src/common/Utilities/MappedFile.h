@@ -0,0 +1,56 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_MAPPED_FILE_H
+#define TRINITYCORE_MAPPED_FILE_H
+
+#include "Define.h"
+#include <cstddef>
+
+namespace Trinity
+{
+/*
+ * Whole file mapped into memory copy on write.
+ * Until a page is written to it is backed by the file in the page cache, so every process
+ * mapping the same file shares one physical copy of it. Written pages become private copies
+ * and are never written back to the file.
+ */
+class TC_COMMON_API MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    bool Open(char const* fileName);
+    void Close();
+
+    bool IsOpen() const { return _data != nullptr; }
+    unsigned char* GetData() const { return _data; }
+    std::size_t GetSize() const { return _size; }
+
+private:
+    unsigned char* _data;
+    std::size_t _size;
+};
+}
+
+#endif // TRINITYCORE_MAPPED_FILE_H
@@ -90,14 +90,11 @@ void TaskScheduler::Dispatch(success_t const& callback)
             return;
     }
 
-    while (!_task_holder.IsEmpty())
+    while (TaskContainer task = _task_holder.PopDue(_now))
     {
-        if (_task_holder.First()->_end > _now)
-            break;
-
         // Perfect forward the context to the handler
         // Use weak references to catch destruction before callbacks.
-        TaskContext context(_task_holder.Pop(), std::weak_ptr<TaskScheduler>(self_reference));
+        TaskContext context(std::move(task), std::weak_ptr<TaskScheduler>(self_reference));
 
         // Invoke the context
         context.Invoke();
@@ -111,55 +108,49 @@ void TaskScheduler::Dispatch(success_t const& callback)
     callback();
 }
 
-void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
+uint64 TaskScheduler::TaskQueue::GetKey(timepoint_t const& time) const
 {
-    container.insert(task);
+    if (time <= epoch)
+        return 0;
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - epoch).count();
 }
 
-auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
+void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
-    return result;
+    uint64 const key = GetKey(task->_end);
+    container.Schedule(key, std::move(task));
 }
 
-auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
+auto TaskScheduler::TaskQueue::PopDue(timepoint_t const& now) -> TaskContainer
 {
-    return *container.begin();
+    container_t::Handle const handle = container.PeekDue(GetKey(now));
+    if (handle == container_t::InvalidHandle)
+        return nullptr;
+
+    return container.Remove(handle);
 }
 
 void TaskScheduler::TaskQueue::Clear()
 {
-    container.clear();
+    container.Clear();
 }
 
 void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-            itr = container.erase(itr);
-        else
-            ++itr;
+    container.RemoveIf(filter);
 }
 
 void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
-        else
-            ++itr;
-
-    container.insert(cache.begin(), cache.end());
+    // Reinsert the modified tasks in their previous order, behind unmodified tasks ending at the same time
+    for (container_t::Handle const handle : container.Select(filter))
+        container.Reschedule(handle, GetKey(container[handle]->_end));
 }
 
 bool TaskScheduler::TaskQueue::IsEmpty() const
 {
-    return container.empty();
+    return container.IsEmpty();
 }
 
 TaskContext& TaskContext::Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply)
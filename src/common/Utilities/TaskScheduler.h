@@ -21,13 +21,13 @@
 #include "Duration.h"
 #include "Optional.h"
 #include "Random.h"
+#include "TimerWheel.h"
 #include <algorithm>
 #include <functional>
 #include <vector>
 #include <queue>
 #include <memory>
 #include <utility>
-#include <set>
 
 class TaskContext;
 
@@ -116,26 +116,25 @@ class TC_COMMON_API TaskScheduler
     typedef std::shared_ptr<Task> TaskContainer;
 
     /// Container which provides Task order, insert and reschedule operations.
-    struct Compare
-    {
-        bool operator() (TaskContainer const& left, TaskContainer const& right) const
-        {
-            return (*left.get()) < (*right.get());
-        }
-    };
-
     class TC_COMMON_API TaskQueue
     {
-        std::multiset<TaskContainer, Compare> container;
+        /// Keys are nanoseconds since the creation of the queue, one wheel tick spans a millisecond.
+        typedef Trinity::TimerWheel<TaskContainer, 1000000> container_t;
+
+        container_t container;
+        timepoint_t const epoch;
+
+        uint64 GetKey(timepoint_t const& time) const;
 
     public:
+        explicit TaskQueue(timepoint_t const& epoch_) : epoch(epoch_) { }
+
         // Pushes the task in the container
         void Push(TaskContainer&& task);
 
-        /// Pops the task out of the container
-        TaskContainer Pop();
-
-        TaskContainer const& First() const;
+        /// Pops the first task which ends not after the given time point out of the container,
+        /// returns an empty container if there is none.
+        TaskContainer PopDue(timepoint_t const& now);
 
         void Clear();
 
@@ -174,11 +173,11 @@ class TC_COMMON_API TaskScheduler
 
 public:
     TaskScheduler()
-        : self_reference(this, [](TaskScheduler const*) { }), _now(clock_t::now()), _predicate(EmptyValidator) { }
+        : self_reference(this, [](TaskScheduler const*) { }), _now(clock_t::now()), _task_holder(_now), _predicate(EmptyValidator) { }
 
     template<typename P>
     TaskScheduler(P&& predicate)
-        : self_reference(this, [](TaskScheduler const*) { }), _now(clock_t::now()), _predicate(std::forward<P>(predicate)) { }
+        : self_reference(this, [](TaskScheduler const*) { }), _now(clock_t::now()), _task_holder(_now), _predicate(std::forward<P>(predicate)) { }
 
     TaskScheduler(TaskScheduler const&) = delete;
     TaskScheduler(TaskScheduler&&) = delete;
@@ -0,0 +1,429 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_TIMER_WHEEL_H
+#define TRINITYCORE_TIMER_WHEEL_H
+
+#include "Define.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Trinity
+{
+/*
+ * Hierarchical timing wheel holding values ordered by a 64 bit key (usually a time).
+ * Entries with equal keys expire in the order they were scheduled, exactly like a std::multimap.
+ *
+ * Entries live in a pooled node vector and are addressed by handles, so scheduling and
+ * cancelling do not allocate once the pool is warm and do not search.
+ * Every KeysPerTick consecutive keys share one wheel tick; 4 levels of 64 slots cover
+ * 2^24 ticks ahead, later entries wait in an overflow list until the wheel gets there.
+ * Expired entries are moved into a ready queue a whole slot at a time.
+ * Only occupied slots store a list head, so an owner with a few timers pays for a few
+ * heads instead of the whole slot table, and an emptied wheel gives its memory back.
+ * Handles stay valid when the wheel is copied.
+ */
+template<typename T, uint64 KeysPerTick = 1>
+class TimerWheel
+{
+public:
+    using Handle = uint32;
+    static constexpr Handle InvalidHandle = std::numeric_limits<Handle>::max();
+
+private:
+    static constexpr uint32 SlotBits = 6;
+    static constexpr uint32 SlotsPerLevel = 1u << SlotBits;
+    static constexpr uint32 Levels = 4;
+    static constexpr uint16 OverflowList = Levels * SlotsPerLevel;
+    static constexpr uint16 ReadyList = OverflowList + 1;
+    static constexpr uint16 FreeList = OverflowList + 2;
+    // buffers up to this capacity survive the wheel running empty, larger ones are released
+    static constexpr std::size_t RetainedCapacity = 8;
+
+    struct Node
+    {
+        uint64 Key = 0;
+        uint64 Sequence = 0;
+        Handle Prev = InvalidHandle;
+        Handle Next = InvalidHandle;
+        uint16 List = FreeList;
+        T Value = {};
+    };
+
+public:
+    TimerWheel() : _now(0), _nextSequence(0), _size(0), _freeHead(InvalidHandle), _overflowHead(InvalidHandle), _readyBegin(0), _occupied() { }
+
+    Handle Schedule(uint64 key, T value)
+    {
+        Handle handle;
+        if (_freeHead != InvalidHandle)
+        {
+            handle = _freeHead;
+            _freeHead = _nodes[handle].Next;
+        }
+        else
+        {
+            handle = Handle(_nodes.size());
+            _nodes.emplace_back();
+        }
+
+        Node& node = _nodes[handle];
+        node.Key = key;
+        node.Value = std::move(value);
+        ++_size;
+        Link(handle);
+        return handle;
+    }
+
+    // Same as removing and scheduling again: the entry moves behind all entries with an equal key
+    void Reschedule(Handle handle, uint64 key)
+    {
+        Unlink(handle);
+        _nodes[handle].Key = key;
+        Link(handle);
+    }
+
+    T Remove(Handle handle)
+    {
+        Unlink(handle);
+
+        Node& node = _nodes[handle];
+        T value = std::exchange(node.Value, T());
+        node.List = FreeList;
+        node.Next = _freeHead;
+        _freeHead = handle;
+        if (!--_size)
+            Release();
+
+        return value;
+    }
+
+    bool IsScheduled(Handle handle) const { return handle < _nodes.size() && _nodes[handle].List != FreeList; }
+    T& operator[](Handle handle) { return _nodes[handle].Value; }
+    T const& operator[](Handle handle) const { return _nodes[handle].Value; }
+    uint64 GetKey(Handle handle) const { return _nodes[handle].Key; }
+
+    // Returns the first entry with a key not after now, InvalidHandle if there is none
+    Handle PeekDue(uint64 now)
+    {
+        AdvanceTo(now / KeysPerTick);
+        if (_readyBegin < _ready.size() && _nodes[_ready[_readyBegin]].Key <= now)
+            return _ready[_readyBegin];
+
+        return InvalidHandle;
+    }
+
+    // Number of entries with a key not after now
+    std::size_t CountDue(uint64 now)
+    {
+        AdvanceTo(now / KeysPerTick);
+        return std::count_if(_ready.begin() + _readyBegin, _ready.end(), [&](Handle handle) { return _nodes[handle].Key <= now; });
+    }
+
+    // Removes up to limit entries with a key not after now (no limit if 0) in expiry order, returns how many were taken
+    std::size_t TakeDue(uint64 now, std::size_t limit, std::vector<T>& taken)
+    {
+        std::size_t count = 0;
+        for (Handle handle; (!limit || count < limit) && (handle = PeekDue(now)) != InvalidHandle; ++count)
+            taken.push_back(Remove(handle));
+
+        return count;
+    }
+
+    // All entries matching predicate, in expiry order
+    template<typename Predicate>
+    std::vector<Handle> Select(Predicate&& predicate) const
+    {
+        std::vector<Handle> handles;
+        for (Handle handle = 0; handle < _nodes.size(); ++handle)
+            if (_nodes[handle].List != FreeList && predicate(_nodes[handle].Value))
+                handles.push_back(handle);
+
+        std::sort(handles.begin(), handles.end(), [this](Handle left, Handle right) { return Earlier(left, right); });
+        return handles;
+    }
+
+    // First entry matching predicate in expiry order, InvalidHandle if there is none
+    template<typename Predicate>
+    Handle FindFirst(Predicate&& predicate) const
+    {
+        Handle first = InvalidHandle;
+        for (Handle handle = 0; handle < _nodes.size(); ++handle)
+            if (_nodes[handle].List != FreeList && predicate(_nodes[handle].Value) && (first == InvalidHandle || Earlier(handle, first)))
+                first = handle;
+
+        return first;
+    }
+
+    template<typename Predicate>
+    void RemoveIf(Predicate&& predicate)
+    {
+        for (Handle handle = 0; handle < _nodes.size(); ++handle)
+            if (_nodes[handle].List != FreeList && predicate(_nodes[handle].Value))
+                Remove(handle);
+    }
+
+    // Drops all entries, the node pool keeps its capacity
+    void Clear()
+    {
+        _nodes.clear();
+        _ready.clear();
+        _readyBegin = 0;
+        _lists.clear();
+        _overflowHead = InvalidHandle;
+        _occupied.fill(0);
+        _freeHead = InvalidHandle;
+        _size = 0;
+    }
+
+    // Drops all entries and rewinds the wheel to key 0
+    void Reset()
+    {
+        Clear();
+        _now = 0;
+    }
+
+    std::size_t Size() const { return _size; }
+    bool IsEmpty() const { return _size == 0; }
+
+private:
+    bool Earlier(Handle left, Handle right) const
+    {
+        Node const& l = _nodes[left];
+        Node const& r = _nodes[right];
+        return l.Key < r.Key || (l.Key == r.Key && l.Sequence < r.Sequence);
+    }
+
+    template<typename Buffer>
+    static void ReleaseBuffer(Buffer& buffer)
+    {
+        if (buffer.capacity() > RetainedCapacity)
+            Buffer().swap(buffer);
+        else
+            buffer.clear();
+    }
+
+    // Called when the last entry is removed, owners that once held many timers give the memory back
+    void Release()
+    {
+        ReleaseBuffer(_nodes);
+        ReleaseBuffer(_lists);
+        ReleaseBuffer(_ready);
+        _readyBegin = 0;
+        _overflowHead = InvalidHandle;
+        _freeHead = InvalidHandle;
+    }
+
+    // Position of the head of an occupied slot in _lists, heads are ordered by list
+    std::size_t HeadIndex(uint16 list) const
+    {
+        uint32 level = list / SlotsPerLevel;
+        std::size_t index = std::popcount(_occupied[level] & ((uint64(1) << (list % SlotsPerLevel)) - 1));
+        for (uint32 lower = 0; lower < level; ++lower)
+            index += std::popcount(_occupied[lower]);
+
+        return index;
+    }
+
+    bool IsOccupied(uint16 list) const { return (_occupied[list / SlotsPerLevel] >> (list % SlotsPerLevel)) & 1; }
+
+    // Detaches the whole list of a slot and returns its first entry
+    Handle TakeList(uint16 list)
+    {
+        if (list == OverflowList)
+            return std::exchange(_overflowHead, InvalidHandle);
+
+        std::size_t index = HeadIndex(list);
+        Handle head = _lists[index];
+        _lists.erase(_lists.begin() + index);
+        _occupied[list / SlotsPerLevel] &= ~(uint64(1) << (list % SlotsPerLevel));
+        return head;
+    }
+
+    void Link(Handle handle)
+    {
+        Node& node = _nodes[handle];
+        node.Sequence = _nextSequence++;
+
+        uint64 tick = node.Key / KeysPerTick;
+        if (tick <= _now)
+        {
+            node.List = ReadyList;
+            _ready.insert(std::upper_bound(_ready.begin() + _readyBegin, _ready.end(), handle,
+                [this](Handle left, Handle right) { return Earlier(left, right); }), handle);
+            return;
+        }
+
+        PushToList(handle, ListFor(tick));
+    }
+
+    void Unlink(Handle handle)
+    {
+        Node& node = _nodes[handle];
+        if (node.List == ReadyList)
+        {
+            if (_ready[_readyBegin] == handle)
+                ++_readyBegin;
+            else
+                _ready.erase(std::find(_ready.begin() + _readyBegin, _ready.end(), handle));
+
+            if (_readyBegin == _ready.size())
+            {
+                _ready.clear();
+                _readyBegin = 0;
+            }
+            else if (_readyBegin >= SlotsPerLevel && _readyBegin * 2 >= _ready.size())
+            {
+                _ready.erase(_ready.begin(), _ready.begin() + _readyBegin);
+                _readyBegin = 0;
+            }
+            return;
+        }
+
+        if (node.Next != InvalidHandle)
+            _nodes[node.Next].Prev = node.Prev;
+
+        if (node.Prev != InvalidHandle)
+            _nodes[node.Prev].Next = node.Next;
+        else if (node.List == OverflowList)
+            _overflowHead = node.Next;
+        else if (node.Next != InvalidHandle)
+            _lists[HeadIndex(node.List)] = node.Next;
+        else
+            TakeList(node.List);
+    }
+
+    // Level is picked by the highest tick bit that differs from the current tick
+    uint16 ListFor(uint64 tick) const
+    {
+        uint32 level = (std::bit_width(tick ^ _now) - 1) / SlotBits;
+        if (level >= Levels)
+            return OverflowList;
+
+        return uint16(level * SlotsPerLevel + ((tick >> (level * SlotBits)) & (SlotsPerLevel - 1)));
+    }
+
+    void PushToList(Handle handle, uint16 list)
+    {
+        Node& node = _nodes[handle];
+        node.List = list;
+        node.Prev = InvalidHandle;
+
+        Handle* head;
+        if (list == OverflowList)
+            head = &_overflowHead;
+        else if (IsOccupied(list))
+            head = &_lists[HeadIndex(list)];
+        else
+        {
+            head = &*_lists.insert(_lists.begin() + HeadIndex(list), InvalidHandle);
+            _occupied[list / SlotsPerLevel] |= uint64(1) << (list % SlotsPerLevel);
+        }
+
+        node.Next = *head;
+        if (node.Next != InvalidHandle)
+            _nodes[node.Next].Prev = handle;
+
+        *head = handle;
+    }
+
+    // Lists only hold ticks after _now, so the lowest occupied slot of the lowest occupied level comes first
+    bool NextCascade(uint64& tick, uint16& list) const
+    {
+        for (uint32 level = 0; level < Levels; ++level)
+        {
+            if (!_occupied[level])
+                continue;
+
+            uint32 slot = std::countr_zero(_occupied[level]);
+            uint32 shift = level * SlotBits;
+            uint64 blockMask = (uint64(1) << (shift + SlotBits)) - 1;
+            tick = (_now & ~blockMask) | (uint64(slot) << shift);
+            list = uint16(level * SlotsPerLevel + slot);
+            return true;
+        }
+
+        if (_overflowHead != InvalidHandle)
+        {
+            // jump straight to the block of the earliest entry instead of walking empty blocks, keys may start far from 0
+            uint64 earliest = std::numeric_limits<uint64>::max();
+            for (Handle handle = _overflowHead; handle != InvalidHandle; handle = _nodes[handle].Next)
+                earliest = std::min(earliest, _nodes[handle].Key / KeysPerTick);
+
+            uint32 shift = Levels * SlotBits;
+            tick = std::max(((_now >> shift) + 1) << shift, (earliest >> shift) << shift);
+            list = OverflowList;
+            return true;
+        }
+
+        return false;
+    }
+
+    void AdvanceTo(uint64 tick)
+    {
+        if (tick <= _now)
+            return;
+
+        std::size_t batchBegin = _ready.size();
+        uint64 cascadeTick;
+        uint16 list;
+        while (NextCascade(cascadeTick, list) && cascadeTick <= tick)
+        {
+            _now = cascadeTick;
+
+            Handle handle = TakeList(list);
+
+            while (handle != InvalidHandle)
+            {
+                Handle next = _nodes[handle].Next;
+                uint64 entryTick = _nodes[handle].Key / KeysPerTick;
+                if (entryTick <= _now)
+                {
+                    _nodes[handle].List = ReadyList;
+                    _ready.push_back(handle);
+                }
+                else
+                    PushToList(handle, ListFor(entryTick));
+
+                handle = next;
+            }
+        }
+
+        _now = tick;
+
+        // everything already queued expired on an earlier tick, only the new batch needs ordering
+        std::sort(_ready.begin() + batchBegin, _ready.end(), [this](Handle left, Handle right) { return Earlier(left, right); });
+    }
+
+    std::vector<Node> _nodes;
+    std::vector<Handle> _lists;                             // heads of occupied slots only
+    std::vector<Handle> _ready;
+    uint64 _now;
+    uint64 _nextSequence;
+    std::size_t _size;
+    Handle _freeHead;
+    Handle _overflowHead;
+    std::size_t _readyBegin;
+    std::array<uint64, Levels> _occupied;
+};
+}
+
+#endif // TRINITYCORE_TIMER_WHEEL_H
@@ -52,6 +52,11 @@ public:
     explicit unique_trackable_ptr(pointer ptr, Deleter deleter)
         : _ptr(ptr, std::move(deleter)) { }
 
+    // allocator is used for the control block
+    template <typename Deleter, typename Allocator, std::enable_if_t<std::conjunction_v<std::is_move_constructible<Deleter>, std::is_invocable<Deleter&, T*&>>, int> = 0>
+    explicit unique_trackable_ptr(pointer ptr, Deleter deleter, Allocator allocator)
+        : _ptr(ptr, std::move(deleter), std::move(allocator)) { }
+
     unique_trackable_ptr(unique_trackable_ptr const&) = delete;
 
     unique_trackable_ptr(unique_trackable_ptr&& other) noexcept
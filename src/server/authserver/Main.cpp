@@ -192,6 +192,12 @@ int main(int argc, char** argv)
 
     std::shared_ptr<void> sRealmListHandle(nullptr, [](void*) { sRealmList->Close(); });
 
+    // Start the pool verifying logins away from the network threads
+    AuthSession::StartLoginPipeline(sConfigMgr->GetIntDefault("LoginCrypto.Threads", 2), sConfigMgr->GetIntDefault("LoginCrypto.MaxQueuedTasks", 1000),
+        sConfigMgr->GetIntDefault("RealmsStateUpdateDelay", 20) > 0);
+
+    std::shared_ptr<void> loginPipelineHandle(nullptr, [](void*) { AuthSession::StopLoginPipeline(); });
+
     // Start the listening port (acceptor) for auth connections
     int32 port = sConfigMgr->GetIntDefault("RealmServerPort", 3724);
     if (port < 0 || port > 0xFFFF)
@@ -18,6 +18,7 @@
 #include "AuthSession.h"
 #include "AES.h"
 #include "AuthCodes.h"
+#include "BoundedThreadPool.h"
 #include "ByteBuffer.h"
 #include "ClientBuildInfo.h"
 #include "Config.h"
@@ -32,6 +33,7 @@
 #include "TOTP.h"
 #include "Util.h"
 #include <boost/lexical_cast.hpp>
+#include <mutex>
 
 using boost::asio::ip::tcp;
 
@@ -135,6 +137,93 @@ std::unordered_map<uint8, AuthHandler> AuthSession::InitHandlers()
 
 std::unordered_map<uint8, AuthHandler> const Handlers = AuthSession::InitHandlers();
 
+namespace
+{
+std::unique_ptr<Trinity::BoundedThreadPool> CryptoPool;
+
+// Per account character counts, reused by realm list requests until the realm list is reloaded
+class RealmCharacterCountCache
+{
+public:
+    void SetEnabled(bool enabled) { _enabled = enabled; }
+
+    bool Get(uint32 accountId, std::map<uint32, uint8>& characterCounts)
+    {
+        if (!_enabled)
+            return false;
+
+        std::lock_guard<std::mutex> lock(_lock);
+        Invalidate();
+
+        auto itr = _counts.find(accountId);
+        if (itr == _counts.end())
+            return false;
+
+        characterCounts = itr->second;
+        return true;
+    }
+
+    void Store(uint32 accountId, std::map<uint32, uint8> const& characterCounts)
+    {
+        if (!_enabled)
+            return;
+
+        std::lock_guard<std::mutex> lock(_lock);
+        Invalidate();
+
+        _counts[accountId] = characterCounts;
+    }
+
+private:
+    void Invalidate()
+    {
+        uint32 updateCounter = sRealmList->GetUpdateCounter();
+        if (updateCounter == _updateCounter)
+            return;
+
+        _counts.clear();
+        _updateCounter = updateCounter;
+    }
+
+    bool _enabled = false;
+    std::mutex _lock;
+    uint32 _updateCounter = 0;
+    std::unordered_map<uint32, std::map<uint32, uint8>> _counts;
+} RealmCharacterCounts;
+}
+
+void AuthSession::StartLoginPipeline(std::size_t cryptoThreads, std::size_t maxQueuedTasks, bool cacheRealmListCharacterCounts)
+{
+    CryptoPool = std::make_unique<Trinity::BoundedThreadPool>(std::max<std::size_t>(cryptoThreads, 1), std::max<std::size_t>(maxQueuedTasks, 1));
+    RealmCharacterCounts.SetEnabled(cacheRealmListCharacterCounts);
+}
+
+void AuthSession::StopLoginPipeline()
+{
+    if (!CryptoPool)
+        return;
+
+    CryptoPool->Join();
+    CryptoPool.reset();
+}
+
+template<typename Work, typename Callback>
+bool AuthSession::QueueCryptoWork(Work&& work, Callback&& callback)
+{
+    if (!CryptoPool)
+    {
+        callback(work());
+        return true;
+    }
+
+    auto future = CryptoPool->TryPostWork(std::forward<Work>(work));
+    if (!future)
+        return false;
+
+    _cryptoProcessor.AddCallback(AuthCryptoCallback(std::move(*future), std::forward<Callback>(callback)));
+    return true;
+}
+
 void AccountInfo::LoadResult(Field* fields)
 {
     //          0           1         2               3          4                5                                                             6
@@ -179,6 +268,7 @@ bool AuthSession::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _cryptoProcessor.ProcessReadyCallbacks();
 
     return true;
 }
@@ -399,51 +489,73 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
         }
     }
 
-    _srp6.emplace(
-        _accountInfo.Login,
-        fields[10].GetBinary<Trinity::Crypto::SRP6::SALT_LENGTH>(),
-        fields[11].GetBinary<Trinity::Crypto::SRP6::VERIFIER_LENGTH>()
-    );
+    if (!AuthHelper::IsAcceptedClientBuild(_build))
+    {
+        pkt << uint8(WOW_FAIL_VERSION_INVALID);
+        SendPacket(pkt);
+        return;
+    }
 
-    // Fill the response packet with the result
-    if (AuthHelper::IsAcceptedClientBuild(_build))
+    // Computing B is a modular exponentiation, keep it away from the network thread
+    bool queued = QueueCryptoWork([login = _accountInfo.Login,
+        salt = fields[10].GetBinary<Trinity::Crypto::SRP6::SALT_LENGTH>(),
+        verifier = fields[11].GetBinary<Trinity::Crypto::SRP6::VERIFIER_LENGTH>()]()
     {
-        pkt << uint8(WOW_SUCCESS);
+        return std::make_shared<Trinity::Crypto::SRP6>(login, salt, verifier);
+    }, [this, securityFlags](std::shared_ptr<Trinity::Crypto::SRP6> const& srp6)
+    {
+        _srp6 = srp6;
+        SendLogonChallengeResponse(securityFlags);
+    });
 
-        pkt.append(_srp6->B);
-        pkt << uint8(1);
-        pkt.append(_srp6->g);
-        pkt << uint8(32);
-        pkt.append(_srp6->N);
-        pkt.append(_srp6->s);
-        pkt.append(VersionChallenge.data(), VersionChallenge.size());
-        pkt << uint8(securityFlags);            // security flags (0x0...0x04)
-
-        if (securityFlags & 0x01)               // PIN input
-        {
-            pkt << uint32(0);
-            pkt << uint64(0) << uint64(0);      // 16 bytes hash?
-        }
+    if (!queued)
+    {
+        TC_LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] Login crypto queue is full, rejecting account {}", ipAddress, port, _accountInfo.Login);
+        pkt << uint8(WOW_FAIL_DB_BUSY);
+        SendPacket(pkt);
+    }
+}
 
-        if (securityFlags & 0x02)               // Matrix input
-        {
-            pkt << uint8(0);
-            pkt << uint8(0);
-            pkt << uint8(0);
-            pkt << uint8(0);
-            pkt << uint64(0);
-        }
+void AuthSession::SendLogonChallengeResponse(uint8 securityFlags)
+{
+    ByteBuffer pkt;
+    pkt << uint8(AUTH_LOGON_CHALLENGE);
+    pkt << uint8(0x00);
 
-        if (securityFlags & 0x04)               // Security token input
-            pkt << uint8(1);
+    // Fill the response packet with the result
+    pkt << uint8(WOW_SUCCESS);
 
-        TC_LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] account {} is using '{}' locale ({})",
-            ipAddress, port, _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
+    pkt.append(_srp6->B);
+    pkt << uint8(1);
+    pkt.append(_srp6->g);
+    pkt << uint8(32);
+    pkt.append(_srp6->N);
+    pkt.append(_srp6->s);
+    pkt.append(VersionChallenge.data(), VersionChallenge.size());
+    pkt << uint8(securityFlags);            // security flags (0x0...0x04)
 
-        _status = STATUS_LOGON_PROOF;
+    if (securityFlags & 0x01)               // PIN input
+    {
+        pkt << uint32(0);
+        pkt << uint64(0) << uint64(0);      // 16 bytes hash?
     }
-    else
-        pkt << uint8(WOW_FAIL_VERSION_INVALID);
+
+    if (securityFlags & 0x02)               // Matrix input
+    {
+        pkt << uint8(0);
+        pkt << uint8(0);
+        pkt << uint8(0);
+        pkt << uint8(0);
+        pkt << uint64(0);
+    }
+
+    if (securityFlags & 0x04)               // Security token input
+        pkt << uint8(1);
+
+    TC_LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] account {} is using '{}' locale ({})",
+        GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
+
+    _status = STATUS_LOGON_PROOF;
 
     SendPacket(pkt);
 }
@@ -465,25 +577,52 @@ bool AuthSession::HandleLogonProof()
         return false;
     }
 
-    // Check if SRP6 results match (password is correct), else send an error
-    if (std::optional<SessionKey> K = _srp6->VerifyChallengeResponse(logonProof->A, logonProof->clientM))
+    // Check auth token, it trails the fixed size part of the packet so it has to be consumed right away
+    bool tokenSuccess = false;
+    bool sentToken = (logonProof->securityFlags & 0x04);
+    if (sentToken && _totpSecret)
     {
-        _sessionKey = *K;
-        // Check auth token
-        bool tokenSuccess = false;
-        bool sentToken = (logonProof->securityFlags & 0x04);
-        if (sentToken && _totpSecret)
-        {
-            uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
-            std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
-            GetReadBuffer().ReadCompleted(sizeof(size) + size);
+        uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
+        std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
+        GetReadBuffer().ReadCompleted(sizeof(size) + size);
 
-            uint32 incomingToken = atoi(token.c_str());
-            tokenSuccess = Trinity::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
-            memset(_totpSecret->data(), 0, _totpSecret->size());
-        }
-        else if (!sentToken && !_totpSecret)
-            tokenSuccess = true;
+        uint32 incomingToken = atoi(token.c_str());
+        tokenSuccess = Trinity::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
+        memset(_totpSecret->data(), 0, _totpSecret->size());
+    }
+    else if (!sentToken && !_totpSecret)
+        tokenSuccess = true;
+
+    // Check if SRP6 results match (password is correct) on the crypto pool, the answer is sent from LogonProofCallback
+    bool queued = QueueCryptoWork([srp6 = _srp6, A = logonProof->A, clientM = logonProof->clientM]()
+    {
+        return srp6->VerifyChallengeResponse(A, clientM);
+    }, [this, A = logonProof->A, clientM = logonProof->clientM, versionProof = logonProof->crc_hash, tokenSuccess](Optional<SessionKey> const& K)
+    {
+        LogonProofCallback(K, A, clientM, versionProof, tokenSuccess);
+    });
+
+    if (!queued)
+    {
+        TC_LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] Login crypto queue is full, rejecting account {}", GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login);
+        ByteBuffer packet;
+        packet << uint8(AUTH_LOGON_PROOF);
+        packet << uint8(WOW_FAIL_DB_BUSY);
+        packet << uint16(0);    // LoginFlags, 1 has account message
+        SendPacket(packet);
+    }
+
+    return true;
+}
+
+void AuthSession::LogonProofCallback(Optional<SessionKey> const& sessionKey, Trinity::Crypto::SRP6::EphemeralKey const& A, Trinity::Crypto::SHA1::Digest const& clientM,
+    Trinity::Crypto::SHA1::Digest const& versionProof, bool tokenSuccess)
+{
+    _srp6.reset();
+
+    if (sessionKey)
+    {
+        _sessionKey = *sessionKey;
 
         if (!tokenSuccess)
         {
@@ -492,16 +631,16 @@ bool AuthSession::HandleLogonProof()
             packet << uint8(WOW_FAIL_UNKNOWN_ACCOUNT);
             packet << uint16(0);    // LoginFlags, 1 has account message
             SendPacket(packet);
-            return true;
+            return;
         }
 
-        if (!VerifyVersion(logonProof->A.data(), logonProof->A.size(), logonProof->crc_hash, false))
+        if (!VerifyVersion(A.data(), A.size(), versionProof, false))
         {
             ByteBuffer packet;
             packet << uint8(AUTH_LOGON_PROOF);
             packet << uint8(WOW_FAIL_VERSION_INVALID);
             SendPacket(packet);
-            return true;
+            return;
         }
 
         TC_LOG_DEBUG("server.authserver", "'{}:{}' User '{}' successfully authenticated", GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login);
@@ -520,7 +659,7 @@ bool AuthSession::HandleLogonProof()
         LoginDatabase.DirectExecute(stmt);
 
         // Finish SRP6 and send the final result to the client
-        Trinity::Crypto::SHA1::Digest M2 = Trinity::Crypto::SRP6::GetSessionVerifier(logonProof->A, logonProof->clientM, _sessionKey);
+        Trinity::Crypto::SHA1::Digest M2 = Trinity::Crypto::SRP6::GetSessionVerifier(A, clientM, _sessionKey);
 
         ByteBuffer packet;
         if (_expversion & POST_BC_EXP_FLAG)                 // 2.x and 3.x clients
@@ -610,8 +749,6 @@ bool AuthSession::HandleLogonProof()
             }
         }
     }
-
-    return true;
 }
 
 bool AuthSession::HandleReconnectChallenge()
@@ -725,6 +862,13 @@ bool AuthSession::HandleRealmList()
 {
     TC_LOG_DEBUG("server.authserver", "Entering _HandleRealmList");
 
+    std::map<uint32, uint8> characterCounts;
+    if (RealmCharacterCounts.Get(_accountInfo.Id, characterCounts))
+    {
+        SendRealmList(characterCounts);
+        return true;
+    }
+
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_REALM_CHARACTER_COUNTS);
     stmt->setUInt32(0, _accountInfo.Id);
 
@@ -745,6 +889,12 @@ void AuthSession::RealmListCallback(PreparedQueryResult result)
         } while (result->NextRow());
     }
 
+    RealmCharacterCounts.Store(_accountInfo.Id, characterCounts);
+    SendRealmList(characterCounts);
+}
+
+void AuthSession::SendRealmList(std::map<uint32, uint8> const& characterCounts)
+{
     // Circle through realms in the RealmList and construct the return packet (including # of user characters in each realm)
     ByteBuffer pkt;
 
@@ -786,7 +936,8 @@ void AuthSession::RealmListCallback(PreparedQueryResult result)
         pkt << name;
         pkt << boost::lexical_cast<std::string>(realm.GetAddressForClient(GetRemoteIpAddress()));
         pkt << float(realm.PopulationLevel);
-        pkt << uint8(characterCounts[realm.Id.Realm]);
+        auto characterCount = characterCounts.find(realm.Id.Realm);
+        pkt << uint8(characterCount != characterCounts.end() ? characterCount->second : 0);
         pkt << uint8(realm.Timezone);                       // realm category
         if (_expversion & POST_BC_EXP_FLAG)                 // 2.x and 3.x clients
             pkt << uint8(realm.Id.Realm);
@@ -27,6 +27,9 @@
 #include "Socket.h"
 #include "SRP6.h"
 #include <boost/asio/ip/tcp.hpp>
+#include <functional>
+#include <future>
+#include <map>
 
 using boost::asio::ip::tcp;
 
@@ -58,6 +61,30 @@ struct AccountInfo
     AccountTypes SecurityLevel = SEC_PLAYER;
 };
 
+// Continuation of a job queued on the login crypto pool, polled from AuthSession::Update
+class AuthCryptoCallback
+{
+public:
+    template<typename Result, typename Callback>
+    AuthCryptoCallback(std::future<Result>&& future, Callback&& callback)
+        : _invoker([future = future.share(), callback = std::forward<Callback>(callback)]() mutable
+        {
+            if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return false;
+
+            callback(future.get());
+            return true;
+        }) { }
+
+    AuthCryptoCallback(AuthCryptoCallback&&) = default;
+    AuthCryptoCallback& operator=(AuthCryptoCallback&&) = default;
+
+    bool InvokeIfReady() { return _invoker(); }
+
+private:
+    std::function<bool()> _invoker;
+};
+
 class AuthSession : public Socket<AuthSession>
 {
     typedef Socket<AuthSession> AuthSocket;
@@ -65,6 +92,10 @@ class AuthSession : public Socket<AuthSession>
 public:
     static std::unordered_map<uint8, AuthHandler> InitHandlers();
 
+    /// Starts the pool running SRP6 math for all sessions; logins are answered with WOW_FAIL_DB_BUSY while more than maxQueuedTasks are waiting
+    static void StartLoginPipeline(std::size_t cryptoThreads, std::size_t maxQueuedTasks, bool cacheRealmListCharacterCounts);
+    static void StopLoginPipeline();
+
     AuthSession(tcp::socket&& socket);
 
     void Start() override;
@@ -87,9 +118,17 @@ private:
     void ReconnectChallengeCallback(PreparedQueryResult result);
     void RealmListCallback(PreparedQueryResult result);
 
+    void SendLogonChallengeResponse(uint8 securityFlags);
+    void LogonProofCallback(Optional<SessionKey> const& sessionKey, Trinity::Crypto::SRP6::EphemeralKey const& A, Trinity::Crypto::SHA1::Digest const& clientM,
+        Trinity::Crypto::SHA1::Digest const& versionProof, bool tokenSuccess);
+    void SendRealmList(std::map<uint32, uint8> const& characterCounts);
+
+    template<typename Work, typename Callback>
+    bool QueueCryptoWork(Work&& work, Callback&& callback);
+
     bool VerifyVersion(uint8 const* a, int32 aLength, Trinity::Crypto::SHA1::Digest const& versionProof, bool isReconnect);
 
-    Optional<Trinity::Crypto::SRP6> _srp6;
+    std::shared_ptr<Trinity::Crypto::SRP6> _srp6;
     SessionKey _sessionKey = {};
     std::array<uint8, 16> _reconnectProof = {};
 
@@ -104,6 +143,7 @@ private:
     uint8 _expversion;
 
     QueryCallbackProcessor _queryProcessor;
+    AsyncCallbackProcessor<AuthCryptoCallback> _cryptoProcessor;
 };
 
 #pragma pack(push, 1)
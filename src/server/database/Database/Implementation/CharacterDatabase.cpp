@@ -28,6 +28,7 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     PrepareStatement(CHAR_DEL_NONEXISTENT_GUILD_BANK_ITEM, "DELETE FROM guild_bank_item WHERE guildid = ? AND TabId = ? AND SlotId = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_DEL_EXPIRED_BANS, "UPDATE character_banned SET active = 0 WHERE unbandate <= UNIX_TIMESTAMP() AND unbandate <> bandate", CONNECTION_ASYNC);
     PrepareStatement(CHAR_SEL_CHECK_NAME, "SELECT 1 FROM characters WHERE name = ?", CONNECTION_BOTH);
+    PrepareStatement(CHAR_SEL_GUID_BY_NAME, "SELECT guid FROM characters WHERE name = ?", CONNECTION_BOTH);
     PrepareStatement(CHAR_SEL_CHECK_GUID, "SELECT 1 FROM characters WHERE guid = ?", CONNECTION_SYNCH);
     PrepareStatement(CHAR_SEL_SUM_CHARS, "SELECT COUNT(guid) FROM characters WHERE account = ? AND deleteDate IS NULL", CONNECTION_BOTH);
     PrepareStatement(CHAR_SEL_CHAR_CREATE_INFO, "SELECT level, race, class FROM characters WHERE account = ? LIMIT 0, ?", CONNECTION_ASYNC);
@@ -60,6 +61,17 @@ void CharacterDatabaseConnection::DoPrepareStatements()
     PrepareStatement(CHAR_SEL_FREE_NAME, "SELECT guid, name, at_login FROM characters WHERE guid = ? AND account = ? AND NOT EXISTS (SELECT NULL FROM characters WHERE name = ?)", CONNECTION_ASYNC);
     PrepareStatement(CHAR_SEL_CHAR_ZONE, "SELECT zone FROM characters WHERE guid = ?", CONNECTION_SYNCH);
     PrepareStatement(CHAR_SEL_CHARACTER_NAME_DATA, "SELECT race, class, gender, level, name FROM characters WHERE guid = ?", CONNECTION_SYNCH);
+    PrepareStatement(CHAR_SEL_CHARACTER_CACHE_RECENT, "SELECT guid, name, account, race, gender, class, level FROM characters ORDER BY logout_time DESC LIMIT ?", CONNECTION_SYNCH);
+    PrepareStatement(CHAR_SEL_CHARACTER_CACHE_BY_GUID, "SELECT c.guid, c.name, c.account, c.race, c.gender, c.class, c.level, IFNULL(gm.guildid, 0), "
+                     "IFNULL((SELECT atm.arenaTeamId FROM arena_team_member AS atm JOIN arena_team AS at ON atm.arenaTeamId = at.arenaTeamId WHERE atm.guid = c.guid AND at.type = 2), 0), "
+                     "IFNULL((SELECT atm.arenaTeamId FROM arena_team_member AS atm JOIN arena_team AS at ON atm.arenaTeamId = at.arenaTeamId WHERE atm.guid = c.guid AND at.type = 3), 0), "
+                     "IFNULL((SELECT atm.arenaTeamId FROM arena_team_member AS atm JOIN arena_team AS at ON atm.arenaTeamId = at.arenaTeamId WHERE atm.guid = c.guid AND at.type = 5), 0) "
+                     "FROM characters AS c LEFT JOIN guild_member AS gm ON c.guid = gm.guid WHERE c.guid = ?", CONNECTION_ASYNC);
+    PrepareStatement(CHAR_SEL_CHARACTER_CACHE_BY_NAME, "SELECT c.guid, c.name, c.account, c.race, c.gender, c.class, c.level, IFNULL(gm.guildid, 0), "
+                     "IFNULL((SELECT atm.arenaTeamId FROM arena_team_member AS atm JOIN arena_team AS at ON atm.arenaTeamId = at.arenaTeamId WHERE atm.guid = c.guid AND at.type = 2), 0), "
+                     "IFNULL((SELECT atm.arenaTeamId FROM arena_team_member AS atm JOIN arena_team AS at ON atm.arenaTeamId = at.arenaTeamId WHERE atm.guid = c.guid AND at.type = 3), 0), "
+                     "IFNULL((SELECT atm.arenaTeamId FROM arena_team_member AS atm JOIN arena_team AS at ON atm.arenaTeamId = at.arenaTeamId WHERE atm.guid = c.guid AND at.type = 5), 0) "
+                     "FROM characters AS c LEFT JOIN guild_member AS gm ON c.guid = gm.guid WHERE c.name = ?", CONNECTION_ASYNC);
     PrepareStatement(CHAR_SEL_CHAR_POSITION_XYZ, "SELECT map, position_x, position_y, position_z FROM characters WHERE guid = ?", CONNECTION_SYNCH);
     PrepareStatement(CHAR_SEL_CHAR_POSITION, "SELECT position_x, position_y, position_z, orientation, map, taxi_path FROM characters WHERE guid = ?", CONNECTION_SYNCH);
 
@@ -33,6 +33,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_NONEXISTENT_GUILD_BANK_ITEM,
     CHAR_DEL_EXPIRED_BANS,
     CHAR_SEL_CHECK_NAME,
+    CHAR_SEL_GUID_BY_NAME,
     CHAR_SEL_CHECK_GUID,
     CHAR_SEL_SUM_CHARS,
     CHAR_SEL_CHAR_CREATE_INFO,
@@ -57,6 +58,9 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_FREE_NAME,
     CHAR_SEL_CHAR_ZONE,
     CHAR_SEL_CHARACTER_NAME_DATA,
+    CHAR_SEL_CHARACTER_CACHE_RECENT,
+    CHAR_SEL_CHARACTER_CACHE_BY_GUID,
+    CHAR_SEL_CHARACTER_CACHE_BY_NAME,
     CHAR_SEL_CHAR_POSITION_XYZ,
     CHAR_SEL_CHAR_POSITION,
 
@@ -17,19 +17,401 @@
 
 #include "CharacterCache.h"
 #include "ArenaTeam.h"
+#include "Containers.h"
 #include "DatabaseEnv.h"
+#include "Errors.h"
+#include "GameTime.h"
 #include "Log.h"
 #include "MiscPackets.h"
+#include "ObjectAccessor.h"
 #include "Player.h"
 #include "Timer.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace
 {
-    std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    // Entries live in fixed size blocks and lookups go through compact open addressing indexes
+    // storing only slot numbers instead of node based maps holding key copies.
+    // Map threads only read the storage and queue fill requests. Adding, renaming, deleting and
+    // evicting entries, which reuses slots and grows the indexes, only happens on the world thread,
+    // which is blocked in MapManager::Update while map threads run. A pointer handed out by a getter
+    // is therefore only valid until the world thread next changes the cache, do not keep it.
+    constexpr uint32 BlockSize = 1024;
+    constexpr uint32 InvalidSlot = std::numeric_limits<uint32>::max();
+
+    struct CacheBlock
+    {
+        std::array<CharacterCacheEntry, BlockSize> Entries;
+        // second chance bits for clock eviction, set by getters that may run on map threads
+        std::array<std::atomic<bool>, BlockSize> Referenced;
+        std::bitset<BlockSize> Used;
+    };
+
+    std::vector<std::unique_ptr<CacheBlock>> _blocks;
+    std::vector<uint32> _freeSlots;
+    uint32 _slotCount = 0;
+    uint32 _entryCount = 0;
+
+    CharacterCacheEntry& GetEntry(uint32 slot) { return _blocks[slot / BlockSize]->Entries[slot % BlockSize]; }
+    bool IsSlotUsed(uint32 slot) { return _blocks[slot / BlockSize]->Used[slot % BlockSize]; }
+
+    template <class Key, class KeyOfSlot, class Hasher>
+    class SlotIndex
+    {
+        static constexpr uint32 Empty = 0;
+        static constexpr uint32 Deleted = std::numeric_limits<uint32>::max();
+
+    public:
+        void Clear()
+        {
+            _buckets.assign(64, Empty);
+            _used = 0;
+            _live = 0;
+        }
+
+        uint32 Find(Key const& key) const
+        {
+            if (_buckets.empty())
+                return InvalidSlot;
+
+            std::size_t mask = _buckets.size() - 1;
+            for (std::size_t i = Hasher()(key) & mask; ; i = (i + 1) & mask)
+            {
+                uint32 bucket = _buckets[i];
+                if (bucket == Empty)
+                    return InvalidSlot;
+
+                if (bucket != Deleted && KeyOfSlot()(bucket - 1) == key)
+                    return bucket - 1;
+            }
+        }
+
+        void Insert(Key const& key, uint32 slot)
+        {
+            if (_buckets.empty())
+                Clear();
+
+            if ((_used + 1) * 2 > _buckets.size())
+                Rehash();
+
+            std::size_t mask = _buckets.size() - 1;
+            std::size_t i = Hasher()(key) & mask;
+            while (_buckets[i] != Empty && _buckets[i] != Deleted)
+                i = (i + 1) & mask;
+
+            if (_buckets[i] == Empty)
+                ++_used;
+
+            _buckets[i] = slot + 1;
+            ++_live;
+        }
+
+        void Erase(Key const& key, uint32 slot)
+        {
+            if (_buckets.empty())
+                return;
+
+            std::size_t mask = _buckets.size() - 1;
+            for (std::size_t i = Hasher()(key) & mask; _buckets[i] != Empty; i = (i + 1) & mask)
+            {
+                if (_buckets[i] == slot + 1)
+                {
+                    _buckets[i] = Deleted;
+                    --_live;
+                    return;
+                }
+            }
+        }
+
+    private:
+        void Rehash()
+        {
+            std::size_t capacity = _buckets.size();
+            while ((_live + 1) * 4 > capacity)
+                capacity *= 2;
+
+            std::vector<uint32> old(capacity, Empty);
+            old.swap(_buckets);
+            _used = 0;
+            _live = 0;
+
+            std::size_t mask = _buckets.size() - 1;
+            for (uint32 bucket : old)
+            {
+                if (bucket == Empty || bucket == Deleted)
+                    continue;
+
+                std::size_t i = Hasher()(KeyOfSlot()(bucket - 1)) & mask;
+                while (_buckets[i] != Empty)
+                    i = (i + 1) & mask;
+
+                _buckets[i] = bucket;
+                ++_used;
+                ++_live;
+            }
+        }
+
+        std::vector<uint32> _buckets;
+        std::size_t _used = 0;
+        std::size_t _live = 0;
+    };
+
+    struct GuidOfSlot
+    {
+        ObjectGuid::LowType operator()(uint32 slot) const { return GetEntry(slot).Guid.GetCounter(); }
+    };
+
+    struct NameOfSlot
+    {
+        std::string_view operator()(uint32 slot) const { return GetEntry(slot).Name; }
+    };
+
+    struct GuidHasher
+    {
+        std::size_t operator()(ObjectGuid::LowType guid) const
+        {
+            // guids are sequential, spread them over the table
+            return std::size_t(guid) * 0x9E3779B1u;
+        }
+    };
+
+    SlotIndex<ObjectGuid::LowType, GuidOfSlot, GuidHasher> _guidIndex;
+    SlotIndex<std::string_view, NameOfSlot, std::hash<std::string_view>> _nameIndex;
+
+    // 0 keeps every character in memory and never queries the database after startup
+    uint32 _maxEntries = 0;
+    uint32 _clockHand = 0;
+
+    QueryCallbackProcessor _queryProcessor;
+
+    // getters may run on map threads, they only record misses here and Update() issues the queries
+    std::mutex _fillRequestsLock;
+    std::unordered_set<ObjectGuid::LowType> _pendingGuids;
+    std::unordered_set<std::string> _pendingNames;
+    std::vector<ObjectGuid::LowType> _guidFillRequests;
+    std::vector<std::string> _nameFillRequests;
+
+    // lookups the database answered with nothing, so client supplied guids and names
+    // that do not exist cost one query per NegativeLookupTTL instead of one per packet
+    constexpr time_t NegativeLookupTTL = 60;
+    std::unordered_map<ObjectGuid::LowType, time_t> _missingGuids;
+    std::unordered_map<std::string, time_t> _missingNames;
+    time_t _nextNegativeLookupPrune = 0;
+
+    // the world thread, claimed by the first change to the storage
+    std::thread::id _storageThread;
+
+    void AssertStorageThread()
+    {
+        if (_storageThread == std::thread::id())
+            _storageThread = std::this_thread::get_id();
+
+        ASSERT(_storageThread == std::this_thread::get_id(), "CharacterCache storage may only change on the world thread");
+    }
+
+    CharacterCacheEntry* FindByGuid(ObjectGuid const& guid)
+    {
+        uint32 slot = _guidIndex.Find(guid.GetCounter());
+        if (slot == InvalidSlot)
+            return nullptr;
+
+        if (_maxEntries)
+            _blocks[slot / BlockSize]->Referenced[slot % BlockSize].store(true, std::memory_order_relaxed);
+
+        return &GetEntry(slot);
+    }
+
+    CharacterCacheEntry* FindByName(std::string_view name)
+    {
+        uint32 slot = _nameIndex.Find(name);
+        if (slot == InvalidSlot)
+            return nullptr;
+
+        if (_maxEntries)
+            _blocks[slot / BlockSize]->Referenced[slot % BlockSize].store(true, std::memory_order_relaxed);
+
+        return &GetEntry(slot);
+    }
+
+    uint32 AllocateSlot()
+    {
+        uint32 slot;
+        if (!_freeSlots.empty())
+        {
+            slot = _freeSlots.back();
+            _freeSlots.pop_back();
+        }
+        else
+        {
+            slot = _slotCount++;
+            if (slot / BlockSize >= _blocks.size())
+                _blocks.push_back(std::make_unique<CacheBlock>());
+        }
+
+        CacheBlock& block = *_blocks[slot / BlockSize];
+        block.Used.set(slot % BlockSize);
+        block.Referenced[slot % BlockSize].store(true, std::memory_order_relaxed);
+        ++_entryCount;
+        return slot;
+    }
+
+    void FreeSlot(uint32 slot)
+    {
+        CharacterCacheEntry& entry = GetEntry(slot);
+        _guidIndex.Erase(entry.Guid.GetCounter(), slot);
+        _nameIndex.Erase(entry.Name, slot);
+
+        entry.Name.clear();
+        entry.Name.shrink_to_fit();
+        _blocks[slot / BlockSize]->Used.reset(slot % BlockSize);
+        _freeSlots.push_back(slot);
+        --_entryCount;
+    }
+
+    void FillFromQuery(PreparedQueryResult result)
+    {
+        if (!result)
+            return;
+
+        CharacterCacheEntry entry;
+        CharacterCache::ReadCharacterCacheEntry(result->Fetch(), entry);
+        if (sCharacterCache->HasCharacterCacheEntry(entry.Guid))
+            return;
+
+        sCharacterCache->AddCharacterCacheEntry(entry.Guid, entry.AccountId, entry.Name, entry.Sex, entry.Race, entry.Class, entry.Level);
+        sCharacterCache->UpdateCharacterGuildId(entry.Guid, entry.GuildId);
+        for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
+            sCharacterCache->UpdateCharacterArenaTeamId(entry.Guid, i, entry.ArenaTeamId[i]);
+    }
+
+    // misses only reach the database when the cache is bounded, otherwise it already holds every character
+    void RequestFillByGuid(ObjectGuid const& guid)
+    {
+        if (!_maxEntries || !guid.IsPlayer())
+            return;
+
+        std::lock_guard<std::mutex> lock(_fillRequestsLock);
+        auto itr = _missingGuids.find(guid.GetCounter());
+        if (itr != _missingGuids.end() && itr->second > GameTime::GetGameTime())
+            return;
+
+        if (_pendingGuids.insert(guid.GetCounter()).second)
+            _guidFillRequests.push_back(guid.GetCounter());
+    }
+
+    void RequestFillByName(std::string const& name)
+    {
+        if (!_maxEntries || name.empty())
+            return;
+
+        std::lock_guard<std::mutex> lock(_fillRequestsLock);
+        auto itr = _missingNames.find(name);
+        if (itr != _missingNames.end() && itr->second > GameTime::GetGameTime())
+            return;
+
+        if (_pendingNames.insert(name).second)
+            _nameFillRequests.push_back(name);
+    }
+
+    void IssueFillRequests()
+    {
+        std::vector<ObjectGuid::LowType> guids;
+        std::vector<std::string> names;
+        {
+            std::lock_guard<std::mutex> lock(_fillRequestsLock);
+            guids.swap(_guidFillRequests);
+            names.swap(_nameFillRequests);
+        }
+
+        for (ObjectGuid::LowType guid : guids)
+        {
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CACHE_BY_GUID);
+            stmt->setUInt32(0, guid);
+            _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback([guid](PreparedQueryResult result)
+            {
+                bool found = bool(result);
+                FillFromQuery(std::move(result));
+                std::lock_guard<std::mutex> lock(_fillRequestsLock);
+                _pendingGuids.erase(guid);
+                if (!found)
+                    _missingGuids[guid] = GameTime::GetGameTime() + NegativeLookupTTL;
+            }));
+        }
+
+        for (std::string& name : names)
+        {
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CACHE_BY_NAME);
+            stmt->setString(0, name);
+            _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback([name = std::move(name)](PreparedQueryResult result)
+            {
+                bool found = bool(result);
+                FillFromQuery(std::move(result));
+                std::lock_guard<std::mutex> lock(_fillRequestsLock);
+                _pendingNames.erase(name);
+                if (!found)
+                    _missingNames[name] = GameTime::GetGameTime() + NegativeLookupTTL;
+            }));
+        }
+    }
+
+    void PruneNegativeLookups()
+    {
+        time_t now = GameTime::GetGameTime();
+        if (!_maxEntries || now < _nextNegativeLookupPrune)
+            return;
+
+        _nextNegativeLookupPrune = now + NegativeLookupTTL;
+
+        std::lock_guard<std::mutex> lock(_fillRequestsLock);
+        Trinity::Containers::EraseIf(_missingGuids, [now](std::pair<ObjectGuid::LowType const, time_t> const& missing) { return missing.second <= now; });
+        Trinity::Containers::EraseIf(_missingNames, [now](std::pair<std::string const, time_t> const& missing) { return missing.second <= now; });
+    }
+
+    // a character was created, renamed or restored, forget that it was missing
+    void ForgetNegativeLookup(ObjectGuid const& guid, std::string const& name)
+    {
+        if (!_maxEntries)
+            return;
+
+        std::lock_guard<std::mutex> lock(_fillRequestsLock);
+        _missingGuids.erase(guid.GetCounter());
+        _missingNames.erase(name);
+    }
+
+    // clock (second chance) approximation of LRU, characters that are online are never evicted
+    void EvictEntries()
+    {
+        if (!_maxEntries || _entryCount <= _maxEntries || !_slotCount)
+            return;
+
+        uint32 toEvict = _entryCount - _maxEntries;
+        for (uint32 scanned = 0; toEvict && scanned < _slotCount * 2; ++scanned)
+        {
+            uint32 slot = _clockHand;
+            _clockHand = (_clockHand + 1) % _slotCount;
+            if (!IsSlotUsed(slot))
+                continue;
+
+            if (_blocks[slot / BlockSize]->Referenced[slot % BlockSize].exchange(false, std::memory_order_relaxed))
+                continue;
+
+            if (ObjectAccessor::FindConnectedPlayer(GetEntry(slot).Guid))
+                continue;
+
+            FreeSlot(slot);
+            --toEvict;
+        }
+    }
 }
 
 CharacterCache::CharacterCache()
@@ -46,6 +428,20 @@ CharacterCache* CharacterCache::instance()
     return &instance;
 }
 
+void CharacterCache::ReadCharacterCacheEntry(Field* fields, CharacterCacheEntry& entry)
+{
+    entry.Guid = ObjectGuid::Create<HighGuid::Player>(fields[0].GetUInt32());
+    entry.Name = fields[1].GetString();
+    entry.AccountId = fields[2].GetUInt32();
+    entry.Race = fields[3].GetUInt8();
+    entry.Sex = fields[4].GetUInt8();
+    entry.Class = fields[5].GetUInt8();
+    entry.Level = fields[6].GetUInt8();
+    entry.GuildId = fields[7].GetUInt32();
+    for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
+        entry.ArenaTeamId[i] = fields[8 + i].GetUInt32();
+}
+
 /**
 * @brief Loads several pieces of information on server startup with the GUID
 * There is no further database query necessary.
@@ -69,10 +465,41 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
-    _characterCacheStore.clear();
+    AssertStorageThread();
+
+    _blocks.clear();
+    _freeSlots.clear();
+    _slotCount = 0;
+    _entryCount = 0;
+    _clockHand = 0;
+    _guidIndex.Clear();
+    _nameIndex.Clear();
+    _maxEntries = sWorld->getIntConfig(CONFIG_CHARACTER_CACHE_MAX_ENTRIES);
+
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
+    QueryResult result;
+    if (_maxEntries)
+    {
+        // only preload the most recently played characters, the rest is fetched on first use
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CACHE_RECENT);
+        stmt->setUInt32(0, _maxEntries);
+        if (PreparedQueryResult recent = CharacterDatabase.Query(stmt))
+        {
+            do
+            {
+                Field* fields = recent->Fetch();
+                ObjectGuid guid = ObjectGuid::Create<HighGuid::Player>(fields[0].GetUInt32());
+                AddCharacterCacheEntry(guid, fields[2].GetUInt32() /*account*/, fields[1].GetString() /*name*/,
+                    fields[4].GetUInt8() /*gender*/, fields[3].GetUInt8() /*race*/, fields[5].GetUInt8() /*class*/, fields[6].GetUInt8() /*level*/);
+            } while (recent->NextRow());
+        }
+
+        TC_LOG_INFO("server.loading", "Loaded character infos for {} of the most recently played characters (limit {}) in {} ms", _entryCount, _maxEntries, GetMSTimeDiffToNow(oldMSTime));
+        return;
+    }
+
+    result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
     if (!result)
     {
         TC_LOG_INFO("server.loading", "No character name data loaded, empty query");
@@ -86,7 +513,17 @@ void CharacterCache::LoadCharacterCacheStorage()
             fields[4].GetUInt8() /*gender*/, fields[3].GetUInt8() /*race*/, fields[5].GetUInt8() /*class*/, fields[6].GetUInt8() /*level*/);
     } while (result->NextRow());
 
-    TC_LOG_INFO("server.loading", "Loaded character infos for {} characters in {} ms", _characterCacheStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    TC_LOG_INFO("server.loading", "Loaded character infos for {} characters in {} ms", _entryCount, GetMSTimeDiffToNow(oldMSTime));
+}
+
+void CharacterCache::Update()
+{
+    AssertStorageThread();
+
+    IssueFillRequests();
+    _queryProcessor.ProcessReadyCallbacks();
+    EvictEntries();
+    PruneNegativeLookups();
 }
 
 /*
@@ -94,8 +531,19 @@ Modifying functions
 */
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
-    data.Guid = guid;
+    AssertStorageThread();
+
+    uint32 slot = _guidIndex.Find(guid.GetCounter());
+    if (slot != InvalidSlot)
+        _nameIndex.Erase(GetEntry(slot).Name, slot);
+    else
+    {
+        slot = AllocateSlot();
+        GetEntry(slot).Guid = guid;
+        _guidIndex.Insert(guid.GetCounter(), slot);
+    }
+
+    CharacterCacheEntry& data = GetEntry(slot);
     data.Name = name;
     data.AccountId = accountId;
     data.Race = race;
@@ -107,172 +555,188 @@ void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accou
         data.ArenaTeamId[i] = 0;                // Will be set in arena teams loading
 
     // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    uint32 previousOwner = _nameIndex.Find(name);
+    if (previousOwner != InvalidSlot)
+        _nameIndex.Erase(name, previousOwner);
+
+    _nameIndex.Insert(data.Name, slot);
+
+    ForgetNegativeLookup(guid, name);
 }
 
 void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    AssertStorageThread();
+
+    uint32 slot = _guidIndex.Find(guid.GetCounter());
+    if (slot != InvalidSlot)
+        FreeSlot(slot);
+
+    uint32 nameSlot = _nameIndex.Find(name);
+    if (nameSlot != InvalidSlot)
+        _nameIndex.Erase(name, nameSlot);
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    AssertStorageThread();
+
+    ForgetNegativeLookup(guid, name);
+
+    uint32 slot = _guidIndex.Find(guid.GetCounter());
+    if (slot == InvalidSlot)
         return;
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name = name;
+    CharacterCacheEntry& data = GetEntry(slot);
+
+    // Correct name -> slot storage
+    _nameIndex.Erase(data.Name, slot);
+    data.Name = name;
 
     if (gender)
-        itr->second.Sex = *gender;
+        data.Sex = *gender;
 
     if (race)
-        itr->second.Race = *race;
+        data.Race = *race;
 
     WorldPackets::Misc::InvalidatePlayer packet(guid);
     sWorld->SendGlobalMessage(packet.Write());
 
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
+    uint32 previousOwner = _nameIndex.Find(name);
+    if (previousOwner != InvalidSlot)
+        _nameIndex.Erase(name, previousOwner);
+
+    _nameIndex.Insert(data.Name, slot);
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.Level = level;
+    if (CharacterCacheEntry* data = FindByGuid(guid))
+        data->Level = level;
 }
 
 void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.AccountId = accountId;
+    if (CharacterCacheEntry* data = FindByGuid(guid))
+        data->AccountId = accountId;
 }
 
 void CharacterCache::UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.GuildId = guildId;
+    if (CharacterCacheEntry* data = FindByGuid(guid))
+        data->GuildId = guildId;
 }
 
 void CharacterCache::UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry* data = FindByGuid(guid);
+    if (!data)
         return;
 
     ASSERT(slot < 3);
-    itr->second.ArenaTeamId[slot] = arenaTeamId;
+    data->ArenaTeamId[slot] = arenaTeamId;
 }
 
 /*
 Getters
 */
+bool CharacterCache::IsComplete() const
+{
+    return !_maxEntries;
+}
+
 bool CharacterCache::HasCharacterCacheEntry(ObjectGuid const& guid) const
 {
-    return _characterCacheStore.find(guid) != _characterCacheStore.end();
+    return _guidIndex.Find(guid.GetCounter()) != InvalidSlot;
 }
 
 CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr != _characterCacheStore.end())
-        return &itr->second;
+    if (CharacterCacheEntry const* data = FindByGuid(guid))
+        return data;
 
+    RequestFillByGuid(guid);
     return nullptr;
 }
 
 CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second;
+    if (CharacterCacheEntry const* data = FindByName(name))
+        return data;
 
+    RequestFillByName(name);
     return nullptr;
 }
 
 ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second->Guid;
+    if (CharacterCacheEntry const* data = GetCharacterCacheByName(name))
+        return data->Guid;
 
     return ObjectGuid::Empty;
 }
 
 bool CharacterCache::GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return false;
 
-    name = itr->second.Name;
+    name = data->Name;
     return true;
 }
 
 uint32 CharacterCache::GetCharacterTeamByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
-    return Player::TeamForRace(itr->second.Race);
+    return Player::TeamForRace(data->Race);
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
-    return itr->second.AccountId;
+    return data->AccountId;
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second->AccountId;
+    if (CharacterCacheEntry const* data = GetCharacterCacheByName(name))
+        return data->AccountId;
 
     return 0;
 }
 
 uint8 CharacterCache::GetCharacterLevelByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
-    return itr->second.Level;
+    return data->Level;
 }
 
 ObjectGuid::LowType CharacterCache::GetCharacterGuildIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
-    return itr->second.GuildId;
+    return data->GuildId;
 }
 
 uint32 CharacterCache::GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
     uint8 slot = ArenaTeam::GetSlotByType(type);
     ASSERT(slot < 3);
-    return itr->second.ArenaTeamId[slot];
+    return data->ArenaTeamId[slot];
 }
@@ -18,6 +18,7 @@
 #ifndef CharacterCache_h__
 #define CharacterCache_h__
 
+#include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "ObjectGuid.h"
 #include "Optional.h"
@@ -43,7 +44,11 @@ class TC_GAME_API CharacterCache
         ~CharacterCache();
         static CharacterCache* instance();
 
+        // Reads a row of CHAR_SEL_CHARACTER_CACHE_BY_GUID or CHAR_SEL_CHARACTER_CACHE_BY_NAME without adding it to the cache
+        static void ReadCharacterCacheEntry(Field* fields, CharacterCacheEntry& entry);
+
         void LoadCharacterCacheStorage();
+        void Update();
         void AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level);
         void DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name);
 
@@ -53,7 +58,10 @@ class TC_GAME_API CharacterCache
         void UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId);
         void UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId);
 
+        /// False when CharacterCache.MaxEntries bounds the cache, a miss then does not prove that the character does not exist
+        bool IsComplete() const;
         bool HasCharacterCacheEntry(ObjectGuid const& guid) const;
+        // the entry is only valid until the world thread next changes the cache, do not keep it
         CharacterCacheEntry const* GetCharacterCacheByGuid(ObjectGuid const& guid) const;
         CharacterCacheEntry const* GetCharacterCacheByName(std::string const& name) const;
 
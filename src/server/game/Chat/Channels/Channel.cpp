@@ -32,6 +32,7 @@
 #include "SocialMgr.h"
 #include "StringConvert.h"
 #include "World.h"
+#include <array>
 
 Channel::Channel(uint32 channelId, uint32 team /*= 0*/, AreaTableEntry const* zoneEntry /*= nullptr*/) :
     _isDirty(false),
@@ -202,7 +203,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     if (newChannel)
         _nextActivityUpdateTime = 0; // force activity update on next channel tick
 
-    PlayerInfo& pinfo = _playersStore[guid];
+    PlayerInfo& pinfo = AddMember(player);
     pinfo.flags = MEMBER_FLAG_NONE;
     pinfo.invisible = !player->isGMVisible();
 
@@ -253,7 +254,7 @@ void Channel::LeaveChannel(Player* player, bool send)
 
     PlayerInfo& info = _playersStore.at(guid);
     bool changeowner = info.IsOwner();
-    _playersStore.erase(guid);
+    RemoveMember(guid);
 
     if (_announceEnabled && !player->GetSession()->HasPermission(rbac::RBAC_PERM_SILENTLY_JOIN_CHANNEL))
     {
@@ -352,7 +353,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
         SendToAll(builder);
     }
 
-    _playersStore.erase(victim);
+    RemoveMember(victim);
     bad->LeftChannel(this);
 
     if (changeowner && _ownershipEnabled && !_playersStore.empty())
@@ -858,26 +859,81 @@ void Channel::LeaveNotify(ObjectGuid guid) const
         SendToAll(builder);
 }
 
+Channel::PlayerInfo& Channel::AddMember(Player* player)
+{
+    PlayerInfo& info = _playersStore[player->GetGUID()];
+    info.memberIndex = _memberHandles.size();
+    _memberHandles.push_back(player);
+    return info;
+}
+
+void Channel::RemoveMember(ObjectGuid guid)
+{
+    auto itr = _playersStore.find(guid);
+    if (itr == _playersStore.end())
+        return;
+
+    uint32 index = itr->second.memberIndex;
+    if (index + 1 != _memberHandles.size())
+    {
+        Player* moved = _memberHandles.back();
+        _memberHandles[index] = moved;
+        _playersStore.at(moved->GetGUID()).memberIndex = index;
+    }
+
+    _memberHandles.pop_back();
+    _playersStore.erase(itr);
+}
+
+namespace
+{
+    // Builds each localized packet once and queues the same buffer to every recipient,
+    // the per socket copy happens on the network threads when they flush their send queues
+    template<class Builder>
+    class SharedLocalizedPacketDo
+    {
+        public:
+            explicit SharedLocalizedPacketDo(Builder& builder) : _builder(builder) { }
+
+            void operator()(Player const* player)
+            {
+                WorldSession* session = player->GetSession();
+                LocaleConstant locale = session->GetSessionDbLocaleIndex();
+                std::shared_ptr<WorldPacket const>& packet = _packets[locale];
+                if (!packet)
+                {
+                    std::shared_ptr<WorldPacket> data = std::make_shared<WorldPacket>();
+                    _builder(*data, locale);
+                    packet = std::move(data);
+                }
+
+                session->SendPacket(packet);
+            }
+
+        private:
+            Builder& _builder;
+            std::array<std::shared_ptr<WorldPacket const>, TOTAL_LOCALES> _packets;
+    };
+}
+
 template<class Builder>
 void Channel::SendToAll(Builder& builder, ObjectGuid guid /*= ObjectGuid::Empty*/) const
 {
-    Trinity::LocalizedPacketDo<Builder> localizer(builder);
+    SharedLocalizedPacketDo<Builder> localizer(builder);
 
-    for (PlayerContainer::const_iterator i = _playersStore.begin(); i != _playersStore.end(); ++i)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i->first))
-            if (!guid || !player->GetSocial()->HasIgnore(guid))
-                localizer(player);
+    for (Player* player : _memberHandles)
+        if (!guid || !player->GetSocial()->HasIgnore(guid))
+            localizer(player);
 }
 
 template<class Builder>
 void Channel::SendToAllButOne(Builder& builder, ObjectGuid who) const
 {
-    Trinity::LocalizedPacketDo<Builder> localizer(builder);
+    SharedLocalizedPacketDo<Builder> localizer(builder);
 
-    for (PlayerContainer::const_iterator i = _playersStore.begin(); i != _playersStore.end(); ++i)
-        if (i->first != who)
-            if (Player* player = ObjectAccessor::FindConnectedPlayer(i->first))
-                localizer(player);
+    for (Player* player : _memberHandles)
+        if (player->GetGUID() != who)
+            localizer(player);
 }
 
 template<class Builder>
@@ -23,6 +23,7 @@
 #include <ctime>
 #include <map>
 #include <unordered_set>
+#include <vector>
 
 class Player;
 struct AreaTableEntry;
@@ -122,6 +123,7 @@ class TC_GAME_API Channel
     {
         uint8 flags;
         bool invisible;
+        uint32 memberIndex;     //< position of the player in _memberHandles
 
         bool IsInvisible() const { return invisible; }
         void SetInvisible(bool on) { invisible = on; }
@@ -222,6 +224,9 @@ class TC_GAME_API Channel
         template<class Builder>
         void SendToOne(Builder& builder, ObjectGuid who) const;
 
+        PlayerInfo& AddMember(Player* player);
+        void RemoveMember(ObjectGuid guid);
+
         bool IsOn(ObjectGuid who) const { return _playersStore.find(who) != _playersStore.end(); }
         bool IsBanned(ObjectGuid guid) const { return _bannedStore.find(guid) != _bannedStore.end(); }
 
@@ -235,6 +240,7 @@ class TC_GAME_API Channel
         void SetMute(ObjectGuid guid, bool set);
 
         typedef std::map<ObjectGuid, PlayerInfo> PlayerContainer;
+        typedef std::vector<Player*> MemberHandleContainer;
         typedef GuidUnorderedSet BannedContainer;
 
         bool _isDirty; // whether the channel needs to be saved to DB
@@ -251,6 +257,7 @@ class TC_GAME_API Channel
         std::string _channelName;
         std::string _channelPassword;
         PlayerContainer _playersStore;
+        MemberHandleContainer _memberHandles;   //< members leave channels before logging out, so broadcasts need no guid lookups
         BannedContainer _bannedStore;
 
         AreaTableEntry const* _zoneEntry;
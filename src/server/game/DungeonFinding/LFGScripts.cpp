@@ -247,7 +247,7 @@ void LFGGroupScript::OnInviteMember(Group* group, ObjectGuid guid)
 
 void AddSC_LFGScripts()
 {
-    new LFGPlayerScript();
+    RegisterPlayerScript(LFGPlayerScript);
     new LFGGroupScript();
 }
 
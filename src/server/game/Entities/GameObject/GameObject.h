@@ -92,8 +92,6 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
         explicit GameObject();
         ~GameObject();
 
-        void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player const* target) const override;
-
         void AddToWorld() override;
         void RemoveFromWorld() override;
         void CleanupsBeforeDelete(bool finalCleanup = true) override;
@@ -319,6 +317,10 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
         std::string GetDebugInfo() const override;
 
     protected:
+        void AddForcedUpdateFields(UpdateMaskPacketBuilder& updateMask, uint32 visibleFlag) const override;
+        uint32 GetUpdateFieldValueFor(uint16 index, Player const* target) const override;
+        bool IsUpdateFieldValueTargetDependent(uint16 index) const override;
+
         void CreateModel();
         void UpdateModel();                                 // updates model in case displayId were changed
         uint32      m_spellId;
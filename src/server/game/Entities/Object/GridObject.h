@@ -11,8 +11,19 @@ class GridObject
         virtual ~GridObject() { }
 
         bool IsInGrid() const { return _gridRef.isValid(); }
-        void AddToGrid(GridRefManager<T>& m) { ASSERT(!IsInGrid()); _gridRef.link(&m, (T*)this); }
-        void RemoveFromGrid() { ASSERT(IsInGrid()); _gridRef.unlink(); }
+        void AddToGrid(GridRefManager<T>& m)
+        {
+            ASSERT(!IsInGrid());
+            _gridRef.link(&m, (T*)this);
+            m.GetPositions().Insert((T*)this);
+        }
+
+        void RemoveFromGrid()
+        {
+            ASSERT(IsInGrid());
+            _gridRef.unlink();
+            GridPositionIndex::Remove((T*)this);
+        }
     private:
         GridReference<T> _gridRef;
 };
@@ -455,25 +455,45 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player const*
     if (!target)
         return;
 
-    ByteBuffer fieldBuffer;
-    UpdateMaskPacketBuilder updateMask(m_valuesCount);
-
-    uint32* flags = nullptr;
+    UpdateFieldFlagBlocks const* flags = nullptr;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
     ASSERT(flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    BuildValuesUpdate(updateType, data, target, *flags, visibleFlag, nullptr);
+}
+
+void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player const* target, UpdateFieldFlagBlocks const& flags, uint32 visibleFlag,
+    std::vector<std::pair<uint16, std::size_t>>* targetDependentValues) const
+{
+    UpdateMaskPacketBuilder updateMask(m_valuesCount);
+
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
+        UpdateMask::BlockType changed = 0;
+        if (updateType == UPDATETYPE_VALUES)
+            changed = _changesMask.GetBlock(block);
+        else
         {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
+            uint32 const first = block * UpdateMask::BLOCK_BITS;
+            uint32 const last = std::min<uint32>(first + UpdateMask::BLOCK_BITS, m_valuesCount);
+            for (uint32 index = first; index < last; ++index)
+                if (m_uint32Values[index])
+                    changed |= UpdateMask::GetBlockFlag(index);
         }
+
+        updateMask.SetBlockBits(block, flags.GetFieldsWithFlags(block, _fieldNotifyFlags) | (changed & flags.GetFieldsWithFlags(block, visibleFlag)));
     }
 
+    AddForcedUpdateFields(updateMask, visibleFlag);
+
     updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+    updateMask.VisitSetBits([&](uint16 index)
+    {
+        if (targetDependentValues && IsUpdateFieldValueTargetDependent(index))
+            targetDependentValues->emplace_back(index, data->wpos());
+
+        *data << GetUpdateFieldValueFor(index, target);
+    });
 }
 
 void Object::AddToObjectUpdateIfNeeded()
@@ -495,13 +515,48 @@ void Object::ClearUpdateMask(bool remove)
     }
 }
 
-void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) const
+void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map, ValuesUpdateCache* cache /*= nullptr*/) const
 {
-    UpdateDataMapType::iterator iter = data_map.try_emplace(player).first;
-    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+    UpdateData& data = data_map.try_emplace(player).first->second;
+    if (!cache)
+    {
+        BuildValuesUpdateBlockForPlayer(&data, player);
+        return;
+    }
+
+    UpdateFieldFlagBlocks const* flags = nullptr;
+    uint32 visibleFlag = GetUpdateFieldData(player, flags);
+    ASSERT(flags);
+
+    auto itr = std::find_if(cache->Blocks.begin(), cache->Blocks.end(), [visibleFlag](ValuesUpdateCache::Block const& block)
+    {
+        return block.VisibleFlag == visibleFlag;
+    });
+
+    bool reused = itr != cache->Blocks.end();
+    if (!reused)
+    {
+        ValuesUpdateCache::Block& block = cache->Blocks.emplace_back();
+        block.VisibleFlag = visibleFlag;
+        block.Data << uint8(UPDATETYPE_VALUES);
+        block.Data << GetPackGUID();
+        BuildValuesUpdate(UPDATETYPE_VALUES, &block.Data, player, *flags, visibleFlag, &block.TargetDependentValues);
+        itr = std::prev(cache->Blocks.end());
+    }
+
+    ByteBuffer& buf = data.GetBuffer();
+    std::size_t blockStart = buf.wpos();
+    buf.append(itr->Data);
+
+    // the cached values were built for the first observer of this class
+    if (reused)
+        for (auto const& [index, offset] : itr->TargetDependentValues)
+            buf.put<uint32>(blockStart + offset, GetUpdateFieldValueFor(index, player));
+
+    data.AddUpdateBlock();
 }
 
-uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
+uint32 Object::GetUpdateFieldData(Player const* target, UpdateFieldFlagBlocks const*& flags) const
 {
     uint32 visibleFlag = UF_FLAG_PUBLIC;
 
@@ -512,7 +567,7 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
     {
         case TYPEID_ITEM:
         case TYPEID_CONTAINER:
-            flags = ItemUpdateFieldFlags;
+            flags = &ItemUpdateFieldFlagBlocks;
             if (((Item const*)this)->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER | UF_FLAG_ITEM_OWNER;
             break;
@@ -520,7 +575,7 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
         case TYPEID_PLAYER:
         {
             Player* plr = ToUnit()->GetCharmerOrOwnerPlayerOrPlayerItself();
-            flags = UnitUpdateFieldFlags;
+            flags = &UnitUpdateFieldFlagBlocks;
             if (ToUnit()->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
 
@@ -533,17 +588,17 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
             break;
         }
         case TYPEID_GAMEOBJECT:
-            flags = GameObjectUpdateFieldFlags;
+            flags = &GameObjectUpdateFieldFlagBlocks;
             if (ToGameObject()->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
             break;
         case TYPEID_DYNAMICOBJECT:
-            flags = DynamicObjectUpdateFieldFlags;
+            flags = &DynamicObjectUpdateFieldFlagBlocks;
             if (ToDynObject()->GetCasterGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
             break;
         case TYPEID_CORPSE:
-            flags = CorpseUpdateFieldFlags;
+            flags = &CorpseUpdateFieldFlagBlocks;
             if (ToCorpse()->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
             break;
@@ -942,7 +997,7 @@ void MovementInfo::OutDebug()
 WorldObject::WorldObject(bool isWorldObject) : Object(), WorldLocation(), LastUsedScriptID(0),
 m_movementInfo(), m_name(), m_isActive(false), m_isFarVisible(false), m_isStoredInWorldObjectGridContainer(isWorldObject), m_zoneScript(nullptr),
 m_transport(nullptr), m_zoneId(0), m_areaId(0), m_staticFloorZ(VMAP_INVALID_HEIGHT), m_outdoors(false), m_liquidStatus(LIQUID_MAP_NO_WATER),
-m_currMap(nullptr), m_InstanceId(0), m_phaseMask(PHASEMASK_NORMAL), m_notifyflags(0)
+m_currMap(nullptr), m_InstanceId(0), m_phaseMask(PHASEMASK_NORMAL), m_gridPositions(nullptr), m_gridPositionSlot(0), m_notifyflags(0)
 {
     m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE | GHOST_VISIBILITY_GHOST);
     m_serverSideVisibilityDetect.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE);
@@ -961,6 +1016,8 @@ WorldObject::~WorldObject()
         }
         ResetMap();
     }
+
+    GridPositionIndex::Remove(this);
 }
 
 void WorldObject::SetIsStoredInWorldObjectGridContainer(bool on)
@@ -1205,22 +1262,30 @@ bool WorldObject::IsWithinLOS(float ox, float oy, float oz, LineOfSightChecks ch
 {
     if (IsInWorld())
     {
-        oz += GetCollisionHeight();
-        float x, y, z;
-        if (GetTypeId() == TYPEID_PLAYER)
-        {
-            GetPosition(x, y, z);
-            z += GetCollisionHeight();
-        }
-        else
-            GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
-
-        return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+        VMAP::LineOfSightRay ray = GetLineOfSightRay(ox, oy, oz);
+        return GetMap()->isInLineOfSight(ray.X1, ray.Y1, ray.Z1, ray.X2, ray.Y2, ray.Z2, GetPhaseMask(), checks, ignoreFlags);
     }
 
     return true;
 }
 
+VMAP::LineOfSightRay WorldObject::GetLineOfSightRay(float ox, float oy, float oz) const
+{
+    VMAP::LineOfSightRay ray;
+    ray.X2 = ox;
+    ray.Y2 = oy;
+    ray.Z2 = oz + GetCollisionHeight();
+    if (GetTypeId() == TYPEID_PLAYER)
+    {
+        GetPosition(ray.X1, ray.Y1, ray.Z1);
+        ray.Z1 += GetCollisionHeight();
+    }
+    else
+        GetHitSpherePointFor({ ray.X2, ray.Y2, ray.Z2 }, ray.X1, ray.Y1, ray.Z1);
+
+    return ray;
+}
+
 bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
     if (!IsInMap(obj))
@@ -3432,6 +3497,9 @@ void WorldObject::SetPhaseMask(uint32 newPhaseMask, bool update)
 {
     m_phaseMask = newPhaseMask;
 
+    if (m_gridPositions)
+        m_gridPositions->UpdatePhaseMask(m_gridPositionSlot, newPhaseMask);
+
     if (update && IsInWorld())
         UpdateObjectVisibility();
 }
@@ -3503,6 +3571,7 @@ struct WorldObjectChangeAccumulator
     UpdateDataMapType& i_updateDatas;
     WorldObject& i_object;
     GuidSet plr_list;
+    ValuesUpdateCache i_valuesCache;
     WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d) : i_updateDatas(d), i_object(obj) { }
     void Visit(PlayerMapType &m)
     {
@@ -3560,7 +3629,7 @@ struct WorldObjectChangeAccumulator
         // Only send update once to a player
         if (plr_list.find(player->GetGUID()) == plr_list.end() && player->HaveAtClient(&i_object))
         {
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
+            i_object.BuildFieldsUpdate(player, i_updateDatas, &i_valuesCache);
             plr_list.insert(player->GetGUID());
         }
     }
@@ -21,6 +21,7 @@
 #include "Common.h"
 #include "Duration.h"
 #include "EventProcessor.h"
+#include "GridPositionIndex.h"
 #include "MapDefines.h"
 #include "ModelIgnoreFlags.h"
 #include "MovementInfo.h"
@@ -57,6 +58,7 @@ class TempSummon;
 class Transport;
 class Unit;
 class UpdateData;
+class UpdateFieldFlagBlocks;
 class WorldObject;
 class WorldPacket;
 class ZoneScript;
@@ -67,8 +69,30 @@ class Eluna;
 struct FactionTemplateEntry;
 struct QuaternionData;
 
+namespace VMAP
+{
+    struct LineOfSightRay;
+}
+
 typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
 
+// Values update blocks of one object built during a single update pass.
+// Observers sharing the same visibility flags receive the same mask and values, only the
+// observer dependent fields (spellclick, tapped, GM flags...) are rewritten for each of them.
+struct ValuesUpdateCache
+{
+    struct Block
+    {
+        Block() : VisibleFlag(0), Data(128) { }
+
+        uint32 VisibleFlag;
+        ByteBuffer Data;
+        std::vector<std::pair<uint16, std::size_t>> TargetDependentValues;   // field index and offset of its value in Data
+    };
+
+    std::vector<Block> Blocks;
+};
+
 float const DEFAULT_COLLISION_HEIGHT = 2.03128f; // Most common value in dbc
 
 class TC_GAME_API Object
@@ -162,7 +186,7 @@ class TC_GAME_API Object
         virtual bool hasInvolvedQuest(uint32 /* quest_id */) const { return false; }
         void SetIsNewObject(bool enable) { m_isNewObject = enable; }
         virtual void BuildUpdate(UpdateDataMapType&) { }
-        void BuildFieldsUpdate(Player*, UpdateDataMapType &) const;
+        void BuildFieldsUpdate(Player*, UpdateDataMapType &, ValuesUpdateCache* cache = nullptr) const;
 
         void SetFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags |= flag; }
         void RemoveFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags &= uint16(~flag); }
@@ -230,10 +254,19 @@ class TC_GAME_API Object
         std::string _ConcatFields(uint16 startIndex, uint16 size) const;
         [[nodiscard]] bool _LoadIntoDataField(std::string const& data, uint32 startOffset, uint32 count);
 
-        uint32 GetUpdateFieldData(Player const* target, uint32*& flags) const;
+        uint32 GetUpdateFieldData(Player const* target, UpdateFieldFlagBlocks const*& flags) const;
 
         void BuildMovementUpdate(ByteBuffer* data, uint16 flags) const;
-        virtual void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player const* target) const;
+        void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player const* target) const;
+        void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player const* target, UpdateFieldFlagBlocks const& flags, uint32 visibleFlag,
+            std::vector<std::pair<uint16, std::size_t>>* targetDependentValues) const;
+
+        // Fields sent on every values update regardless of the changes mask, besides the _fieldNotifyFlags ones
+        virtual void AddForcedUpdateFields(UpdateMaskPacketBuilder& /*updateMask*/, uint32 /*visibleFlag*/) const { }
+        // Value of a field as sent to target
+        virtual uint32 GetUpdateFieldValueFor(uint16 index, Player const* /*target*/) const { return m_uint32Values[index]; }
+        // Fields whose sent value depends on more than the visibility flags of the observer
+        virtual bool IsUpdateFieldValueTargetDependent(uint16 /*index*/) const { return false; }
 
         uint16 m_objectType;
 
@@ -362,6 +395,14 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         Position GetRandomNearPosition(float radius);
         void GetContactPoint(WorldObject const* obj, float& x, float& y, float& z, float distance2d = CONTACT_DISTANCE) const;
 
+        // hide Position relocation so the grid position index of the current cell follows every move
+        void Relocate(float x, float y) { Position::Relocate(x, y); UpdateGridPosition(); }
+        void Relocate(float x, float y, float z) { Position::Relocate(x, y, z); UpdateGridPosition(); }
+        void Relocate(float x, float y, float z, float o) { Position::Relocate(x, y, z, o); UpdateGridPosition(); }
+        void Relocate(Position const& pos) { Position::Relocate(pos); UpdateGridPosition(); }
+        void Relocate(Position const* pos) { Position::Relocate(pos); UpdateGridPosition(); }
+        void RelocateOffset(Position const& offset) { Position::RelocateOffset(offset); UpdateGridPosition(); }
+
         virtual float GetCombatReach() const { return 0.0f; } // overridden (only) in Unit
         void UpdateGroundPositionZ(float x, float y, float &z) const;
         void UpdateAllowedPositionZ(float x, float y, float &z, float* groundZ = nullptr) const;
@@ -409,6 +450,8 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         bool IsWithinDistInMap(WorldObject const* obj, float dist2compare, bool is3D = true, bool incOwnRadius = true, bool incTargetRadius = true) const;
         bool IsWithinLOS(float x, float y, float z, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing) const;
         bool IsWithinLOSInMap(WorldObject const* obj, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing) const;
+        // Ray IsWithinLOS tests for the given point, to batch line of sight queries
+        VMAP::LineOfSightRay GetLineOfSightRay(float x, float y, float z) const;
         Position GetHitSpherePointFor(Position const& dest) const;
         void GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z) const;
         bool GetDistanceOrder(WorldObject const* obj1, WorldObject const* obj2, bool is3D = true) const;
@@ -623,6 +666,12 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         Transport* m_transport;
 
         virtual void ProcessPositionDataChanged(PositionFullTerrainStatus const& data);
+
+        void UpdateGridCombatReach(float combatReach)
+        {
+            if (m_gridPositions)
+                m_gridPositions->UpdateCombatReach(m_gridPositionSlot, combatReach);
+        }
         uint32 m_zoneId;
         uint32 m_areaId;
         float m_staticFloorZ;
@@ -646,6 +695,16 @@ class TC_GAME_API WorldObject : public Object, public WorldLocation
         uint32 m_InstanceId;                              // in map copy with instance id
         uint32 m_phaseMask;                               // in area phase state
 
+        friend class GridPositionIndex;
+        GridPositionIndex* m_gridPositions;               // position index of the grid container holding this object
+        uint32 m_gridPositionSlot;
+
+        void UpdateGridPosition()
+        {
+            if (m_gridPositions)
+                m_gridPositions->UpdatePosition(m_gridPositionSlot, GetPositionX(), GetPositionY());
+        }
+
         uint16 m_notifyflags;
 
         ObjectGuid _privateObjectOwner;
@@ -1566,3 +1566,17 @@ uint32 CorpseUpdateFieldFlags[CORPSE_END] =
     UF_FLAG_DYNAMIC,                                        // CORPSE_FIELD_DYNAMIC_FLAGS
     UF_FLAG_NONE,                                           // CORPSE_FIELD_PAD
 };
+
+UpdateFieldFlagBlocks::UpdateFieldFlagBlocks(uint32 const* flags, uint32 count) : _blocks((count + 31) / 32)
+{
+    for (uint32 index = 0; index < count; ++index)
+        for (uint32 flag = 0; flag < FLAG_COUNT; ++flag)
+            if (flags[index] & (1u << flag))
+                _blocks[index / 32][flag] |= 1u << (index % 32);
+}
+
+UpdateFieldFlagBlocks const ItemUpdateFieldFlagBlocks(ItemUpdateFieldFlags, CONTAINER_END);
+UpdateFieldFlagBlocks const UnitUpdateFieldFlagBlocks(UnitUpdateFieldFlags, PLAYER_END);
+UpdateFieldFlagBlocks const GameObjectUpdateFieldFlagBlocks(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+UpdateFieldFlagBlocks const DynamicObjectUpdateFieldFlagBlocks(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+UpdateFieldFlagBlocks const CorpseUpdateFieldFlagBlocks(CorpseUpdateFieldFlags, CORPSE_END);
@@ -20,6 +20,9 @@
 
 #include "UpdateFields.h"
 #include "Define.h"
+#include <array>
+#include <bit>
+#include <vector>
 
 enum UpdatefieldFlags
 {
@@ -41,4 +44,33 @@ TC_GAME_API extern uint32 GameObjectUpdateFieldFlags[GAMEOBJECT_END];
 TC_GAME_API extern uint32 DynamicObjectUpdateFieldFlags[DYNAMICOBJECT_END];
 TC_GAME_API extern uint32 CorpseUpdateFieldFlags[CORPSE_END];
 
+// One of the flag arrays above transposed into a packed field mask per UF_FLAG_*,
+// so the fields visible to an observer are collected 32 at a time instead of testing each one
+class TC_GAME_API UpdateFieldFlagBlocks
+{
+public:
+    UpdateFieldFlagBlocks(uint32 const* flags, uint32 count);
+
+    // Fields of block having any of flags
+    uint32 GetFieldsWithFlags(uint32 block, uint32 flags) const
+    {
+        uint32 fields = 0;
+        for (flags &= (1u << FLAG_COUNT) - 1; flags; flags &= flags - 1)
+            fields |= _blocks[block][std::countr_zero(flags)];
+
+        return fields;
+    }
+
+private:
+    static constexpr uint32 FLAG_COUNT = 9;
+
+    std::vector<std::array<uint32, FLAG_COUNT>> _blocks;
+};
+
+TC_GAME_API extern UpdateFieldFlagBlocks const ItemUpdateFieldFlagBlocks;
+TC_GAME_API extern UpdateFieldFlagBlocks const UnitUpdateFieldFlagBlocks;
+TC_GAME_API extern UpdateFieldFlagBlocks const GameObjectUpdateFieldFlagBlocks;
+TC_GAME_API extern UpdateFieldFlagBlocks const DynamicObjectUpdateFieldFlagBlocks;
+TC_GAME_API extern UpdateFieldFlagBlocks const CorpseUpdateFieldFlagBlocks;
+
 #endif // _UPDATEFIELDFLAGS_H
@@ -21,95 +21,137 @@
 #include "UpdateFields.h"
 #include "ByteBuffer.h"
 #include "Errors.h"
+#include <array>
+#include <bit>
 
+// One bit per update field, packed into blocks the same way the client reads the mask
 class UpdateMask
 {
 public:
-    UpdateMask() : _bits(nullptr), _fieldCount(0) { }
+    using BlockType = uint32;
+
+    enum UpdateMaskCount
+    {
+        BLOCK_BITS = sizeof(BlockType) * 8,
+    };
+
+    UpdateMask() : _fieldCount(0), _blockCount(0) { }
 
     void SetBit(uint32 index)
     {
-        _bits[index] = 1;
+        _blocks[GetBlockIndex(index)] |= GetBlockFlag(index);
     }
 
     void UnsetBit(uint32 index)
     {
-        _bits[index] = 0;
+        _blocks[GetBlockIndex(index)] &= ~GetBlockFlag(index);
     }
 
     bool GetBit(uint32 index) const
     {
-        return _bits[index] != 0;
+        return (_blocks[GetBlockIndex(index)] & GetBlockFlag(index)) != 0;
     }
 
     void SetCount(uint32 valuesCount)
     {
-        _bits = std::make_unique<uint8[]>(valuesCount);
-        std::uninitialized_fill_n(&_bits[0], valuesCount, 0);
         _fieldCount = valuesCount;
+        _blockCount = CalculateBlockCount(valuesCount);
+        _blocks = std::make_unique<BlockType[]>(_blockCount);
     }
 
     void Clear()
     {
-        if (_bits)
-            std::fill_n(&_bits[0], _fieldCount, 0);
+        if (_blocks)
+            std::fill_n(&_blocks[0], _blockCount, 0);
+    }
+
+    uint32 GetFieldCount() const { return _fieldCount; }
+    uint32 GetBlockCount() const { return _blockCount; }
+    BlockType GetBlock(uint32 block) const { return _blocks[block]; }
+
+    static constexpr uint32 CalculateBlockCount(uint32 fieldCount)
+    {
+        return (fieldCount + BLOCK_BITS - 1) / BLOCK_BITS;
+    }
+
+    static constexpr uint32 GetBlockIndex(uint32 index)
+    {
+        return index / BLOCK_BITS;
+    }
+
+    static constexpr BlockType GetBlockFlag(uint32 index)
+    {
+        return BlockType(1) << (index % BLOCK_BITS);
+    }
+
+    // Bits of block that belong to fields below fieldCount
+    static constexpr BlockType GetValidBits(uint32 block, uint32 fieldCount)
+    {
+        if (fieldCount >= (block + 1) * BLOCK_BITS)
+            return ~BlockType(0);
+
+        if (fieldCount <= block * BLOCK_BITS)
+            return 0;
+
+        return GetBlockFlag(fieldCount) - 1;
     }
 
 private:
-    std::unique_ptr<uint8[]> _bits;
+    std::unique_ptr<BlockType[]> _blocks;
     uint32 _fieldCount;
+    uint32 _blockCount;
 };
 
+// Mask of the fields written to one values update block, assembled a whole block at a time
 class UpdateMaskPacketBuilder
 {
 public:
     /// Type representing how client reads update mask
-    using ClientUpdateMaskType = uint32;
-
-    enum UpdateMaskCount
-    {
-        CLIENT_UPDATE_MASK_BITS = sizeof(ClientUpdateMaskType) * 8,
-    };
+    using ClientUpdateMaskType = UpdateMask::BlockType;
 
-    explicit UpdateMaskPacketBuilder(uint32 valuesCount) : _lastSetBit(0)
+    explicit UpdateMaskPacketBuilder(uint32 valuesCount) : _fieldCount(valuesCount), _blockCount(UpdateMask::CalculateBlockCount(valuesCount))
     {
-        std::size_t blockCount = CalculateBlockCount(valuesCount);
-        _mask = std::make_unique<ClientUpdateMaskType[]>(blockCount);
-        std::uninitialized_fill_n(&_mask[0], blockCount, 0);
+        ASSERT(_blockCount <= _mask.size());
+        std::fill_n(_mask.begin(), _blockCount, 0);
     }
 
+    uint32 GetBlockCount() const { return _blockCount; }
+
     void SetBit(uint32 bit)
     {
-        _mask[GetBlockIndex(bit)] |= GetBlockFlag(bit);
-        _lastSetBit = bit;
+        _mask[UpdateMask::GetBlockIndex(bit)] |= UpdateMask::GetBlockFlag(bit);
     }
 
-    void AppendToPacket(ByteBuffer* data)
+    void SetBlockBits(uint32 block, ClientUpdateMaskType bits)
     {
-        uint8 blockCount = CalculateBlockCount(_lastSetBit + 1);
-        *data << uint8(blockCount);
-        if (blockCount)
-            data->append(&_mask[0], blockCount);
+        _mask[block] |= bits & UpdateMask::GetValidBits(block, _fieldCount);
     }
 
-private:
-    static constexpr uint8 CalculateBlockCount(uint32 fieldCount)
+    // Trailing empty blocks are not sent, but the client always expects at least one
+    void AppendToPacket(ByteBuffer* data) const
     {
-        return (fieldCount + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS;
-    }
+        uint32 blockCount = _blockCount;
+        while (blockCount > 1 && !_mask[blockCount - 1])
+            --blockCount;
 
-    static constexpr std::size_t GetBlockIndex(uint32 bit)
-    {
-        return bit / 32;
+        *data << uint8(blockCount);
+        data->append(_mask.data(), blockCount);
     }
 
-    static constexpr uint32 GetBlockFlag(uint32 bit)
+    template<class Visitor>
+    void VisitSetBits(Visitor&& visitor) const
     {
-        return 1u << (bit % 32);
+        for (uint32 block = 0; block < _blockCount; ++block)
+        {
+            for (ClientUpdateMaskType bits = _mask[block]; bits; bits &= bits - 1)
+                visitor(uint16(block * UpdateMask::BLOCK_BITS + std::countr_zero(bits)));
+        }
     }
 
-    std::unique_ptr<ClientUpdateMaskType[]> _mask;
-    uint32 _lastSetBit;
+private:
+    std::array<ClientUpdateMaskType, UpdateMask::CalculateBlockCount(PLAYER_END)> _mask;
+    uint32 _fieldCount;
+    uint32 _blockCount;
 };
 
 #endif
@@ -21,6 +21,7 @@
 #include "Common.h"
 #include "DBCStores.h"
 #include "GameObjectAI.h"
+#include "GridNotifiers.h"
 #include "Log.h"
 #include "MapManager.h"
 #include "ObjectMgr.h"
@@ -35,7 +36,7 @@
 Transport::Transport() : GameObject(),
     _transportInfo(nullptr), _isMoving(true), _pendingStop(false),
     _triggeredArrivalEvent(false), _triggeredDepartureEvent(false),
-    _passengerTeleportItr(_passengers.begin()), _delayedAddModel(false), _delayedTeleport(false)
+    _delayedAddModel(false), _delayedTeleport(false)
 {
     m_updateFlag = UPDATEFLAG_TRANSPORT | UPDATEFLAG_LOWGUID | UPDATEFLAG_STATIONARY_POSITION | UPDATEFLAG_ROTATION;
 }
@@ -265,22 +266,7 @@ void Transport::AddPassenger(WorldObject* passenger)
 
 void Transport::RemovePassenger(WorldObject* passenger)
 {
-    bool erased = false;
-    if (_passengerTeleportItr != _passengers.end())
-    {
-        PassengerSet::iterator itr = _passengers.find(passenger);
-        if (itr != _passengers.end())
-        {
-            if (itr == _passengerTeleportItr)
-                ++_passengerTeleportItr;
-
-            _passengers.erase(itr);
-            erased = true;
-        }
-    }
-    else
-        erased = _passengers.erase(passenger) > 0;
-
+    bool erased = _passengers.erase(passenger) > 0;
     if (erased || _staticPassengers.erase(passenger)) // static passenger can remove itself in case of grid unload
     {
         passenger->SetTransport(nullptr);
@@ -663,9 +649,12 @@ void Transport::DelayedTeleportTransport()
           z = _nextFrame->Node->Loc.Z,
           o =_nextFrame->InitialOrientation;
 
-    for (_passengerTeleportItr = _passengers.begin(); _passengerTeleportItr != _passengers.end();)
+    // teleporting a passenger can remove others from the transport
+    PassengerSet passengers = _passengers;
+    for (WorldObject* obj : passengers)
     {
-        WorldObject* obj = (*_passengerTeleportItr++);
+        if (_passengers.find(obj) == _passengers.end())
+            continue;
 
         float destX, destY, destZ, destO;
         obj->m_movementInfo.transport.pos.GetPosition(destX, destY, destZ, destO);
@@ -690,11 +679,12 @@ void Transport::DelayedTeleportTransport()
     GetMap()->AddToMap<Transport>(this);
 }
 
-void Transport::UpdatePassengerPositions(PassengerSet& passengers)
+void Transport::UpdatePassengerPositions(PassengerSet const& passengers)
 {
-    for (PassengerSet::iterator itr = passengers.begin(); itr != passengers.end(); ++itr)
+    // world positions of all passengers are calculated in one pass before any of them is moved on the map
+    _passengerMoves.clear();
+    for (WorldObject* passenger : passengers)
     {
-        WorldObject* passenger = *itr;
         // transport teleported but passenger not yet (can happen for players)
         if (passenger->GetMap() != GetMap())
             continue;
@@ -705,11 +695,21 @@ void Transport::UpdatePassengerPositions(PassengerSet& passengers)
             if (unit->GetVehicle())
                 continue;
 
-        // Do not use Unit::UpdatePosition here, we don't want to remove auras
-        // as if regular movement occurred
         float x, y, z, o;
         passenger->m_movementInfo.transport.pos.GetPosition(x, y, z, o);
         CalculatePassengerPosition(x, y, z, &o);
+        _passengerMoves.push_back({ passenger, Position(x, y, z, o) });
+    }
+
+    _passengerVisibilityUpdates.clear();
+    for (PassengerMove const& move : _passengerMoves)
+    {
+        WorldObject* passenger = move.Passenger;
+
+        // Do not use Unit::UpdatePosition here, we don't want to remove auras
+        // as if regular movement occurred
+        float x, y, z, o;
+        move.Destination.GetPosition(x, y, z, o);
         switch (passenger->GetTypeId())
         {
             case TYPEID_UNIT:
@@ -730,20 +730,37 @@ void Transport::UpdatePassengerPositions(PassengerSet& passengers)
                 }
                 break;
             case TYPEID_GAMEOBJECT:
-                GetMap()->GameObjectRelocation(passenger->ToGameObject(), x, y, z, o, false);
+                GetMap()->GameObjectRelocation(passenger->ToGameObject(), x, y, z, o, false, false);
                 passenger->ToGameObject()->RelocateStationaryPosition(x, y, z, o);
                 break;
             case TYPEID_DYNAMICOBJECT:
-                GetMap()->DynamicObjectRelocation(passenger->ToDynObject(), x, y, z, o);
+                GetMap()->DynamicObjectRelocation(passenger->ToDynObject(), x, y, z, o, false);
                 break;
             default:
                 break;
         }
 
+        // objects changing cells are moved, and their visibility updated, when the map processes its move lists
+        if (passenger->IsGameObject() || passenger->IsDynObject())
+            if (passenger->GetPositionX() == x && passenger->GetPositionY() == y)
+                _passengerVisibilityUpdates.push_back(passenger);
+
         if (Unit* unit = passenger->ToUnit())
             if (Vehicle* vehicle = unit->GetVehicleKit())
                 vehicle->RelocatePassengers();
     }
+
+    // units only flag themselves for the next relocation notify, everything else
+    // updates visibility immediately so do that for all of them with a single grid visit
+    if (_passengerVisibilityUpdates.empty())
+        return;
+
+    float range = 0.0f;
+    for (WorldObject* passenger : _passengerVisibilityUpdates)
+        range = std::max(range, GetExactDist2d(passenger) + passenger->GetVisibilityRange());
+
+    Trinity::VisibleChangesNotifier notifier(_passengerVisibilityUpdates);
+    Cell::VisitWorldObjects(this, notifier, range);
 }
 
 void Transport::DoEventIfAny(KeyFrame const& node, bool departure)
@@ -762,8 +779,9 @@ void Transport::BuildUpdate(UpdateDataMapType& data_map)
     if (players.isEmpty())
         return;
 
+    ValuesUpdateCache valuesCache;
     for (Map::PlayerList::const_iterator itr = players.begin(); itr != players.end(); ++itr)
-        BuildFieldsUpdate(itr->GetSource(), data_map);
+        BuildFieldsUpdate(itr->GetSource(), data_map, &valuesCache);
 
     ClearUpdateMask(true);
 }
@@ -18,6 +18,7 @@
 #ifndef TRANSPORTS_H
 #define TRANSPORTS_H
 
+#include "FlatSet.h"
 #include "GameObject.h"
 #include "TransportMgr.h"
 #include "VehicleDefines.h"
@@ -30,7 +31,7 @@ class TC_GAME_API Transport : public GameObject, public TransportBase
 
         Transport();
     public:
-        typedef std::set<WorldObject*> PassengerSet;
+        typedef Trinity::Containers::FlatSet<WorldObject*> PassengerSet;
 
         ~Transport();
 
@@ -106,7 +107,7 @@ class TC_GAME_API Transport : public GameObject, public TransportBase
         float CalculateSegmentPos(float perc);
         bool TeleportTransport(uint32 newMapid, float x, float y, float z, float o);
         void DelayedTeleportTransport();
-        void UpdatePassengerPositions(PassengerSet& passengers);
+        void UpdatePassengerPositions(PassengerSet const& passengers);
         void DoEventIfAny(KeyFrame const& node, bool departure);
 
         //! Helpers to know if stop frame was reached
@@ -126,9 +127,17 @@ class TC_GAME_API Transport : public GameObject, public TransportBase
         bool _triggeredDepartureEvent;
 
         PassengerSet _passengers;
-        PassengerSet::iterator _passengerTeleportItr;
         PassengerSet _staticPassengers;
 
+        //! Reused by every UpdatePassengerPositions call
+        struct PassengerMove
+        {
+            WorldObject* Passenger;
+            Position Destination;
+        };
+        std::vector<PassengerMove> _passengerMoves;
+        std::vector<WorldObject*> _passengerVisibilityUpdates;
+
         bool _delayedAddModel;
         bool _delayedTeleport;
 };
@@ -835,7 +835,7 @@ class TC_GAME_API Unit : public WorldObject
         bool CanDualWield() const { return m_canDualWield; }
         virtual void SetCanDualWield(bool value) { m_canDualWield = value; }
         float GetCombatReach() const override { return GetFloatValue(UNIT_FIELD_COMBATREACH); }
-        void SetCombatReach(float combatReach) { SetFloatValue(UNIT_FIELD_COMBATREACH, combatReach); }
+        void SetCombatReach(float combatReach) { SetFloatValue(UNIT_FIELD_COMBATREACH, combatReach); UpdateGridCombatReach(combatReach); }
         float GetBoundingRadius() const { return GetFloatValue(UNIT_FIELD_BOUNDINGRADIUS); }
         void SetBoundingRadius(float boundingRadius) { SetFloatValue(UNIT_FIELD_BOUNDINGRADIUS, boundingRadius); }
         bool IsWithinCombatRange(Unit const* obj, float dist2compare) const;
@@ -1778,6 +1778,10 @@ class TC_GAME_API Unit : public WorldObject
         bool HasPendingMovementChange(MovementChangeType changeType) const;
         void PurgeAndApplyPendingMovementChanges(bool informObservers = true);
 
+        // last time a heartbeat of this unit was relayed to every observer, not only the near ones
+        uint32 GetLastFullMovementRelay() const { return m_lastFullMovementRelay; }
+        void SetLastFullMovementRelay(uint32 time) { m_lastFullMovementRelay = time; }
+
         void RewardRage(uint32 damage, uint32 weaponSpeedHitFactor, bool attacker);
 
         virtual float GetFollowAngle() const { return static_cast<float>(M_PI/2); }
@@ -1833,7 +1837,9 @@ class TC_GAME_API Unit : public WorldObject
     protected:
         explicit Unit (bool isWorldObject);
 
-        void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player const* target) const override;
+        void AddForcedUpdateFields(UpdateMaskPacketBuilder& updateMask, uint32 visibleFlag) const override;
+        uint32 GetUpdateFieldValueFor(uint16 index, Player const* target) const override;
+        bool IsUpdateFieldValueTargetDependent(uint16 index) const override;
         void DestroyForPlayer(Player* target, bool onDeath) const override;
 
         void _UpdateSpells(uint32 time);
@@ -1985,6 +1991,7 @@ class TC_GAME_API Unit : public WorldObject
         // when a player controls this unit, and when change is made to this unit which requires an ack from the client to be acted (change of speed for example), this movementCounter is incremented
         uint32 m_movementCounter;
         std::deque<PlayerMovementPendingChange> m_pendingMovementChanges;
+        uint32 m_lastFullMovementRelay;
 
         /* Player Movement fields END*/
 };
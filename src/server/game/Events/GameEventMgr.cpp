@@ -143,6 +143,9 @@ bool GameEventMgr::StartEvent(uint16 event_id, bool overwrite)
             mGameEvent[event_id].start = GameTime::GetGameTime();
             if (data.end <= data.start)
                 data.end = data.start + data.length * MINUTE;
+
+            if (isSystemInit && data.state == GAMEEVENT_NORMAL)
+                ScheduleNextCheck(event_id, GameTime::GetGameTime() + NextCheck(event_id));
         }
 
         // When event is started, set its worldstate to current time
@@ -200,6 +203,9 @@ void GameEventMgr::StopEvent(uint16 event_id, bool overwrite)
         data.start = GameTime::GetGameTime() - data.length * MINUTE;
         if (data.end <= data.start)
             data.end = data.start + data.length * MINUTE;
+
+        if (isSystemInit && data.state == GAMEEVENT_NORMAL)
+            ScheduleNextCheck(event_id, GameTime::GetGameTime() + NextCheck(event_id));
     }
     else if (serverwide_evt)
     {
@@ -437,6 +443,8 @@ void GameEventMgr::LoadFromDB()
 
                 GuidList& crelist = mGameEventCreatureGuids[internal_event_id];
                 crelist.push_back(guid);
+                if (event_id > 0)
+                    mCreatureSpawnEvents[guid].push_back(event_id);
 
                 ++count;
             }
@@ -487,6 +495,8 @@ void GameEventMgr::LoadFromDB()
 
                 GuidList& golist = mGameEventGameobjectGuids[internal_event_id];
                 golist.push_back(guid);
+                if (event_id > 0)
+                    mGameObjectSpawnEvents[guid].push_back(event_id);
 
                 ++count;
             }
@@ -1042,6 +1052,7 @@ void GameEventMgr::Initialize()
         maxEventId++;
 
         mGameEvent.resize(maxEventId);
+        m_EventCheckTimes.resize(maxEventId, 0);
         mGameEventCreatureGuids.resize(maxEventId * 2 - 1);
         mGameEventGameobjectGuids.resize(maxEventId * 2 - 1);
         mGameEventCreatureQuests.resize(maxEventId);
@@ -1057,6 +1068,8 @@ void GameEventMgr::Initialize()
 uint32 GameEventMgr::StartSystem()                           // return the next event delay in ms
 {
     m_ActiveEvents.clear();
+    m_EventSchedule.clear();
+    std::fill(m_EventCheckTimes.begin(), m_EventCheckTimes.end(), 0);
     uint32 delay = Update();
     isSystemInit = true;
     return delay;
@@ -1093,7 +1106,34 @@ uint32 GameEventMgr::Update()                               // return the next e
     uint32 nextEventDelay = max_ge_check_delay;             // 1 day
     uint32 calcDelay;
     std::set<uint16> activate, deactivate;
-    for (uint16 itr = 1; itr < mGameEvent.size(); ++itr)
+
+    // every event is checked once at startup, after that only the due normal events and the unscheduled ones
+    std::vector<uint16> checkedEvents;
+    if (!isSystemInit)
+    {
+        m_UnscheduledEvents.clear();
+        for (uint16 itr = 1; itr < mGameEvent.size(); ++itr)
+        {
+            checkedEvents.push_back(itr);
+            if (mGameEvent[itr].state != GAMEEVENT_NORMAL)
+                m_UnscheduledEvents.push_back(itr);
+        }
+    }
+    else
+    {
+        checkedEvents = m_UnscheduledEvents;
+        while (!m_EventSchedule.empty() && m_EventSchedule.begin()->first <= currenttime)
+        {
+            uint16 eventId = m_EventSchedule.begin()->second;
+            m_EventSchedule.erase(m_EventSchedule.begin());
+            m_EventCheckTimes[eventId] = 0;
+            checkedEvents.push_back(eventId);
+        }
+
+        std::sort(checkedEvents.begin(), checkedEvents.end());
+    }
+
+    for (uint16 itr : checkedEvents)
     {
         // must do the activating first, and after that the deactivating
         // so first queue it
@@ -1143,7 +1183,15 @@ uint32 GameEventMgr::Update()                               // return the next e
         calcDelay = NextCheck(itr);
         if (calcDelay < nextEventDelay)
             nextEventDelay = calcDelay;
+
+        if (mGameEvent[itr].state == GAMEEVENT_NORMAL)
+            ScheduleNextCheck(itr, currenttime + calcDelay);
     }
+
+    // normal events that were not due keep their place in the schedule
+    if (!m_EventSchedule.empty())
+        nextEventDelay = std::min(nextEventDelay, uint32(std::max<time_t>(m_EventSchedule.begin()->first - currenttime, 0)));
+
     // now activate the queue
     // a now activated event can contain a spawn of a to-be-deactivated one
     // following the activate - deactivate order, deactivating the first event later will leave the spawn in (wont disappear then reappear clientside)
@@ -1159,6 +1207,15 @@ uint32 GameEventMgr::Update()                               // return the next e
     return (nextEventDelay + 1) * IN_MILLISECONDS;           // Add 1 second to be sure event has started/stopped at next call
 }
 
+void GameEventMgr::ScheduleNextCheck(uint16 event_id, time_t checkTime)
+{
+    if (m_EventCheckTimes[event_id])
+        m_EventSchedule.erase({ m_EventCheckTimes[event_id], event_id });
+
+    m_EventCheckTimes[event_id] = checkTime;
+    m_EventSchedule.emplace(checkTime, event_id);
+}
+
 void GameEventMgr::UnApplyEvent(uint16 event_id)
 {
     TC_LOG_INFO("gameevent", "GameEvent {} \"{}\" removed.", event_id, mGameEvent[event_id].description);
@@ -1279,67 +1336,47 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
         return;
     }
 
+    if (internal_event_id >= int32(mGameEventGameobjectGuids.size()))
+    {
+        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventSpawn attempted access to out of range mGameEventGameobjectGuids element {} (size: {}).",
+            internal_event_id, mGameEventGameobjectGuids.size());
+        return;
+    }
+
+    if (internal_event_id >= int32(mGameEventPoolIds.size()))
+    {
+        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventSpawn attempted access to out of range mGameEventPoolIds element {} (size: {}).",
+            internal_event_id, mGameEventPoolIds.size());
+        return;
+    }
+
+    // the objects themselves are created by the maps in their own updates
+    std::unordered_map<uint32 /*mapId*/, std::vector<Map::GameEventSpawnChange>> changesByMap;
+
     for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
     {
         // Add to correct cell
         if (CreatureData const* data = sObjectMgr->GetCreatureData(*itr))
         {
             sObjectMgr->AddCreatureToGrid(*itr, data);
-
-            // Spawn if necessary (loaded grids only)
-            Map* map = sMapMgr->CreateBaseMap(data->mapId);
-            map->RemoveRespawnTime(SPAWN_TYPE_CREATURE, *itr);
-            // We use spawn coords to spawn
-            if (!map->Instanceable() && map->IsGridLoaded(data->spawnPoint))
-            {
-                Creature* creature = new Creature();
-                //TC_LOG_DEBUG("misc", "Spawning creature {}", *itr);
-                if (!creature->LoadFromDB(*itr, map, true, false))
-                    delete creature;
-            }
+            changesByMap[data->mapId].push_back({ SPAWN_TYPE_CREATURE, *itr, true });
         }
     }
 
-    if (internal_event_id >= int32(mGameEventGameobjectGuids.size()))
-    {
-        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventSpawn attempted access to out of range mGameEventGameobjectGuids element {} (size: {}).",
-            internal_event_id, mGameEventGameobjectGuids.size());
-        return;
-    }
-
     for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
     {
         // Add to correct cell
         if (GameObjectData const* data = sObjectMgr->GetGameObjectData(*itr))
         {
             sObjectMgr->AddGameobjectToGrid(*itr, data);
-            // Spawn if necessary (loaded grids only)
-            // this base map checked as non-instanced and then only existed
-            Map* map = sMapMgr->CreateBaseMap(data->mapId);
-            map->RemoveRespawnTime(SPAWN_TYPE_GAMEOBJECT, *itr);
-            // We use current coords to unspawn, not spawn coords since creature can have changed grid
-            if (!map->Instanceable() && map->IsGridLoaded(data->spawnPoint))
-            {
-                GameObject* pGameobject = new GameObject;
-                //TC_LOG_DEBUG("misc", "Spawning gameobject {}", *itr);
-                /// @todo find out when it is add to map
-                if (!pGameobject->LoadFromDB(*itr, map, false))
-                    delete pGameobject;
-                else
-                {
-                    if (pGameobject->isSpawnedByDefault())
-                        map->AddToMap(pGameobject);
-                }
-            }
+            changesByMap[data->mapId].push_back({ SPAWN_TYPE_GAMEOBJECT, *itr, true });
         }
     }
 
-    if (internal_event_id >= int32(mGameEventPoolIds.size()))
-    {
-        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventSpawn attempted access to out of range mGameEventPoolIds element {} (size: {}).",
-            internal_event_id, mGameEventPoolIds.size());
-        return;
-    }
+    // Spawn if necessary (loaded grids only)
+    // this base map checked as non-instanced and then only existed
+    for (auto& [mapId, changes] : changesByMap)
+        sMapMgr->CreateBaseMap(mapId)->QueueGameEventSpawnChanges(std::move(changes));
 
     for (IdList::iterator itr = mGameEventPoolIds[internal_event_id].begin(); itr != mGameEventPoolIds[internal_event_id].end(); ++itr)
         sPoolMgr->SpawnPool(*itr);
@@ -1356,6 +1393,22 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         return;
     }
 
+    if (internal_event_id >= int32(mGameEventGameobjectGuids.size()))
+    {
+        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventUnspawn attempted access to out of range mGameEventGameobjectGuids element {} (size: {}).",
+            internal_event_id, mGameEventGameobjectGuids.size());
+        return;
+    }
+
+    if (internal_event_id >= int32(mGameEventPoolIds.size()))
+    {
+        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventUnspawn attempted access to out of range mGameEventPoolIds element {} (size: {}).", internal_event_id, mGameEventPoolIds.size());
+        return;
+    }
+
+    // the objects themselves are removed by the maps in their own updates
+    std::unordered_map<uint32 /*mapId*/, std::vector<Map::GameEventSpawnChange>> changesByMap;
+
     for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin(); itr != mGameEventCreatureGuids[internal_event_id].end(); ++itr)
     {
         // check if it's needed by another event, if so, don't remove
@@ -1365,28 +1418,10 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         if (CreatureData const* data = sObjectMgr->GetCreatureData(*itr))
         {
             sObjectMgr->RemoveCreatureFromGrid(*itr, data);
-
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr](Map* map)
-            {
-                map->RemoveRespawnTime(SPAWN_TYPE_CREATURE, *itr);
-                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = creatureBounds.first; itr2 != creatureBounds.second;)
-                {
-                    Creature* creature = itr2->second;
-                    ++itr2;
-                    creature->AddObjectToRemoveList();
-                }
-            });
+            changesByMap[data->mapId].push_back({ SPAWN_TYPE_CREATURE, *itr, false });
         }
     }
 
-    if (internal_event_id < 0 || internal_event_id >= int32(mGameEventGameobjectGuids.size()))
-    {
-        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventUnspawn attempted access to out of range mGameEventGameobjectGuids element {} (size: {}).",
-            internal_event_id, mGameEventGameobjectGuids.size());
-        return;
-    }
-
     for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin(); itr != mGameEventGameobjectGuids[internal_event_id].end(); ++itr)
     {
         // check if it's needed by another event, if so, don't remove
@@ -1396,24 +1431,16 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
         if (GameObjectData const* data = sObjectMgr->GetGameObjectData(*itr))
         {
             sObjectMgr->RemoveGameobjectFromGrid(*itr, data);
-
-            sMapMgr->DoForAllMapsWithMapId(data->mapId, [&itr](Map* map)
-            {
-                map->RemoveRespawnTime(SPAWN_TYPE_GAMEOBJECT, *itr);
-                auto gameobjectBounds = map->GetGameObjectBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = gameobjectBounds.first; itr2 != gameobjectBounds.second;)
-                {
-                    GameObject* go = itr2->second;
-                    ++itr2;
-                    go->AddObjectToRemoveList();
-                }
-            });
+            changesByMap[data->mapId].push_back({ SPAWN_TYPE_GAMEOBJECT, *itr, false });
         }
     }
-    if (internal_event_id < 0 || internal_event_id >= int32(mGameEventPoolIds.size()))
+
+    for (auto const& [mapId, changes] : changesByMap)
     {
-        TC_LOG_ERROR("gameevent", "GameEventMgr::GameEventUnspawn attempted access to out of range mGameEventPoolIds element {} (size: {}).", internal_event_id, mGameEventPoolIds.size());
-        return;
+        sMapMgr->DoForAllMapsWithMapId(mapId, [&changes](Map* map)
+        {
+            map->QueueGameEventSpawnChanges(std::vector<Map::GameEventSpawnChange>(changes));
+        });
     }
 
     for (IdList::iterator itr = mGameEventPoolIds[internal_event_id].begin(); itr != mGameEventPoolIds[internal_event_id].end(); ++itr)
@@ -1509,35 +1536,19 @@ bool GameEventMgr::hasGameObjectQuestActiveEventExcept(uint32 quest_id, uint16 e
 }
 bool GameEventMgr::hasCreatureActiveEventExcept(ObjectGuid::LowType creature_id, uint16 event_id)
 {
-    for (ActiveEvents::iterator e_itr = m_ActiveEvents.begin(); e_itr != m_ActiveEvents.end(); ++e_itr)
-    {
-        if ((*e_itr) != event_id)
-        {
-            int32 internal_event_id = mGameEvent.size() + (*e_itr) - 1;
-            for (GuidList::iterator itr = mGameEventCreatureGuids[internal_event_id].begin();
-                itr != mGameEventCreatureGuids[internal_event_id].end();
-                ++ itr)
-                if (*itr == creature_id)
-                    return true;
-        }
-    }
-    return false;
+    auto itr = mCreatureSpawnEvents.find(creature_id);
+    if (itr == mCreatureSpawnEvents.end())
+        return false;
+
+    return std::any_of(itr->second.begin(), itr->second.end(), [this, event_id](uint16 spawnEventId) { return spawnEventId != event_id && IsActiveEvent(spawnEventId); });
 }
 bool GameEventMgr::hasGameObjectActiveEventExcept(ObjectGuid::LowType go_id, uint16 event_id)
 {
-    for (ActiveEvents::iterator e_itr = m_ActiveEvents.begin(); e_itr != m_ActiveEvents.end(); ++e_itr)
-    {
-        if ((*e_itr) != event_id)
-        {
-            int32 internal_event_id = mGameEvent.size() + (*e_itr) - 1;
-            for (GuidList::iterator itr = mGameEventGameobjectGuids[internal_event_id].begin();
-                itr != mGameEventGameobjectGuids[internal_event_id].end();
-                ++ itr)
-                if (*itr == go_id)
-                    return true;
-        }
-    }
-    return false;
+    auto itr = mGameObjectSpawnEvents.find(go_id);
+    if (itr == mGameObjectSpawnEvents.end())
+        return false;
+
+    return std::any_of(itr->second.begin(), itr->second.end(), [this, event_id](uint16 spawnEventId) { return spawnEventId != event_id && IsActiveEvent(spawnEventId); });
 }
 
 void GameEventMgr::UpdateEventQuests(uint16 event_id, bool activate)
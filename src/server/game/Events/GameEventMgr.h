@@ -148,6 +148,7 @@ class TC_GAME_API GameEventMgr
         bool hasCreatureActiveEventExcept(ObjectGuid::LowType creature_guid, uint16 event_id);
         bool hasGameObjectActiveEventExcept(ObjectGuid::LowType go_guid, uint16 event_id);
         void SetHolidayEventTime(GameEventData& event);
+        void ScheduleNextCheck(uint16 event_id, time_t checkTime);
 
         typedef std::list<ObjectGuid::LowType> GuidList;
         typedef std::list<uint32> IdList;
@@ -180,6 +181,16 @@ class TC_GAME_API GameEventMgr
         ActiveEvents m_ActiveEvents;
         bool isSystemInit;
 
+        // normal events change only at the times NextCheck returns, so they are checked when due in this schedule;
+        // world and internal events depend on other events and quest progress and are checked on every update
+        std::set<std::pair<time_t /*check time*/, uint16 /*event id*/>> m_EventSchedule;
+        std::vector<time_t> m_EventCheckTimes;      // scheduled check time of each normal event, 0 if none
+        std::vector<uint16> m_UnscheduledEvents;
+
+        // positive events spawning each creature or gameobject, for the active event checks on unspawn
+        std::unordered_map<ObjectGuid::LowType, std::vector<uint16>> mCreatureSpawnEvents;
+        std::unordered_map<ObjectGuid::LowType, std::vector<uint16>> mGameObjectSpawnEvents;
+
     public:
         GameEventGuidMap  mGameEventCreatureGuids;
         GameEventGuidMap  mGameEventGameobjectGuids;
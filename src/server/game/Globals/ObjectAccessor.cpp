@@ -19,6 +19,7 @@
 #include "Corpse.h"
 #include "Creature.h"
 #include "DynamicObject.h"
+#include "EpochReclaimer.h"
 #include "GameObject.h"
 #include "GridNotifiers.h"
 #include "Item.h"
@@ -40,6 +41,7 @@ void HashMapHolder<T>::Insert(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer()[o->GetGUID()] = o;
+    GetLookupTable().Insert(o->GetGUID().GetRawValue(), o);
 }
 
 template<class T>
@@ -48,15 +50,13 @@ void HashMapHolder<T>::Remove(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer().erase(o->GetGUID());
+    GetLookupTable().Remove(o->GetGUID().GetRawValue());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
-
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    return GetLookupTable().Find(guid.GetRawValue());
 }
 
 template<class T>
@@ -73,6 +73,13 @@ std::shared_mutex* HashMapHolder<T>::GetLock()
     return &_lock;
 }
 
+template<class T>
+Trinity::Containers::ConcurrentLookupTable<T>& HashMapHolder<T>::GetLookupTable()
+{
+    static Trinity::Containers::ConcurrentLookupTable<T> _lookupTable(1024);
+    return _lookupTable;
+}
+
 HashMapHolder<Player>::MapType const& ObjectAccessor::GetPlayers()
 {
     return HashMapHolder<Player>::GetContainer();
@@ -83,17 +90,72 @@ template class TC_GAME_API HashMapHolder<Transport>;
 
 namespace PlayerNameMapHolder
 {
-    typedef std::unordered_map<std::string, Player*> MapType;
+    // immutable once published, readers only compare against the name stored with the player pointer
+    struct NameEntry
+    {
+        NameEntry(std::string const& name, Player* player) : Name(name), Owner(player) { }
+
+        std::string const Name;
+        Player* const Owner;
+    };
+
+    struct RetiredEntry
+    {
+        NameEntry* Entry;
+        uint64 Epoch;
+    };
+
+    typedef std::unordered_map<std::string, NameEntry*> MapType;
+
+    // writer side view, only accessed with HashMapHolder<Player>::GetLock() held exclusively
     static MapType PlayerNameMap;
 
+    // reader side view keyed by name hash, collisions are resolved by comparing the stored name
+    static Trinity::Containers::ConcurrentLookupTable<NameEntry> PlayerNameLookup(1024);
+
+    // entries unlinked from the lookup table, freed once no reader can still see them
+    static std::vector<RetiredEntry> RetiredEntries;
+
+    static uint64 GetNameKey(std::string const& name)
+    {
+        // 0 marks empty slots in the lookup table
+        return std::max<uint64>(std::hash<std::string>()(name), 1);
+    }
+
+    static void Retire(std::string const& name, NameEntry* entry)
+    {
+        PlayerNameLookup.Remove(GetNameKey(name), entry);
+        RetiredEntries.push_back({ entry, Trinity::Epoch::Retire() });
+
+        auto reclaimed = std::find_if(RetiredEntries.begin(), RetiredEntries.end(), [](RetiredEntry const& retired)
+        {
+            return !Trinity::Epoch::CanReclaim(retired.Epoch);
+        });
+
+        for (auto itr = RetiredEntries.begin(); itr != reclaimed; ++itr)
+            delete itr->Entry;
+
+        RetiredEntries.erase(RetiredEntries.begin(), reclaimed);
+    }
+
     void Insert(Player* p)
     {
-        PlayerNameMap[p->GetName()] = p;
+        NameEntry*& stored = PlayerNameMap[p->GetName()];
+        if (stored)
+            Retire(p->GetName(), stored);
+
+        stored = new NameEntry(p->GetName(), p);
+        PlayerNameLookup.Add(GetNameKey(stored->Name), stored);
     }
 
     void Remove(Player* p)
     {
-        PlayerNameMap.erase(p->GetName());
+        auto itr = PlayerNameMap.find(p->GetName());
+        if (itr == PlayerNameMap.end())
+            return;
+
+        Retire(itr->first, itr->second);
+        PlayerNameMap.erase(itr);
     }
 
     Player* Find(std::string_view name)
@@ -102,8 +164,18 @@ namespace PlayerNameMapHolder
         if (!normalizePlayerName(charName))
             return nullptr;
 
-        auto itr = PlayerNameMap.find(charName);
-        return (itr != PlayerNameMap.end()) ? itr->second : nullptr;
+        // the entry may be retired as soon as the lookup returns, read it while the lookup still guards it
+        Player* player = nullptr;
+        PlayerNameLookup.Find(GetNameKey(charName), [&charName, &player](NameEntry const* entry)
+        {
+            if (entry->Name != charName)
+                return false;
+
+            player = entry->Owner;
+            return true;
+        });
+
+        return player;
     }
 } // namespace PlayerNameMapHolder
 
@@ -277,6 +349,8 @@ template<>
 void ObjectAccessor::AddObject(Player* player)
 {
     HashMapHolder<Player>::Insert(player);
+
+    std::unique_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
     PlayerNameMapHolder::Insert(player);
 }
 
@@ -284,5 +358,7 @@ template<>
 void ObjectAccessor::RemoveObject(Player* player)
 {
     HashMapHolder<Player>::Remove(player);
+
+    std::unique_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
     PlayerNameMapHolder::Remove(player);
 }
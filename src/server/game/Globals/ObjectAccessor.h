@@ -18,6 +18,7 @@
 #ifndef TRINITY_OBJECTACCESSOR_H
 #define TRINITY_OBJECTACCESSOR_H
 
+#include "ConcurrentLookupTable.h"
 #include "ObjectGuid.h"
 #include <shared_mutex>
 #include <unordered_map>
@@ -52,7 +53,11 @@ public:
 
     static MapType& GetContainer();
 
+    // guards GetContainer() and writers, Find() does not take it
     static std::shared_mutex* GetLock();
+
+private:
+    static Trinity::Containers::ConcurrentLookupTable<T>& GetLookupTable();
 };
 
 namespace ObjectAccessor
@@ -0,0 +1,123 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridPositionIndex.h"
+#include "Errors.h"
+#include "Object.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TRINITY_GRID_POSITION_INDEX_SSE2
+#include <emmintrin.h>
+#endif
+
+GridPositionIndex::~GridPositionIndex()
+{
+    for (WorldObject* object : _objects)
+        object->m_gridPositions = nullptr;
+}
+
+void GridPositionIndex::Insert(WorldObject* object)
+{
+    ASSERT(!object->m_gridPositions);
+
+    object->m_gridPositions = this;
+    object->m_gridPositionSlot = GetSize();
+
+    _x.push_back(object->GetPositionX());
+    _y.push_back(object->GetPositionY());
+    _combatReach.push_back(object->GetCombatReach());
+    _phaseMask.push_back(object->GetPhaseMask());
+    _objects.push_back(object);
+}
+
+void GridPositionIndex::Remove(WorldObject* object)
+{
+    GridPositionIndex* index = object->m_gridPositions;
+    if (!index)
+        return;
+
+    uint32 slot = object->m_gridPositionSlot;
+    uint32 last = index->GetSize() - 1;
+    ASSERT(slot <= last && index->_objects[slot] == object);
+
+    if (slot != last)
+    {
+        index->_x[slot] = index->_x[last];
+        index->_y[slot] = index->_y[last];
+        index->_combatReach[slot] = index->_combatReach[last];
+        index->_phaseMask[slot] = index->_phaseMask[last];
+        index->_objects[slot] = index->_objects[last];
+        index->_objects[slot]->m_gridPositionSlot = slot;
+    }
+
+    index->_x.pop_back();
+    index->_y.pop_back();
+    index->_combatReach.pop_back();
+    index->_phaseMask.pop_back();
+    index->_objects.pop_back();
+
+    object->m_gridPositions = nullptr;
+}
+
+uint64 GridPositionIndex::MatchBlock(uint32 begin, GridSearchArea const& area, uint32 phaseMask, bool filterPhase) const
+{
+    uint32 const end = std::min(begin + BlockSize, GetSize());
+    float const range = area.Range + SearchSlack;
+    uint64 matches = 0;
+    uint32 i = begin;
+
+#ifdef TRINITY_GRID_POSITION_INDEX_SSE2
+    __m128 const centerX = _mm_set1_ps(area.X);
+    __m128 const centerY = _mm_set1_ps(area.Y);
+    __m128 const searchRange = _mm_set1_ps(range);
+    __m128i const searchPhase = _mm_set1_epi32(filterPhase ? int32(phaseMask) : -1);
+    __m128i const zero = _mm_setzero_si128();
+
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(&_x[i]), centerX);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(&_y[i]), centerY);
+        __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 maxDist = _mm_add_ps(_mm_loadu_ps(&_combatReach[i]), searchRange);
+        int inRange = _mm_movemask_ps(_mm_cmple_ps(distSq, _mm_mul_ps(maxDist, maxDist)));
+
+        int outOfPhase = 0;
+        if (filterPhase)
+        {
+            __m128i phase = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(&_phaseMask[i])), searchPhase);
+            outOfPhase = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(phase, zero)));
+        }
+
+        matches |= uint64(inRange & ~outOfPhase) << (i - begin);
+    }
+#endif
+
+    for (; i < end; ++i)
+    {
+        if (filterPhase && !(_phaseMask[i] & phaseMask))
+            continue;
+
+        float dx = _x[i] - area.X;
+        float dy = _y[i] - area.Y;
+        float maxDist = _combatReach[i] + range;
+        if (dx * dx + dy * dy <= maxDist * maxDist)
+            matches |= uint64(1) << (i - begin);
+    }
+
+    return matches;
+}
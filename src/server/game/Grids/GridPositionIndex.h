@@ -0,0 +1,103 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_GRIDPOSITIONINDEX_H
+#define TRINITY_GRIDPOSITIONINDEX_H
+
+#include "Define.h"
+#include "Optional.h"
+#include <bit>
+#include <vector>
+
+class WorldObject;
+
+// Circle on the map plane a grid search is limited to, target combat reach is added by the index
+struct GridSearchArea
+{
+    float X;
+    float Y;
+    float Range;
+};
+
+/*
+ * Structure-of-arrays copy of the map plane positions, combat reach and phase masks of all objects
+ * linked into one grid container. Range searches filter a whole block of entries with
+ * vector compares before any object is dereferenced, so only the candidates that may
+ * pass the search check are touched.
+ * Entries are kept in sync by WorldObject::Relocate, WorldObject::SetPhaseMask and Unit::SetCombatReach.
+ */
+class TC_GAME_API GridPositionIndex
+{
+public:
+    static constexpr uint32 BlockSize = 64;
+
+    // Added to every search range to absorb float rounding and transport passenger offsets
+    static constexpr float SearchSlack = 0.5f;
+
+    GridPositionIndex() = default;
+    ~GridPositionIndex();
+
+    GridPositionIndex(GridPositionIndex const&) = delete;
+    GridPositionIndex(GridPositionIndex&&) = delete;
+    GridPositionIndex& operator=(GridPositionIndex const&) = delete;
+    GridPositionIndex& operator=(GridPositionIndex&&) = delete;
+
+    void Insert(WorldObject* object);
+    static void Remove(WorldObject* object);
+
+    void UpdatePosition(uint32 slot, float x, float y)
+    {
+        _x[slot] = x;
+        _y[slot] = y;
+    }
+
+    void UpdatePhaseMask(uint32 slot, uint32 phaseMask) { _phaseMask[slot] = phaseMask; }
+    void UpdateCombatReach(uint32 slot, float combatReach) { _combatReach[slot] = combatReach; }
+
+    uint32 GetSize() const { return uint32(_objects.size()); }
+    bool IsEmpty() const { return _objects.empty(); }
+
+    // Calls visitor(WorldObject*) for every entry within area (entry combat reach included) sharing a phase with phaseMask
+    // Unset phaseMask skips the phase test, visitor returns false to stop the search
+    template<class Visitor>
+    void VisitInRange(GridSearchArea const& area, Optional<uint32> phaseMask, Visitor&& visitor) const
+    {
+        for (uint32 begin = 0; begin < GetSize(); begin += BlockSize)
+        {
+            uint64 matches = MatchBlock(begin, area, phaseMask.value_or(0), phaseMask.has_value());
+            while (matches)
+            {
+                uint32 slot = begin + std::countr_zero(matches);
+                matches &= matches - 1;
+                if (!visitor(_objects[slot]))
+                    return;
+            }
+        }
+    }
+
+private:
+    // Bit N of the result is set when entry begin + N passes the range and phase tests
+    uint64 MatchBlock(uint32 begin, GridSearchArea const& area, uint32 phaseMask, bool filterPhase) const;
+
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _combatReach;
+    std::vector<uint32> _phaseMask;
+    std::vector<WorldObject*> _objects;
+};
+
+#endif // TRINITY_GRIDPOSITIONINDEX_H
@@ -89,18 +89,22 @@ void VisibleChangesNotifier::Visit(PlayerMapType &m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
-        if (iter->GetSource() == &i_object)
-            continue;
+        Player* player = iter->GetSource();
+        for (WorldObject* object : i_objects)
+        {
+            if (player == object)
+                continue;
 
-        iter->GetSource()->UpdateVisibilityOf(&i_object);
+            player->UpdateVisibilityOf(object);
 
-        if (iter->GetSource()->HasSharedVision())
-        {
-            for (SharedVisionList::const_iterator i = iter->GetSource()->GetSharedVisionList().begin();
-                i != iter->GetSource()->GetSharedVisionList().end(); ++i)
+            if (player->HasSharedVision())
             {
-                if ((*i)->m_seer == iter->GetSource())
-                    (*i)->UpdateVisibilityOf(&i_object);
+                for (SharedVisionList::const_iterator i = player->GetSharedVisionList().begin();
+                    i != player->GetSharedVisionList().end(); ++i)
+                {
+                    if ((*i)->m_seer == player)
+                        (*i)->UpdateVisibilityOf(object);
+                }
             }
         }
     }
@@ -113,7 +117,8 @@ void VisibleChangesNotifier::Visit(CreatureMapType &m)
             for (SharedVisionList::const_iterator i = iter->GetSource()->GetSharedVisionList().begin();
                 i != iter->GetSource()->GetSharedVisionList().end(); ++i)
                 if ((*i)->m_seer == iter->GetSource())
-                    (*i)->UpdateVisibilityOf(&i_object);
+                    for (WorldObject* object : i_objects)
+                        (*i)->UpdateVisibilityOf(object);
 }
 
 void VisibleChangesNotifier::Visit(DynamicObjectMapType &m)
@@ -122,7 +127,8 @@ void VisibleChangesNotifier::Visit(DynamicObjectMapType &m)
         if (Unit* caster = iter->GetSource()->GetCaster())
             if (Player* player = caster->ToPlayer())
                 if (player->m_seer == iter->GetSource())
-                    player->UpdateVisibilityOf(&i_object);
+                    for (WorldObject* object : i_objects)
+                        player->UpdateVisibilityOf(object);
 }
 
 inline void CreatureUnitRelocationWorker(Creature* c, Unit* u)
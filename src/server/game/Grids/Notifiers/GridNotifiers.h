@@ -29,6 +29,8 @@
 #include "SpellInfo.h"
 #include "UnitAI.h"
 #include "UpdateData.h"
+#include <concepts>
+#include <span>
 
 namespace Trinity
 {
@@ -55,9 +57,17 @@ namespace Trinity
 
     struct VisibleChangesNotifier
     {
-        WorldObject &i_object;
+        std::span<WorldObject* const> i_objects;
+        WorldObject* i_object;
+
+        explicit VisibleChangesNotifier(WorldObject &object) : i_objects(&i_object, 1), i_object(&object) { }
+
+        // one visit for several objects that are close to each other, like the passengers of a transport
+        explicit VisibleChangesNotifier(std::span<WorldObject* const> objects) : i_objects(objects), i_object(nullptr) { }
+
+        VisibleChangesNotifier(VisibleChangesNotifier const&) = delete;
+        VisibleChangesNotifier& operator=(VisibleChangesNotifier const&) = delete;
 
-        explicit VisibleChangesNotifier(WorldObject &object) : i_object(object) { }
         template<class T> void Visit(GridRefManager<T> &) { }
         void Visit(PlayerMapType &);
         void Visit(CreatureMapType &);
@@ -206,6 +216,18 @@ namespace Trinity
         Return
     };
 
+    // Checks limited to a circle on the map plane can expose it, searchers then only test the
+    // unit candidates the cell position index returns for that circle instead of every unit in the cell
+    template<typename Check>
+    concept CheckWithSearchArea = requires(Check const& check)
+    {
+        { check.GetSearchArea() } -> std::same_as<Optional<GridSearchArea>>;
+    };
+
+    // Calls visitor(T*) for every object of m sharing a phase with phaseMask that may pass check, until visitor returns false
+    template<class T, class Check, class Visitor>
+    void VisitSearchCandidates(GridRefManager<T>& m, Check const& check, Optional<uint32> phaseMask, Visitor&& visitor);
+
     template<typename Type>
     class SearcherFirstObjectResult
     {
@@ -965,6 +987,8 @@ namespace Trinity
                 return false;
             }
 
+            Optional<GridSearchArea> GetSearchArea() const { return GridSearchArea{ i_obj->GetPositionX(), i_obj->GetPositionY(), i_range + i_obj->GetCombatReach() }; }
+
         private:
             WorldObject const* i_obj;
             Unit const* i_funit;
@@ -1028,6 +1052,11 @@ namespace Trinity
                 return !i_playerOnly || u->GetTypeId() == TYPEID_PLAYER;
             }
 
+            Optional<GridSearchArea> GetSearchArea() const
+            {
+                return GridSearchArea{ i_obj->GetPositionX(), i_obj->GetPositionY(), i_range + (i_incOwnRadius ? i_obj->GetCombatReach() : 0.0f) };
+            }
+
         private:
             WorldObject const* i_obj;
             Unit const* i_funit;
@@ -1094,6 +1123,8 @@ namespace Trinity
                 return false;
             }
 
+            Optional<GridSearchArea> GetSearchArea() const { return GridSearchArea{ i_obj->GetPositionX(), i_obj->GetPositionY(), i_range + i_obj->GetCombatReach() }; }
+
         private:
             WorldObject const* i_obj;
             float i_range;
@@ -1155,6 +1186,11 @@ namespace Trinity
                 return u->IsInMap(i_obj) && u->InSamePhase(i_obj) && u->IsWithinDoubleVerticalCylinder(i_obj, searchRadius, searchRadius);
             }
 
+            Optional<GridSearchArea> GetSearchArea() const
+            {
+                return GridSearchArea{ i_obj->GetPositionX(), i_obj->GetPositionY(), i_range + (i_incOwnRadius ? i_obj->GetCombatReach() : 0.0f) };
+            }
+
         private:
             WorldObject const* i_obj;
             Unit const* i_funit;
@@ -1520,6 +1556,8 @@ namespace Trinity
                 return true;
             }
 
+            Optional<GridSearchArea> GetSearchArea() const { return GridSearchArea{ _obj->GetPositionX(), _obj->GetPositionY(), _range + _obj->GetCombatReach() }; }
+
         private:
             WorldObject const* _obj;
             float _range;
@@ -1629,6 +1667,14 @@ namespace Trinity
                 return true;
             }
 
+            Optional<GridSearchArea> GetSearchArea() const
+            {
+                if (m_fRange <= 0.0f)
+                    return {};
+
+                return GridSearchArea{ m_pObject->GetPositionX(), m_pObject->GetPositionY(), m_fRange + m_pObject->GetCombatReach() };
+            }
+
         private:
             WorldObject const* m_pObject;
             uint32 m_uiEntry;
@@ -39,6 +39,32 @@ inline void Trinity::VisibleNotifier::Visit(GridRefManager<T> &m)
 
 // SEARCHERS & LIST SEARCHERS & WORKERS
 
+template<class T, class Check, class Visitor>
+void Trinity::VisitSearchCandidates(GridRefManager<T>& m, Check const& check, Optional<uint32> phaseMask, Visitor&& visitor)
+{
+    // combat reach only bounds the extent of units, other objects (gameobject models) always take the full walk
+    if constexpr (CheckWithSearchArea<Check> && (std::is_same_v<T, Creature> || std::is_same_v<T, Player>))
+    {
+        if (Optional<GridSearchArea> area = check.GetSearchArea())
+        {
+            m.GetPositions().VisitInRange(*area, phaseMask, [&](WorldObject* object)
+            {
+                return visitor(static_cast<T*>(object));
+            });
+            return;
+        }
+    }
+
+    for (GridReference<T> const& ref : m)
+    {
+        if (phaseMask && !ref.GetSource()->InSamePhase(*phaseMask))
+            continue;
+
+        if (!visitor(ref.GetSource()))
+            return;
+    }
+}
+
 // WorldObject searchers & workers
 
 template <class Check, class Result>
@@ -51,16 +77,14 @@ void Trinity::WorldObjectSearcherBase<Check, Result>::Visit(GridRefManager<T>& m
     if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
         return;
 
-    for (GridReference<T> const& ref : m)
+    VisitSearchCandidates(m, i_check, {}, [this](T* object)
     {
-        if (i_check(ref.GetSource()))
-        {
-            this->Insert(ref.GetSource());
+        if (!i_check(object))
+            return true;
 
-            if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
-                return;
-        }
-    }
+        this->Insert(object);
+        return this->ShouldContinue() != WorldObjectSearcherContinuation::Return;
+    });
 }
 
 // Gameobject searchers
@@ -71,19 +95,14 @@ void Trinity::GameObjectSearcherBase<Check, Result>::Visit(GameObjectMapType& m)
     if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
         return;
 
-    for (GridReference<GameObject> const& ref : m)
+    VisitSearchCandidates(m, i_check, i_phaseMask, [this](GameObject* object)
     {
-        if (!ref.GetSource()->InSamePhase(i_phaseMask))
-            continue;
-
-        if (i_check(ref.GetSource()))
-        {
-            this->Insert(ref.GetSource());
+        if (!i_check(object))
+            return true;
 
-            if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
-                return;
-        }
-    }
+        this->Insert(object);
+        return this->ShouldContinue() != WorldObjectSearcherContinuation::Return;
+    });
 }
 
 // Unit searchers
@@ -95,19 +114,14 @@ void Trinity::UnitSearcherBase<Check, Result>::VisitImpl(GridRefManager<T>& m)
     if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
         return;
 
-    for (GridReference<T> const& ref : m)
+    VisitSearchCandidates(m, i_check, i_phaseMask, [this](T* object)
     {
-        if (!ref.GetSource()->InSamePhase(i_phaseMask))
-            continue;
+        if (!i_check(object))
+            return true;
 
-        if (i_check(ref.GetSource()))
-        {
-            this->Insert(ref.GetSource());
-
-            if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
-                return;
-        }
-    }
+        this->Insert(object);
+        return this->ShouldContinue() != WorldObjectSearcherContinuation::Return;
+    });
 }
 
 // Creature searchers
@@ -118,19 +132,14 @@ void Trinity::CreatureSearcherBase<Check, Result>::Visit(CreatureMapType& m)
     if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
         return;
 
-    for (GridReference<Creature> const& ref : m)
+    VisitSearchCandidates(m, i_check, i_phaseMask, [this](Creature* object)
     {
-        if (!ref.GetSource()->InSamePhase(i_phaseMask))
-            continue;
+        if (!i_check(object))
+            return true;
 
-        if (i_check(ref.GetSource()))
-        {
-            this->Insert(ref.GetSource());
-
-            if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
-                return;
-        }
-    }
+        this->Insert(object);
+        return this->ShouldContinue() != WorldObjectSearcherContinuation::Return;
+    });
 }
 
 // Player searchers
@@ -141,19 +150,14 @@ void Trinity::PlayerSearcherBase<Check, Result>::Visit(PlayerMapType& m)
     if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
         return;
 
-    for (GridReference<Player> const& ref : m)
+    VisitSearchCandidates(m, i_check, i_phaseMask, [this](Player* object)
     {
-        if (!ref.GetSource()->InSamePhase(i_phaseMask))
-            continue;
+        if (!i_check(object))
+            return true;
 
-        if (i_check(ref.GetSource()))
-        {
-            this->Insert(ref.GetSource());
-
-            if (this->ShouldContinue() == WorldObjectSearcherContinuation::Return)
-                return;
-        }
-    }
+        this->Insert(object);
+        return this->ShouldContinue() != WorldObjectSearcherContinuation::Return;
+    });
 }
 
 template<class Builder>
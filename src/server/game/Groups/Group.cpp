@@ -1709,26 +1709,18 @@ void Group::SendTargetIconList(WorldSession* session)
 
 void Group::SendUpdate()
 {
-    for (member_witerator witr = m_memberSlots.begin(); witr != m_memberSlots.end(); ++witr)
-    {
-        Player* player = ObjectAccessor::FindConnectedPlayer(witr->guid);
-        if (!player)
-            continue;
+    // members are resolved once, not again for every packet
+    std::vector<Player*> memberPlayers;
+    _getMemberPlayers(memberPlayers);
 
-        SendUpdateToPlayer(player, &(*witr));
-    }
+    std::size_t index = 0;
+    for (member_citerator citr = m_memberSlots.begin(); citr != m_memberSlots.end(); ++citr, ++index)
+        if (Player* player = memberPlayers[index])
+            _sendUpdateToPlayer(player, *citr, memberPlayers);
 }
 
 void Group::SendUpdateToPlayer(Player const* player, MemberSlot const* slot /*= nullptr*/)
 {
-    if (player->GetGroup() != this)
-    {
-        if (player->GetOriginalGroup() == this)
-            SendOriginalGroupUpdateToPlayer(player);
-
-        return;
-    }
-
     // if MemberSlot wasn't provided
     if (!slot)
     {
@@ -1740,11 +1732,26 @@ void Group::SendUpdateToPlayer(Player const* player, MemberSlot const* slot /*=
         slot = &(*citr);
     }
 
+    std::vector<Player*> memberPlayers;
+    _getMemberPlayers(memberPlayers);
+    _sendUpdateToPlayer(player, *slot, memberPlayers);
+}
+
+void Group::_sendUpdateToPlayer(Player const* player, MemberSlot const& slot, std::vector<Player*> const& memberPlayers)
+{
+    if (player->GetGroup() != this)
+    {
+        if (player->GetOriginalGroup() == this)
+            SendOriginalGroupUpdateToPlayer(player);
+
+        return;
+    }
+
     WorldPacket data(SMSG_GROUP_LIST, (1+1+1+1+1+4+8+4+4+(GetMembersCount()-1)*(13+8+1+1+1+1)+8+1+8+1+1+1+1));
     data << uint8(m_groupType);                         // group type (flags in 3.3)
-    data << uint8(slot->group);
-    data << uint8(slot->flags);
-    data << uint8(slot->roles);
+    data << uint8(slot.group);
+    data << uint8(slot.flags);
+    data << uint8(slot.roles);
     if (isLFGGroup())
     {
         data << uint8(sLFGMgr->GetState(m_guid) == lfg::LFG_STATE_FINISHED_DUNGEON ? 2 : 0); // FIXME - Dungeon save status? 2 = done
@@ -1754,12 +1761,13 @@ void Group::SendUpdateToPlayer(Player const* player, MemberSlot const* slot /*=
     data << uint64(m_guid);
     data << uint32(m_counter++);                        // 3.3, value increases every time this packet gets sent
     data << uint32(GetMembersCount()-1);
-    for (member_citerator citr = m_memberSlots.begin(); citr != m_memberSlots.end(); ++citr)
+    std::size_t index = 0;
+    for (member_citerator citr = m_memberSlots.begin(); citr != m_memberSlots.end(); ++citr, ++index)
     {
-        if (slot->guid == citr->guid)
+        if (slot.guid == citr->guid)
             continue;
 
-        Player* member = ObjectAccessor::FindConnectedPlayer(citr->guid);
+        Player* member = memberPlayers[index];
 
         uint8 onlineState = (member && !member->GetSession()->PlayerLogout()) ? MEMBER_STATUS_ONLINE : MEMBER_STATUS_OFFLINE;
         onlineState = onlineState | ((isBGGroup() || isBFGroup()) ? MEMBER_STATUS_PVP : 0);
@@ -1844,9 +1852,13 @@ void Group::BroadcastReadyCheck(WorldPacket const* packet)
 
 void Group::OfflineReadyCheck()
 {
-    for (member_citerator citr = m_memberSlots.begin(); citr != m_memberSlots.end(); ++citr)
+    std::vector<Player*> memberPlayers;
+    _getMemberPlayers(memberPlayers);
+
+    std::size_t index = 0;
+    for (member_citerator citr = m_memberSlots.begin(); citr != m_memberSlots.end(); ++citr, ++index)
     {
-        Player* player = ObjectAccessor::FindConnectedPlayer(citr->guid);
+        Player* player = memberPlayers[index];
         if (!player || !player->GetSession())
         {
             WorldPacket data(MSG_RAID_READY_CHECK_CONFIRM, 9);
@@ -2708,6 +2720,25 @@ Group::member_witerator Group::_getMemberWSlot(ObjectGuid Guid)
     return m_memberSlots.end();
 }
 
+// Online players of the member slots, in slot order and nullptr for offline members. Taken from the member
+// references players link when they log in and unlink when they log out, no lookup through ObjectAccessor needed
+void Group::_getMemberPlayers(std::vector<Player*>& players) const
+{
+    std::vector<ObjectGuid> guids;
+    guids.reserve(m_memberSlots.size());
+    for (MemberSlot const& slot : m_memberSlots)
+        guids.push_back(slot.guid);
+
+    players.assign(guids.size(), nullptr);
+    for (GroupReference const* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
+    {
+        Player* player = itr->GetSource();
+        auto guid = std::find(guids.begin(), guids.end(), player->GetGUID());
+        if (guid != guids.end())
+            players[std::distance(guids.begin(), guid)] = player;
+    }
+}
+
 void Group::SubGroupCounterIncrease(uint8 subgroup)
 {
     if (m_subGroupsCounts)
@@ -26,6 +26,7 @@
 #include "Timer.h"
 #include "UniqueTrackablePtr.h"
 #include <map>
+#include <vector>
 
 class Battlefield;
 class Battleground;
@@ -348,6 +349,8 @@ class TC_GAME_API Group
         void _initRaidSubGroupsCounter();
         member_citerator _getMemberCSlot(ObjectGuid Guid) const;
         member_witerator _getMemberWSlot(ObjectGuid Guid);
+        void _getMemberPlayers(std::vector<Player*>& players) const;
+        void _sendUpdateToPlayer(Player const* player, MemberSlot const& slot, std::vector<Player*> const& memberPlayers);
         void SubGroupCounterIncrease(uint8 subgroup);
         void SubGroupCounterDecrease(uint8 subgroup);
         void ToggleGroupMemberFlag(member_witerator slot, uint8 flag, bool apply);
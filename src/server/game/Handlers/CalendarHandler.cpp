@@ -458,19 +458,21 @@ void WorldSession::HandleCalendarEventInvite(WorldPackets::Calendar::CalendarInv
     else
     {
         // Invitee offline, get data from storage
-        CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByName(inviteeName);
-        if (!characterInfo)
+        QueryCharacterCacheByName(inviteeName, [this, playerGuid, createInvite = std::move(createInvite)](CharacterCacheEntry const* characterInfo) mutable
         {
-            sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_PLAYER_NOT_FOUND);
-            return;
-        }
+            if (!characterInfo)
+            {
+                sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_PLAYER_NOT_FOUND);
+                return;
+            }
 
-        GetQueryProcessor().AddCallback(CharacterDatabase.AsyncQuery(Trinity::StringFormat("SELECT 1 FROM character_social WHERE guid = {} AND friend = {} AND (flags & {}) <> 0",
-            characterInfo->Guid.GetCounter(), playerGuid.GetCounter(), SOCIAL_FLAG_IGNORED).c_str()))
-            .WithCallback([inviteeGuid = characterInfo->Guid, inviteeTeam = Player::TeamForRace(characterInfo->Race), inviteeGuildId = characterInfo->GuildId, continuation = std::move(createInvite)](QueryResult result)
-        {
-            bool isIgnoring = result != nullptr;
-            continuation(inviteeGuid, inviteeTeam, inviteeGuildId, isIgnoring);
+            GetQueryProcessor().AddCallback(CharacterDatabase.AsyncQuery(Trinity::StringFormat("SELECT 1 FROM character_social WHERE guid = {} AND friend = {} AND (flags & {}) <> 0",
+                characterInfo->Guid.GetCounter(), playerGuid.GetCounter(), SOCIAL_FLAG_IGNORED).c_str()))
+                .WithCallback([inviteeGuid = characterInfo->Guid, inviteeTeam = Player::TeamForRace(characterInfo->Race), inviteeGuildId = characterInfo->GuildId, continuation = std::move(createInvite)](QueryResult result)
+            {
+                bool isIgnoring = result != nullptr;
+                continuation(inviteeGuid, inviteeTeam, inviteeGuildId, isIgnoring);
+            });
         });
     }
 }
@@ -1387,10 +1387,10 @@ void WorldSession::HandleCharCustomize(WorldPacket& recvData)
     stmt->setUInt32(0, customizeInfo->Guid.GetCounter());
 
     _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
-        .WithPreparedCallback(std::bind(&WorldSession::HandleCharCustomizeCallback, this, customizeInfo, std::placeholders::_1)));
+        .WithPreparedCallback(std::bind(&WorldSession::HandleCharCustomizeCallback, this, customizeInfo, std::placeholders::_1, false)));
 }
 
-void WorldSession::HandleCharCustomizeCallback(std::shared_ptr<CharacterCustomizeInfo> customizeInfo, PreparedQueryResult result)
+void WorldSession::HandleCharCustomizeCallback(std::shared_ptr<CharacterCustomizeInfo> customizeInfo, PreparedQueryResult result, bool nameOwnerChecked)
 {
     if (!result)
     {
@@ -1456,6 +1456,24 @@ void WorldSession::HandleCharCustomizeCallback(std::shared_ptr<CharacterCustomiz
             return;
         }
     }
+    else if (!nameOwnerChecked && !sCharacterCache->IsComplete())
+    {
+        // a bounded character cache does not know every name, ask the database and run the checks again with its answer
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUID_BY_NAME);
+        stmt->setString(0, customizeInfo->Name);
+        _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
+            .WithPreparedCallback([this, customizeInfo, result](PreparedQueryResult nameResult)
+        {
+            if (nameResult && (*nameResult)[0].GetUInt32() != customizeInfo->Guid.GetCounter())
+            {
+                SendCharCustomize(CHAR_CREATE_NAME_IN_USE, customizeInfo.get());
+                return;
+            }
+
+            HandleCharCustomizeCallback(customizeInfo, result, true);
+        }));
+        return;
+    }
 
     CharacterDatabasePreparedStatement* stmt = nullptr;
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
@@ -1643,10 +1661,10 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
     stmt->setUInt32(0, factionChangeInfo->Guid.GetCounter());
 
     _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
-        .WithPreparedCallback(std::bind(&WorldSession::HandleCharFactionOrRaceChangeCallback, this, factionChangeInfo, std::placeholders::_1)));
+        .WithPreparedCallback(std::bind(&WorldSession::HandleCharFactionOrRaceChangeCallback, this, factionChangeInfo, std::placeholders::_1, false)));
 }
 
-void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<CharacterFactionChangeInfo> factionChangeInfo, PreparedQueryResult result)
+void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<CharacterFactionChangeInfo> factionChangeInfo, PreparedQueryResult result, bool nameOwnerChecked)
 {
     if (!result)
     {
@@ -1753,6 +1771,24 @@ void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<Charact
             return;
         }
     }
+    else if (!nameOwnerChecked && !sCharacterCache->IsComplete())
+    {
+        // a bounded character cache does not know every name, ask the database and run the checks again with its answer
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUID_BY_NAME);
+        stmt->setString(0, factionChangeInfo->Name);
+        _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
+            .WithPreparedCallback([this, factionChangeInfo, result](PreparedQueryResult nameResult)
+        {
+            if (nameResult && (*nameResult)[0].GetUInt32() != factionChangeInfo->Guid.GetCounter())
+            {
+                SendCharFactionChange(CHAR_CREATE_NAME_IN_USE, factionChangeInfo.get());
+                return;
+            }
+
+            HandleCharFactionOrRaceChangeCallback(factionChangeInfo, result, true);
+        }));
+        return;
+    }
 
     if (sArenaTeamMgr->GetArenaTeamByCaptain(factionChangeInfo->Guid))
     {
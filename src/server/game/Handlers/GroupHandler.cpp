@@ -16,7 +16,6 @@
  */
 
 #include "WorldSession.h"
-#include "CharacterCache.h"
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "Group.h"
@@ -613,8 +612,8 @@ void WorldSession::HandleGroupChangeSubGroupOpcode(WorldPacket& recvData)
     ObjectGuid guid;
     if (Player* movedPlayer = ObjectAccessor::FindConnectedPlayerByName(name))
         guid = movedPlayer->GetGUID();
-    else
-        guid = sCharacterCache->GetCharacterGuidByName(name);
+    else // only members can be moved, the group knows their names even when the character cache does not
+        guid = group->GetMemberGUID(name);
 
     if (guid.IsEmpty())
         return;
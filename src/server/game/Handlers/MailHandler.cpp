@@ -78,248 +78,257 @@ void WorldSession::HandleSendMail(WorldPackets::Mail::SendMail& sendMail)
         return;
     }
 
-    ObjectGuid receiverGuid;
-    if (normalizePlayerName(sendMail.Info.Target))
-        receiverGuid = sCharacterCache->GetCharacterGuidByName(sendMail.Info.Target);
-
-    if (!receiverGuid)
+    if (!normalizePlayerName(sendMail.Info.Target))
     {
-        TC_LOG_INFO("network", "Player {} is sending mail to {} (GUID: non-existing!) with subject {} "
-            "and body {} includes {} items, {} copper and {} COD copper with StationeryID = {}, PackageID = {}",
-            GetPlayerInfo(), sendMail.Info.Target, sendMail.Info.Subject, sendMail.Info.Body,
-            sendMail.Info.Attachments.size(), sendMail.Info.SendMoney, sendMail.Info.Cod, sendMail.Info.StationeryID, sendMail.Info.PackageID);
         player->SendMailResult(0, MAIL_SEND, MAIL_ERR_RECIPIENT_NOT_FOUND);
         return;
     }
 
-    if (sendMail.Info.SendMoney < 0)
-    {
-        GetPlayer()->SendMailResult(0, MAIL_SEND, MAIL_ERR_INTERNAL_ERROR);
-        TC_LOG_WARN("cheat", "Player {} attempted to send mail to {} ({}) with negative money value (SendMoney: {})",
-            GetPlayerInfo(), sendMail.Info.Target, receiverGuid.ToString(), sendMail.Info.SendMoney);
-        return;
-    }
-
-    if (sendMail.Info.Cod < 0)
-    {
-        GetPlayer()->SendMailResult(0, MAIL_SEND, MAIL_ERR_INTERNAL_ERROR);
-        TC_LOG_WARN("cheat", "Player {} attempted to send mail to {} ({}) with negative COD value (Cod: {})",
-            GetPlayerInfo(), sendMail.Info.Target, receiverGuid.ToString(), sendMail.Info.Cod);
-        return;
-    }
-
-    TC_LOG_INFO("network", "Player {} is sending mail to {} ({}) with subject {} and body {} "
-        "including {} items, {} copper and {} COD copper with StationeryID = {}, PackageID = {}",
-        GetPlayerInfo(), sendMail.Info.Target, receiverGuid.ToString(), sendMail.Info.Subject,
-        sendMail.Info.Body, sendMail.Info.Attachments.size(), sendMail.Info.SendMoney, sendMail.Info.Cod, sendMail.Info.StationeryID, sendMail.Info.PackageID);
-
-    if (player->GetGUID() == receiverGuid)
-    {
-        player->SendMailResult(0, MAIL_SEND, MAIL_ERR_CANNOT_SEND_TO_SELF);
-        return;
-    }
-
-    int32 cost = !sendMail.Info.Attachments.empty() ? 30 * sendMail.Info.Attachments.size() : 30;  // price hardcoded in client
-
-    int32 reqmoney = cost + sendMail.Info.SendMoney;
-
-    // Check for overflow
-    if (reqmoney < sendMail.Info.SendMoney)
-    {
-        player->SendMailResult(0, MAIL_SEND, MAIL_ERR_NOT_ENOUGH_MONEY);
-        return;
-    }
-
-    auto mailCountCheckContinuation = [this, player = _player, receiverGuid, mailInfo = std::move(sendMail.Info), reqmoney, cost](uint32 receiverTeam, uint64 mailsCount, uint8 receiverLevel, uint32 receiverAccountId) mutable
+    QueryCharacterCacheByName(sendMail.Info.Target, [this, player, mailInfo = std::move(sendMail.Info)](CharacterCacheEntry const* receiverInfo) mutable
     {
         if (_player != player)
             return;
 
-        if (!player->HasEnoughMoney(reqmoney) && !player->IsGameMaster())
+        if (!receiverInfo)
         {
-            player->SendMailResult(0, MAIL_SEND, MAIL_ERR_NOT_ENOUGH_MONEY);
+            TC_LOG_INFO("network", "Player {} is sending mail to {} (GUID: non-existing!) with subject {} "
+                "and body {} includes {} items, {} copper and {} COD copper with StationeryID = {}, PackageID = {}",
+                GetPlayerInfo(), mailInfo.Target, mailInfo.Subject, mailInfo.Body,
+                mailInfo.Attachments.size(), mailInfo.SendMoney, mailInfo.Cod, mailInfo.StationeryID, mailInfo.PackageID);
+            player->SendMailResult(0, MAIL_SEND, MAIL_ERR_RECIPIENT_NOT_FOUND);
             return;
         }
 
-        // do not allow to have more than 100 mails in mailbox.. mails count is in opcode uint8!!! - so max can be 255..
-        if (mailsCount > 100)
+        ObjectGuid receiverGuid = receiverInfo->Guid;
+
+        if (mailInfo.SendMoney < 0)
         {
-            player->SendMailResult(0, MAIL_SEND, MAIL_ERR_RECIPIENT_CAP_REACHED);
+            GetPlayer()->SendMailResult(0, MAIL_SEND, MAIL_ERR_INTERNAL_ERROR);
+            TC_LOG_WARN("cheat", "Player {} attempted to send mail to {} ({}) with negative money value (SendMoney: {})",
+                GetPlayerInfo(), mailInfo.Target, receiverGuid.ToString(), mailInfo.SendMoney);
             return;
         }
 
-        // test the receiver's Faction... or all items are account bound
-        bool accountBound = !mailInfo.Attachments.empty();
-        for (auto const& att : mailInfo.Attachments)
+        if (mailInfo.Cod < 0)
         {
-            if (Item* item = player->GetItemByGuid(att.ItemGUID))
-            {
-                ItemTemplate const* itemProto = item->GetTemplate();
-                if (!itemProto || !itemProto->HasFlag(ITEM_FLAG_IS_BOUND_TO_ACCOUNT))
-                {
-                    accountBound = false;
-                    break;
-                }
-            }
+            GetPlayer()->SendMailResult(0, MAIL_SEND, MAIL_ERR_INTERNAL_ERROR);
+            TC_LOG_WARN("cheat", "Player {} attempted to send mail to {} ({}) with negative COD value (Cod: {})",
+                GetPlayerInfo(), mailInfo.Target, receiverGuid.ToString(), mailInfo.Cod);
+            return;
         }
 
-        if (!accountBound && player->GetTeam() != receiverTeam && !HasPermission(rbac::RBAC_PERM_TWO_SIDE_INTERACTION_MAIL))
+        TC_LOG_INFO("network", "Player {} is sending mail to {} ({}) with subject {} and body {} "
+            "including {} items, {} copper and {} COD copper with StationeryID = {}, PackageID = {}",
+            GetPlayerInfo(), mailInfo.Target, receiverGuid.ToString(), mailInfo.Subject,
+            mailInfo.Body, mailInfo.Attachments.size(), mailInfo.SendMoney, mailInfo.Cod, mailInfo.StationeryID, mailInfo.PackageID);
+
+        if (player->GetGUID() == receiverGuid)
         {
-            player->SendMailResult(0, MAIL_SEND, MAIL_ERR_NOT_YOUR_TEAM);
+            player->SendMailResult(0, MAIL_SEND, MAIL_ERR_CANNOT_SEND_TO_SELF);
             return;
         }
 
-        if (receiverLevel < sWorld->getIntConfig(CONFIG_MAIL_LEVEL_REQ))
+        int32 cost = !mailInfo.Attachments.empty() ? 30 * mailInfo.Attachments.size() : 30;  // price hardcoded in client
+
+        int32 reqmoney = cost + mailInfo.SendMoney;
+
+        // Check for overflow
+        if (reqmoney < mailInfo.SendMoney)
         {
-            SendNotification(GetTrinityString(LANG_MAIL_RECEIVER_REQ), sWorld->getIntConfig(CONFIG_MAIL_LEVEL_REQ));
+            player->SendMailResult(0, MAIL_SEND, MAIL_ERR_NOT_ENOUGH_MONEY);
             return;
         }
 
-        std::vector<Item*> items;
-
-        for (auto const& att : mailInfo.Attachments)
+        auto mailCountCheckContinuation = [this, player = _player, receiverGuid, mailInfo = std::move(mailInfo), reqmoney, cost](uint32 receiverTeam, uint64 mailsCount, uint8 receiverLevel, uint32 receiverAccountId) mutable
         {
-            if (att.ItemGUID.IsEmpty())
-            {
-                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_MAIL_ATTACHMENT_INVALID);
+            if (_player != player)
                 return;
-            }
-
-            Item* item = player->GetItemByGuid(att.ItemGUID);
 
-            // prevent sending bag with items (cheat: can be placed in bag after adding equipped empty bag to mail)
-            if (!item)
+            if (!player->HasEnoughMoney(reqmoney) && !player->IsGameMaster())
             {
-                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_MAIL_ATTACHMENT_INVALID);
+                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_NOT_ENOUGH_MONEY);
                 return;
             }
 
-            // handle empty bag before CanBeTraded, since that func already has that check
-            if (item->IsNotEmptyBag())
+            // do not allow to have more than 100 mails in mailbox.. mails count is in opcode uint8!!! - so max can be 255..
+            if (mailsCount > 100)
             {
-                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_DESTROY_NONEMPTY_BAG);
+                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_RECIPIENT_CAP_REACHED);
                 return;
             }
 
-            if (!item->CanBeTraded(true))
+            // test the receiver's Faction... or all items are account bound
+            bool accountBound = !mailInfo.Attachments.empty();
+            for (auto const& att : mailInfo.Attachments)
             {
-                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_MAIL_BOUND_ITEM);
-                return;
+                if (Item* item = player->GetItemByGuid(att.ItemGUID))
+                {
+                    ItemTemplate const* itemProto = item->GetTemplate();
+                    if (!itemProto || !itemProto->HasFlag(ITEM_FLAG_IS_BOUND_TO_ACCOUNT))
+                    {
+                        accountBound = false;
+                        break;
+                    }
+                }
             }
 
-            if (item->IsBoundAccountWide() && item->IsSoulBound() && GetAccountId() != receiverAccountId)
+            if (!accountBound && player->GetTeam() != receiverTeam && !HasPermission(rbac::RBAC_PERM_TWO_SIDE_INTERACTION_MAIL))
             {
-                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_NOT_SAME_ACCOUNT);
+                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_NOT_YOUR_TEAM);
                 return;
             }
 
-            if (item->GetTemplate()->HasFlag(ITEM_FLAG_CONJURED) || item->GetUInt32Value(ITEM_FIELD_DURATION))
+            if (receiverLevel < sWorld->getIntConfig(CONFIG_MAIL_LEVEL_REQ))
             {
-                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_MAIL_BOUND_ITEM);
+                SendNotification(GetTrinityString(LANG_MAIL_RECEIVER_REQ), sWorld->getIntConfig(CONFIG_MAIL_LEVEL_REQ));
                 return;
             }
 
-            if (mailInfo.Cod && item->IsWrapped())
+            std::vector<Item*> items;
+
+            for (auto const& att : mailInfo.Attachments)
             {
-                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_CANT_SEND_WRAPPED_COD);
-                return;
-            }
+                if (att.ItemGUID.IsEmpty())
+                {
+                    player->SendMailResult(0, MAIL_SEND, MAIL_ERR_MAIL_ATTACHMENT_INVALID);
+                    return;
+                }
 
-            items.push_back(item);
-        }
+                Item* item = player->GetItemByGuid(att.ItemGUID);
+
+                // prevent sending bag with items (cheat: can be placed in bag after adding equipped empty bag to mail)
+                if (!item)
+                {
+                    player->SendMailResult(0, MAIL_SEND, MAIL_ERR_MAIL_ATTACHMENT_INVALID);
+                    return;
+                }
+
+                // handle empty bag before CanBeTraded, since that func already has that check
+                if (item->IsNotEmptyBag())
+                {
+                    player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_DESTROY_NONEMPTY_BAG);
+                    return;
+                }
+
+                if (!item->CanBeTraded(true))
+                {
+                    player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_MAIL_BOUND_ITEM);
+                    return;
+                }
+
+                if (item->IsBoundAccountWide() && item->IsSoulBound() && GetAccountId() != receiverAccountId)
+                {
+                    player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_NOT_SAME_ACCOUNT);
+                    return;
+                }
+
+                if (item->GetTemplate()->HasFlag(ITEM_FLAG_CONJURED) || item->GetUInt32Value(ITEM_FIELD_DURATION))
+                {
+                    player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_MAIL_BOUND_ITEM);
+                    return;
+                }
+
+                if (mailInfo.Cod && item->IsWrapped())
+                {
+                    player->SendMailResult(0, MAIL_SEND, MAIL_ERR_CANT_SEND_WRAPPED_COD);
+                    return;
+                }
+
+                items.push_back(item);
+            }
 
 #ifdef ELUNA
-        if (Eluna* e = player->GetEluna())
-        {
-            if (!e->OnSendMail(player, receiverGuid))
+            if (Eluna* e = player->GetEluna())
             {
-                player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_CLIENT_LOCKED_OUT);
-                return;
+                if (!e->OnSendMail(player, receiverGuid))
+                {
+                    player->SendMailResult(0, MAIL_SEND, MAIL_ERR_EQUIP_ERROR, EQUIP_ERR_CLIENT_LOCKED_OUT);
+                    return;
+                }
             }
-        }
 #endif
 
-        player->SendMailResult(0, MAIL_SEND, MAIL_OK);
+            player->SendMailResult(0, MAIL_SEND, MAIL_OK);
 
-        player->ModifyMoney(-int32(reqmoney));
-        player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_GOLD_SPENT_FOR_MAIL, cost);
+            player->ModifyMoney(-int32(reqmoney));
+            player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_GOLD_SPENT_FOR_MAIL, cost);
 
-        bool needItemDelay = false;
+            bool needItemDelay = false;
 
-        MailDraft draft(mailInfo.Subject, mailInfo.Body);
+            MailDraft draft(mailInfo.Subject, mailInfo.Body);
 
-        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+            CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
-        if (!mailInfo.Attachments.empty() || mailInfo.SendMoney > 0)
-        {
-            bool log = HasPermission(rbac::RBAC_PERM_LOG_GM_TRADE);
-            if (!mailInfo.Attachments.empty())
+            if (!mailInfo.Attachments.empty() || mailInfo.SendMoney > 0)
             {
-                for (Item* item : items)
+                bool log = HasPermission(rbac::RBAC_PERM_LOG_GM_TRADE);
+                if (!mailInfo.Attachments.empty())
                 {
-                    if (log)
+                    for (Item* item : items)
                     {
-                        sLog->OutCommand(GetAccountId(), "GM {} (GUID: {}) (Account: {}) mail item: {} (Entry: {} Count: {}) "
-                            "to: {} ({}) (Account: {})", GetPlayerName(), GetGUIDLow(), GetAccountId(),
-                            item->GetTemplate()->Name1, item->GetEntry(), item->GetCount(),
-                            mailInfo.Target, receiverGuid.ToString(), receiverAccountId);
+                        if (log)
+                        {
+                            sLog->OutCommand(GetAccountId(), "GM {} (GUID: {}) (Account: {}) mail item: {} (Entry: {} Count: {}) "
+                                "to: {} ({}) (Account: {})", GetPlayerName(), GetGUIDLow(), GetAccountId(),
+                                item->GetTemplate()->Name1, item->GetEntry(), item->GetCount(),
+                                mailInfo.Target, receiverGuid.ToString(), receiverAccountId);
+                        }
+
+                        item->SetNotRefundable(GetPlayer()); // makes the item no longer refundable
+                        player->MoveItemFromInventory(item->GetBagSlot(), item->GetSlot(), true);
+
+                        item->DeleteFromInventoryDB(trans);     // deletes item from character's inventory
+                        item->SetOwnerGUID(receiverGuid);
+                        item->SetState(ITEM_CHANGED);
+                        item->SaveToDB(trans);                  // recursive and not have transaction guard into self, item not in inventory and can be save standalone
+
+                        draft.AddItem(item);
                     }
 
-                    item->SetNotRefundable(GetPlayer()); // makes the item no longer refundable
-                    player->MoveItemFromInventory(item->GetBagSlot(), item->GetSlot(), true);
-
-                    item->DeleteFromInventoryDB(trans);     // deletes item from character's inventory
-                    item->SetOwnerGUID(receiverGuid);
-                    item->SetState(ITEM_CHANGED);
-                    item->SaveToDB(trans);                  // recursive and not have transaction guard into self, item not in inventory and can be save standalone
-
-                    draft.AddItem(item);
+                    // if item send to character at another account, then apply item delivery delay
+                    needItemDelay = GetAccountId() != receiverAccountId;
                 }
 
-                // if item send to character at another account, then apply item delivery delay
-                needItemDelay = GetAccountId() != receiverAccountId;
-            }
-
-            if (log && mailInfo.SendMoney > 0)
-            {
-                sLog->OutCommand(GetAccountId(), "GM {} (GUID: {}) (Account: {}) mail money: {} to: {} ({}) (Account: {})",
-                    GetPlayerName(), GetGUIDLow(), GetAccountId(), mailInfo.SendMoney, mailInfo.Target, receiverGuid.ToString(), receiverAccountId);
+                if (log && mailInfo.SendMoney > 0)
+                {
+                    sLog->OutCommand(GetAccountId(), "GM {} (GUID: {}) (Account: {}) mail money: {} to: {} ({}) (Account: {})",
+                        GetPlayerName(), GetGUIDLow(), GetAccountId(), mailInfo.SendMoney, mailInfo.Target, receiverGuid.ToString(), receiverAccountId);
+                }
             }
-        }
 
-        // If theres is an item, there is a one hour delivery delay if sent to another account's character.
-        uint32 deliver_delay = needItemDelay ? sWorld->getIntConfig(CONFIG_MAIL_DELIVERY_DELAY) : 0;
+            // If theres is an item, there is a one hour delivery delay if sent to another account's character.
+            uint32 deliver_delay = needItemDelay ? sWorld->getIntConfig(CONFIG_MAIL_DELIVERY_DELAY) : 0;
 
-        // don't ask for COD if there are no items
-        if (mailInfo.Attachments.empty())
-            mailInfo.Cod = 0;
+            // don't ask for COD if there are no items
+            if (mailInfo.Attachments.empty())
+                mailInfo.Cod = 0;
 
-        // will delete item or place to receiver mail list
-        draft
-            .AddMoney(mailInfo.SendMoney)
-            .AddCOD(mailInfo.Cod)
-            .SendMailTo(trans, MailReceiver(ObjectAccessor::FindConnectedPlayer(receiverGuid), receiverGuid.GetCounter()), MailSender(player), mailInfo.Body.empty() ? MAIL_CHECK_MASK_COPIED : MAIL_CHECK_MASK_HAS_BODY, deliver_delay);
+            // will delete item or place to receiver mail list
+            draft
+                .AddMoney(mailInfo.SendMoney)
+                .AddCOD(mailInfo.Cod)
+                .SendMailTo(trans, MailReceiver(ObjectAccessor::FindConnectedPlayer(receiverGuid), receiverGuid.GetCounter()), MailSender(player), mailInfo.Body.empty() ? MAIL_CHECK_MASK_COPIED : MAIL_CHECK_MASK_HAS_BODY, deliver_delay);
 
-        player->SaveInventoryAndGoldToDB(trans);
-        CharacterDatabase.CommitTransaction(trans);
-    };
+            player->SaveInventoryAndGoldToDB(trans);
+            CharacterDatabase.CommitTransaction(trans);
+        };
 
-    if (Player* receiver = ObjectAccessor::FindConnectedPlayer(receiverGuid))
-    {
-        mailCountCheckContinuation(receiver->GetTeam(), receiver->GetMailSize(), receiver->GetLevel(), receiver->GetSession()->GetAccountId());
-    }
-    else
-    {
-        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAIL_COUNT);
-        stmt->setUInt32(0, receiverGuid.GetCounter());
-
-        GetQueryProcessor().AddCallback(CharacterDatabase.AsyncQuery(stmt)
-            .WithPreparedCallback([continuation = std::move(mailCountCheckContinuation), receiverGuid](PreparedQueryResult result) mutable
+        if (Player* receiver = ObjectAccessor::FindConnectedPlayer(receiverGuid))
         {
-            if (CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(receiverGuid))
-                continuation(Player::TeamForRace(characterInfo->Race), result ? (*result)[0].GetUInt64() : UI64LIT(0), characterInfo->Level, characterInfo->AccountId);
-        }));
-    }
+            mailCountCheckContinuation(receiver->GetTeam(), receiver->GetMailSize(), receiver->GetLevel(), receiver->GetSession()->GetAccountId());
+        }
+        else
+        {
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAIL_COUNT);
+            stmt->setUInt32(0, receiverGuid.GetCounter());
+
+            GetQueryProcessor().AddCallback(CharacterDatabase.AsyncQuery(stmt)
+                .WithPreparedCallback([continuation = std::move(mailCountCheckContinuation), receiverTeam = Player::TeamForRace(receiverInfo->Race), receiverLevel = receiverInfo->Level, receiverAccountId = receiverInfo->AccountId](PreparedQueryResult result) mutable
+            {
+                continuation(receiverTeam, result ? (*result)[0].GetUInt64() : UI64LIT(0), receiverLevel, receiverAccountId);
+            }));
+        }
+    });
 }
 
 //called when mail is read
@@ -16,10 +16,12 @@
  */
 
 #include "Battleground.h"
+#include "CellImpl.h"
 #include "Common.h"
 #include "Corpse.h"
 #include "GameTime.h"
 #include "GameClient.h"
+#include "GridNotifiersImpl.h"
 #include "InstanceSaveMgr.h"
 #include "Log.h"
 #include "MapManager.h"
@@ -377,7 +379,7 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvPacket)
 
     movementInfo.guid = mover->GetGUID();
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, _player);
+    RelayMovement(mover, &data);
 
     mover->m_movementInfo = movementInfo;
 
@@ -432,6 +434,37 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvPacket)
     }
 }
 
+bool WorldSession::IsFullMovementRelay(uint16 opcode, uint32 lastFullRelay, uint32 now, uint32 outerInterval)
+{
+    // observers extrapolate from state changes (start, stop, jump, facing, ...), only plain heartbeats may be thinned out
+    return opcode != MSG_MOVE_HEARTBEAT || getMSTimeDiff(lastFullRelay, now) >= outerInterval;
+}
+
+void WorldSession::RelayMovement(Unit* mover, WorldPacket const* data)
+{
+    uint32 now = GameTime::GetGameTimeMS();
+    if (!sWorld->getBoolConfig(CONFIG_MOVEMENT_RELAY_ENABLED)
+        || IsFullMovementRelay(data->GetOpcode(), mover->GetLastFullMovementRelay(), now, sWorld->getIntConfig(CONFIG_MOVEMENT_RELAY_OUTER_INTERVAL)))
+    {
+        mover->SendMessageToSet(data, _player);
+        // only heartbeats keep the pace for distant observers, state changes in between do not shift it
+        if (data->GetOpcode() == MSG_MOVE_HEARTBEAT)
+            mover->SetLastFullMovementRelay(now);
+        ++_movementRelaysFull;
+        return;
+    }
+
+    // a player moved by someone else still gets every update of itself
+    if (Player* moverPlayer = mover->ToPlayer(); moverPlayer && moverPlayer != _player)
+        moverPlayer->SendDirectMessage(data);
+
+    // distant observers just miss this heartbeat, the next one they get carries the latest position
+    float radius = std::min(sWorld->getFloatConfig(CONFIG_MOVEMENT_RELAY_INNER_RADIUS), mover->GetVisibilityRange());
+    Trinity::MessageDistDeliverer notifier(mover, data, radius, false, _player);
+    Cell::VisitWorldObjects(mover, notifier, radius);
+    ++_movementRelaysNear;
+}
+
 void WorldSession::HandleForceSpeedChangeAck(WorldPacket &recvData)
 {
     /* extract packet */
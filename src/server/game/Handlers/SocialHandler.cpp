@@ -46,76 +46,81 @@ void WorldSession::HandleAddFriendOpcode(WorldPacket& recvData)
     TC_LOG_DEBUG("network", "WorldSession::HandleAddFriendOpcode: {} asked to add friend: {}",
         GetPlayer()->GetName(), friendName);
 
-    CharacterCacheEntry const* friendCharacterInfo = sCharacterCache->GetCharacterCacheByName(friendName);
-    if (!friendCharacterInfo)
+    QueryCharacterCacheByName(friendName, [this, playerGuid = _player->GetGUID(), friendNote = std::move(friendNote)](CharacterCacheEntry const* friendCharacterInfo) mutable
     {
-        sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_NOT_FOUND, ObjectGuid::Empty);
-        return;
-    }
+        if (!_player || _player->GetGUID() != playerGuid)
+            return;
 
-    auto processFriendRequest = [this,
-        playerGuid = _player->GetGUID(),
-        friendGuid = friendCharacterInfo->Guid,
-        team = Player::TeamForRace(friendCharacterInfo->Race),
-        friendNote = std::move(friendNote)]()
-    {
-        if (playerGuid.GetCounter() != GetGUIDLow())
-            return; // not the player initiating request, do nothing
-
-        FriendsResult friendResult = FRIEND_NOT_FOUND;
-        if (friendGuid == GetPlayer()->GetGUID())
-            friendResult = FRIEND_SELF;
-        else if (GetPlayer()->GetTeam() != team && !HasPermission(rbac::RBAC_PERM_TWO_SIDE_ADD_FRIEND))
-            friendResult = FRIEND_ENEMY;
-        else if (GetPlayer()->GetSocial()->HasFriend(friendGuid))
-            friendResult = FRIEND_ALREADY;
-        else
+        if (!friendCharacterInfo)
         {
-            Player* pFriend = ObjectAccessor::FindPlayer(friendGuid);
-            if (pFriend && pFriend->IsVisibleGloballyFor(GetPlayer()))
-                friendResult = FRIEND_ADDED_ONLINE;
-            else
-                friendResult = FRIEND_ADDED_OFFLINE;
-            if (GetPlayer()->GetSocial()->AddToSocialList(friendGuid, SOCIAL_FLAG_FRIEND))
-                GetPlayer()->GetSocial()->SetFriendNote(friendGuid, friendNote);
-            else
-                friendResult = FRIEND_LIST_FULL;
+            sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_NOT_FOUND, ObjectGuid::Empty);
+            return;
         }
 
-        sSocialMgr->SendFriendStatus(GetPlayer(), friendResult, friendGuid);
-    };
-
-    if (HasPermission(rbac::RBAC_PERM_ALLOW_GM_FRIEND))
-    {
-        processFriendRequest();
-        return;
-    }
-
-    // First try looking up friend candidate security from online object
-    if (Player* friendPlayer = ObjectAccessor::FindPlayer(friendCharacterInfo->Guid))
-    {
-        if (!AccountMgr::IsPlayerAccount(friendPlayer->GetSession()->GetSecurity()))
+        auto processFriendRequest = [this,
+            playerGuid,
+            friendGuid = friendCharacterInfo->Guid,
+            team = Player::TeamForRace(friendCharacterInfo->Race),
+            friendNote = std::move(friendNote)]()
         {
-            sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_NOT_FOUND, ObjectGuid::Empty);
+            if (playerGuid.GetCounter() != GetGUIDLow())
+                return; // not the player initiating request, do nothing
+
+            FriendsResult friendResult = FRIEND_NOT_FOUND;
+            if (friendGuid == GetPlayer()->GetGUID())
+                friendResult = FRIEND_SELF;
+            else if (GetPlayer()->GetTeam() != team && !HasPermission(rbac::RBAC_PERM_TWO_SIDE_ADD_FRIEND))
+                friendResult = FRIEND_ENEMY;
+            else if (GetPlayer()->GetSocial()->HasFriend(friendGuid))
+                friendResult = FRIEND_ALREADY;
+            else
+            {
+                Player* pFriend = ObjectAccessor::FindPlayer(friendGuid);
+                if (pFriend && pFriend->IsVisibleGloballyFor(GetPlayer()))
+                    friendResult = FRIEND_ADDED_ONLINE;
+                else
+                    friendResult = FRIEND_ADDED_OFFLINE;
+                if (GetPlayer()->GetSocial()->AddToSocialList(friendGuid, SOCIAL_FLAG_FRIEND))
+                    GetPlayer()->GetSocial()->SetFriendNote(friendGuid, friendNote);
+                else
+                    friendResult = FRIEND_LIST_FULL;
+            }
+
+            sSocialMgr->SendFriendStatus(GetPlayer(), friendResult, friendGuid);
+        };
+
+        if (HasPermission(rbac::RBAC_PERM_ALLOW_GM_FRIEND))
+        {
+            processFriendRequest();
             return;
         }
 
-        processFriendRequest();
-        return;
-    }
-
-    // When not found, consult database
-    GetQueryProcessor().AddCallback(AccountMgr::GetSecurityAsync(friendCharacterInfo->AccountId, realm.Id.Realm,
-        [this, continuation = std::move(processFriendRequest)](uint32 friendSecurity)
-    {
-        if (!AccountMgr::IsPlayerAccount(friendSecurity))
+        // First try looking up friend candidate security from online object
+        if (Player* friendPlayer = ObjectAccessor::FindPlayer(friendCharacterInfo->Guid))
         {
-            sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_NOT_FOUND, ObjectGuid::Empty);
+            if (!AccountMgr::IsPlayerAccount(friendPlayer->GetSession()->GetSecurity()))
+            {
+                sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_NOT_FOUND, ObjectGuid::Empty);
+                return;
+            }
+
+            processFriendRequest();
             return;
         }
 
-        continuation();
-    }));
+        // When not found, consult database
+        GetQueryProcessor().AddCallback(AccountMgr::GetSecurityAsync(friendCharacterInfo->AccountId, realm.Id.Realm,
+            [this, continuation = std::move(processFriendRequest)](uint32 friendSecurity)
+        {
+            if (!AccountMgr::IsPlayerAccount(friendSecurity))
+            {
+                sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_NOT_FOUND, ObjectGuid::Empty);
+                return;
+            }
+
+            continuation();
+        }));
+    });
 }
 
 void WorldSession::HandleDelFriendOpcode(WorldPacket& recvData)
@@ -140,25 +145,31 @@ void WorldSession::HandleAddIgnoreOpcode(WorldPacket& recvData)
     TC_LOG_DEBUG("network", "WorldSession::HandleAddIgnoreOpcode: {} asked to Ignore: {}",
         GetPlayer()->GetName(), ignoreName);
 
-    ObjectGuid ignoreGuid = sCharacterCache->GetCharacterGuidByName(ignoreName);
-    FriendsResult ignoreResult = FRIEND_IGNORE_NOT_FOUND;
-    if (!ignoreGuid.IsEmpty())
+    QueryCharacterCacheByName(ignoreName, [this, playerGuid = _player->GetGUID()](CharacterCacheEntry const* ignoreCharacterInfo)
     {
-        if (ignoreGuid == GetPlayer()->GetGUID())              //not add yourself
-            ignoreResult = FRIEND_IGNORE_SELF;
-        else if (GetPlayer()->GetSocial()->HasIgnore(ignoreGuid))
-            ignoreResult = FRIEND_IGNORE_ALREADY;
-        else
+        if (!_player || _player->GetGUID() != playerGuid)
+            return;
+
+        ObjectGuid ignoreGuid = ignoreCharacterInfo ? ignoreCharacterInfo->Guid : ObjectGuid::Empty;
+        FriendsResult ignoreResult = FRIEND_IGNORE_NOT_FOUND;
+        if (!ignoreGuid.IsEmpty())
         {
-            ignoreResult = FRIEND_IGNORE_ADDED;
+            if (ignoreGuid == GetPlayer()->GetGUID())              //not add yourself
+                ignoreResult = FRIEND_IGNORE_SELF;
+            else if (GetPlayer()->GetSocial()->HasIgnore(ignoreGuid))
+                ignoreResult = FRIEND_IGNORE_ALREADY;
+            else
+            {
+                ignoreResult = FRIEND_IGNORE_ADDED;
 
-            // ignore list full
-            if (!GetPlayer()->GetSocial()->AddToSocialList(ignoreGuid, SOCIAL_FLAG_IGNORED))
-                ignoreResult = FRIEND_IGNORE_FULL;
+                // ignore list full
+                if (!GetPlayer()->GetSocial()->AddToSocialList(ignoreGuid, SOCIAL_FLAG_IGNORED))
+                    ignoreResult = FRIEND_IGNORE_FULL;
+            }
         }
-    }
 
-    sSocialMgr->SendFriendStatus(GetPlayer(), ignoreResult, ignoreGuid);
+        sSocialMgr->SendFriendStatus(GetPlayer(), ignoreResult, ignoreGuid);
+    });
 }
 
 void WorldSession::HandleDelIgnoreOpcode(WorldPacket& recvData)
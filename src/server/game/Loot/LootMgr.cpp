@@ -29,6 +29,8 @@
 #include "SpellMgr.h"
 #include "Util.h"
 #include "World.h"
+#include <algorithm>
+#include <limits>
 
 static Rates const qualityToRate[MAX_ITEM_QUALITY] =
 {
@@ -59,14 +61,14 @@ struct LootGroupInvalidSelector
 {
     explicit LootGroupInvalidSelector(Loot const& loot, uint16 lootMode) : _loot(loot), _lootMode(lootMode) { }
 
-    bool operator()(LootStoreItem* item) const
+    bool operator()(LootStoreItem const& item) const
     {
-        if (!(item->lootmode & _lootMode))
+        if (!(item.lootmode & _lootMode))
             return true;
 
         uint8 foundDuplicates = 0;
         for (std::vector<LootItem>::const_iterator itr = _loot.items.begin(); itr != _loot.items.end(); ++itr)
-            if (itr->itemid == item->itemid)
+            if (itr->itemid == item.itemid)
                 if (++foundDuplicates == _loot.maxDuplicates)
                     return true;
 
@@ -82,9 +84,9 @@ class LootTemplate::LootGroup                               // A set of loot def
 {
     public:
         LootGroup() { }
-        ~LootGroup();
 
-        void AddEntry(LootStoreItem* item);                 // Adds an entry to the group (at loading stage)
+        void AddEntry(LootStoreItem const& item);           // Adds an entry to the group (at loading stage)
+        void Finalize();                                    // Builds the roll tables once all entries are added (at loading stage)
         bool HasQuestDrop() const;                          // True if group includes at least 1 quest drop entry
         bool HasQuestDropForPlayer(Player const* player) const;
                                                             // The same for active quests of the player
@@ -100,12 +102,12 @@ class LootTemplate::LootGroup                               // A set of loot def
     private:
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
+        std::vector<float> ExplicitlyChancedTotals;         // Running chance totals of ExplicitlyChanced, rolling them is a binary search
+        std::vector<uint32> ItemIds;                        // Sorted item ids of all entries, used to detect duplicates already in the loot
+        uint16 SharedLootMode = 0;                          // Loot mode of all entries if they are the same, 0 otherwise
 
+        bool CanRollAllEntries(Loot const& loot, uint16 lootMode) const;
         LootStoreItem const* Roll(Loot& loot, uint16 lootMode) const;   // Rolls an item from the group, returns NULL if all miss their chances
-
-        // This class must never be copied - storing pointers
-        LootGroup(LootGroup const&) = delete;
-        LootGroup& operator=(LootGroup const&) = delete;
 };
 
 //Remove all data and free all memory
@@ -161,13 +163,10 @@ uint32 LootStore::LoadLootTable()
             return 0;
         }
 
-        LootStoreItem* storeitem = new LootStoreItem(item, reference, chance, needsquest, lootmode, groupid, mincount, maxcount);
+        LootStoreItem storeitem(item, reference, chance, needsquest, lootmode, groupid, mincount, maxcount);
 
-        if (!storeitem->IsValid(*this, entry))            // Validity checks
-        {
-            delete storeitem;
+        if (!storeitem.IsValid(*this, entry))             // Validity checks
             continue;
-        }
 
         // Looking for the template of the entry
                                                          // often entries are put together
@@ -190,6 +189,9 @@ uint32 LootStore::LoadLootTable()
     }
     while (result->NextRow());
 
+    for (LootTemplateMap::value_type const& lootTemplate : m_LootTemplates)
+        lootTemplate.second->Finalize();                // Flattens the template for rolling
+
     Verify();                                           // Checks validity of the loot store
 
     return count;
@@ -347,69 +349,122 @@ bool LootStoreItem::IsValid(LootStore const& store, uint32 entry) const
 // --------- LootTemplate::LootGroup ---------
 //
 
-LootTemplate::LootGroup::~LootGroup()
+// Adds an entry to the group (at loading stage)
+void LootTemplate::LootGroup::AddEntry(LootStoreItem const& item)
+{
+    if (item.chance != 0)
+        ExplicitlyChanced.push_back(item);
+    else
+        EqualChanced.push_back(item);
+}
+
+// Builds the roll tables once all entries are added (at loading stage)
+void LootTemplate::LootGroup::Finalize()
 {
-    while (!ExplicitlyChanced.empty())
+    ExplicitlyChanced.shrink_to_fit();
+    EqualChanced.shrink_to_fit();
+
+    // an entry with chance >= 100 always drops if reached, nothing after it can be rolled
+    float total = 0.0f;
+    ExplicitlyChancedTotals.clear();
+    ExplicitlyChancedTotals.reserve(ExplicitlyChanced.size());
+    for (LootStoreItem const& item : ExplicitlyChanced)
     {
-        delete ExplicitlyChanced.back();
-        ExplicitlyChanced.pop_back();
+        total = item.chance >= 100.0f ? std::numeric_limits<float>::infinity() : total + item.chance;
+        ExplicitlyChancedTotals.push_back(total);
     }
 
-    while (!EqualChanced.empty())
+    ItemIds.clear();
+    SharedLootMode = 0;
+    for (LootStoreItemList const* itemList : { &ExplicitlyChanced, &EqualChanced })
     {
-        delete EqualChanced.back();
-        EqualChanced.pop_back();
+        for (LootStoreItem const& item : *itemList)
+        {
+            ItemIds.push_back(item.itemid);
+            if (ItemIds.size() == 1)
+                SharedLootMode = item.lootmode;
+            else if (SharedLootMode != item.lootmode)
+                SharedLootMode = 0;
+        }
     }
+
+    std::sort(ItemIds.begin(), ItemIds.end());
+    ItemIds.erase(std::unique(ItemIds.begin(), ItemIds.end()), ItemIds.end());
+    ItemIds.shrink_to_fit();
 }
 
-// Adds an entry to the group (at loading stage)
-void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
+// True if LootGroupInvalidSelector would not remove any entry, the precomputed tables can be used as they are
+bool LootTemplate::LootGroup::CanRollAllEntries(Loot const& loot, uint16 lootMode) const
 {
-    if (item->chance != 0)
-        ExplicitlyChanced.push_back(item);
-    else
-        EqualChanced.push_back(item);
+    if (!(SharedLootMode & lootMode))
+        return false;
+
+    for (LootItem const& lootItem : loot.items)
+        if (std::binary_search(ItemIds.begin(), ItemIds.end(), lootItem.itemid))
+            return false;
+
+    return true;
 }
 
 // Rolls an item from the group, returns NULL if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    if (ItemIds.empty() || (SharedLootMode && !(SharedLootMode & lootMode)))
+        return nullptr;                                     // Unused group id or every entry is filtered out by loot mode
 
-    if (!possibleLoot.empty())                             // First explicitly chanced entries are checked
+    if (CanRollAllEntries(loot, lootMode))
     {
-        float roll = (float)rand_chance();
-
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
+        if (!ExplicitlyChanced.empty())                     // First explicitly chanced entries are checked
         {
-            LootStoreItem* item = *itr;
-            if (item->chance >= 100.0f)
-                return item;
-
-            roll -= item->chance;
-            if (roll < 0)
-                return item;
+            float roll = (float)rand_chance();
+            auto itr = std::upper_bound(ExplicitlyChancedTotals.begin(), ExplicitlyChancedTotals.end(), roll);
+            if (itr != ExplicitlyChancedTotals.end())
+                return &ExplicitlyChanced[std::distance(ExplicitlyChancedTotals.begin(), itr)];
         }
+
+        if (!EqualChanced.empty())                          // If nothing selected yet - an item is taken from equal-chanced part
+            return &Trinity::Containers::SelectRandomContainerElement(EqualChanced);
+
+        return nullptr;                                     // Empty drop from the group
     }
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    LootGroupInvalidSelector isInvalid(loot, lootMode);
+
+    float roll = (float)rand_chance();
+    for (LootStoreItem const& item : ExplicitlyChanced)     // check each explicitly chanced entry in the template and modify its chance based on quality.
+    {
+        if (isInvalid(item))
+            continue;
+
+        if (item.chance >= 100.0f)
+            return &item;
+
+        roll -= item.chance;
+        if (roll < 0)
+            return &item;
+    }
+
+    std::vector<LootStoreItem const*> possibleLoot;
+    possibleLoot.reserve(EqualChanced.size());
+    for (LootStoreItem const& item : EqualChanced)
+        if (!isInvalid(item))
+            possibleLoot.push_back(&item);
+
     if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
         return Trinity::Containers::SelectRandomContainerElement(possibleLoot);
 
-    return nullptr;                                            // Empty drop from the group
+    return nullptr;                                         // Empty drop from the group
 }
 
 // True if group includes at least 1 quest drop entry
 bool LootTemplate::LootGroup::HasQuestDrop() const
 {
-    for (LootStoreItemList::const_iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
-        if ((*i)->needs_quest)
+    for (LootStoreItem const& item : ExplicitlyChanced)
+        if (item.needs_quest)
             return true;
 
-    for (LootStoreItemList::const_iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
-        if ((*i)->needs_quest)
+    for (LootStoreItem const& item : EqualChanced)
+        if (item.needs_quest)
             return true;
 
     return false;
@@ -418,12 +473,12 @@ bool LootTemplate::LootGroup::HasQuestDrop() const
 // True if group includes at least 1 quest drop entry for active quests of the player
 bool LootTemplate::LootGroup::HasQuestDropForPlayer(Player const* player) const
 {
-    for (LootStoreItemList::const_iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
-        if (player->HasQuestForItem((*i)->itemid))
+    for (LootStoreItem const& item : ExplicitlyChanced)
+        if (player->HasQuestForItem(item.itemid))
             return true;
 
-    for (LootStoreItemList::const_iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
-        if (player->HasQuestForItem((*i)->itemid))
+    for (LootStoreItem const& item : EqualChanced)
+        if (player->HasQuestForItem(item.itemid))
             return true;
 
     return false;
@@ -431,11 +486,11 @@ bool LootTemplate::LootGroup::HasQuestDropForPlayer(Player const* player) const
 
 void LootTemplate::LootGroup::CopyConditions(ConditionContainer /*conditions*/)
 {
-    for (LootStoreItemList::iterator i = ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
-        (*i)->conditions.clear();
+    for (LootStoreItem& item : ExplicitlyChanced)
+        item.conditions.clear();
 
-    for (LootStoreItemList::iterator i = EqualChanced.begin(); i != EqualChanced.end(); ++i)
-        (*i)->conditions.clear();
+    for (LootStoreItem& item : EqualChanced)
+        item.conditions.clear();
 }
 
 // Rolls an item from the group (if any takes its chance) and adds the item to the loot
@@ -450,9 +505,9 @@ float LootTemplate::LootGroup::RawTotalChance() const
 {
     float result = 0;
 
-    for (LootStoreItemList::const_iterator i=ExplicitlyChanced.begin(); i != ExplicitlyChanced.end(); ++i)
-        if (!(*i)->needs_quest)
-            result += (*i)->chance;
+    for (LootStoreItem const& item : ExplicitlyChanced)
+        if (!item.needs_quest)
+            result += item.chance;
 
     return result;
 }
@@ -480,27 +535,17 @@ void LootTemplate::LootGroup::Verify(LootStore const& lootstore, uint32 id, uint
 
 void LootTemplate::LootGroup::CheckLootRefs(LootTemplateMap const& /*store*/, LootIdSet* ref_set) const
 {
-    for (LootStoreItemList::const_iterator ieItr = ExplicitlyChanced.begin(); ieItr != ExplicitlyChanced.end(); ++ieItr)
+    for (LootStoreItemList const* itemList : { &ExplicitlyChanced, &EqualChanced })
     {
-        LootStoreItem* item = *ieItr;
-        if (item->reference > 0)
+        for (LootStoreItem const& item : *itemList)
         {
-            if (!LootTemplates_Reference.GetLootFor(item->reference))
-                LootTemplates_Reference.ReportNonExistingId(item->reference, "Reference", item->itemid);
-            else if (ref_set)
-                ref_set->erase(item->reference);
-        }
-    }
-
-    for (LootStoreItemList::const_iterator ieItr = EqualChanced.begin(); ieItr != EqualChanced.end(); ++ieItr)
-    {
-        LootStoreItem* item = *ieItr;
-        if (item->reference > 0)
-        {
-            if (!LootTemplates_Reference.GetLootFor(item->reference))
-                LootTemplates_Reference.ReportNonExistingId(item->reference, "Reference", item->itemid);
-            else if (ref_set)
-                ref_set->erase(item->reference);
+            if (item.reference > 0)
+            {
+                if (!LootTemplates_Reference.GetLootFor(item.reference))
+                    LootTemplates_Reference.ReportNonExistingId(item.reference, "Reference", item.itemid);
+                else if (ref_set)
+                    ref_set->erase(item.reference);
+            }
         }
     }
 }
@@ -509,51 +554,52 @@ void LootTemplate::LootGroup::CheckLootRefs(LootTemplateMap const& /*store*/, Lo
 // --------- LootTemplate ---------
 //
 
-LootTemplate::~LootTemplate()
-{
-    for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
-        delete *i;
+LootTemplate::LootTemplate() = default;
 
-    for (size_t i = 0; i < Groups.size(); ++i)
-        delete Groups[i];
-}
+LootTemplate::~LootTemplate() = default;
 
 // Adds an entry to the group (at loading stage)
-void LootTemplate::AddEntry(LootStoreItem* item)
+void LootTemplate::AddEntry(LootStoreItem const& item)
 {
-    if (item->groupid > 0 && item->reference == 0)            // Group
+    if (item.groupid > 0 && item.reference == 0)              // Group
     {
-        if (item->groupid >= Groups.size())
-            Groups.resize(item->groupid, nullptr);               // Adds new group the the loot template if needed
-        if (!Groups[item->groupid - 1])
-            Groups[item->groupid - 1] = new LootGroup();
+        if (item.groupid > Groups.size())
+            Groups.resize(item.groupid);                      // Adds new group the the loot template if needed
 
-        Groups[item->groupid - 1]->AddEntry(item);            // Adds new entry to the group
+        Groups[item.groupid - 1].AddEntry(item);              // Adds new entry to the group
     }
     else                                                      // Non-grouped entries and references are stored together
         Entries.push_back(item);
 }
 
+// Builds the roll tables once all entries are added (at loading stage)
+void LootTemplate::Finalize()
+{
+    Entries.shrink_to_fit();
+    Groups.shrink_to_fit();
+
+    for (LootGroup& group : Groups)
+        group.Finalize();
+}
+
 void LootTemplate::CopyConditions(ConditionContainer const& conditions)
 {
-    for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
-        (*i)->conditions.clear();
+    for (LootStoreItem& item : Entries)
+        item.conditions.clear();
 
-    for (LootGroups::iterator i = Groups.begin(); i != Groups.end(); ++i)
-        if (LootGroup* group = *i)
-            group->CopyConditions(conditions);
+    for (LootGroup& group : Groups)
+        group.CopyConditions(conditions);
 }
 
 void LootTemplate::CopyConditions(LootItem* li) const
 {
     // Copies the conditions list from a template item to a LootItem
-    for (LootStoreItemList::const_iterator _iter = Entries.begin(); _iter != Entries.end(); ++_iter)
+    for (LootStoreItem const& item : Entries)
     {
-        LootStoreItem* item = *_iter;
-        if (item->itemid != li->itemid)
+        if (item.itemid != li->itemid)
             continue;
 
-        li->conditions = item->conditions;
+        li->conditions = item.conditions;
         break;
     }
 }
@@ -566,41 +612,36 @@ void LootTemplate::Process(Loot& loot, bool rate, uint16 lootMode, uint8 groupId
         if (groupId > Groups.size())
             return;                                         // Error message already printed at loading stage
 
-        if (!Groups[groupId - 1])
-            return;
-
-        Groups[groupId - 1]->Process(loot, lootMode);
+        Groups[groupId - 1].Process(loot, lootMode);
         return;
     }
 
     // Rolling non-grouped items
-    for (LootStoreItemList::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
+    for (LootStoreItem const& item : Entries)
     {
-        LootStoreItem* item = *i;
-        if (!(item->lootmode & lootMode))                       // Do not add if mode mismatch
+        if (!(item.lootmode & lootMode))                        // Do not add if mode mismatch
             continue;
 
-        if (!item->Roll(rate))
+        if (!item.Roll(rate))
             continue;                                           // Bad luck for the entry
 
-        if (item->reference > 0)                            // References processing
+        if (item.reference > 0)                             // References processing
         {
-            LootTemplate const* Referenced = LootTemplates_Reference.GetLootFor(item->reference);
+            LootTemplate const* Referenced = LootTemplates_Reference.GetLootFor(item.reference);
             if (!Referenced)
                 continue;                                       // Error message already printed at loading stage
 
-            uint32 maxcount = uint32(float(item->maxcount) * sWorld->getRate(RATE_DROP_ITEM_REFERENCED_AMOUNT));
+            uint32 maxcount = uint32(float(item.maxcount) * sWorld->getRate(RATE_DROP_ITEM_REFERENCED_AMOUNT));
             for (uint32 loop = 0; loop < maxcount; ++loop)      // Ref multiplicator
-                Referenced->Process(loot, rate, lootMode, item->groupid);
+                Referenced->Process(loot, rate, lootMode, item.groupid);
         }
         else                                                    // Plain entries (not a reference, not grouped)
-            loot.AddItem(*item);                                // Chance is already checked, just add
+            loot.AddItem(item);                                 // Chance is already checked, just add
     }
 
     // Now processing groups
-    for (LootGroups::const_iterator i = Groups.begin(); i != Groups.end(); ++i)
-        if (LootGroup* group = *i)
-            group->Process(loot, lootMode);
+    for (LootGroup const& group : Groups)
+        group.Process(loot, lootMode);
 }
 
 // True if template includes at least 1 quest drop entry
@@ -611,32 +652,27 @@ bool LootTemplate::HasQuestDrop(LootTemplateMap const& store, uint8 groupId) con
         if (groupId > Groups.size())
             return false;                                   // Error message [should be] already printed at loading stage
 
-        if (!Groups[groupId - 1])
-            return false;
-
-        return Groups[groupId-1]->HasQuestDrop();
+        return Groups[groupId - 1].HasQuestDrop();
     }
 
-    for (LootStoreItemList::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
+    for (LootStoreItem const& item : Entries)
     {
-        LootStoreItem* item = *i;
-        if (item->reference > 0)                        // References
+        if (item.reference > 0)                         // References
         {
-            LootTemplateMap::const_iterator Referenced = store.find(item->reference);
+            LootTemplateMap::const_iterator Referenced = store.find(item.reference);
             if (Referenced == store.end())
                 continue;                                   // Error message [should be] already printed at loading stage
-            if (Referenced->second->HasQuestDrop(store, item->groupid))
+            if (Referenced->second->HasQuestDrop(store, item.groupid))
                 return true;
         }
-        else if (item->needs_quest)
+        else if (item.needs_quest)
             return true;                                    // quest drop found
     }
 
     // Now processing groups
-    for (LootGroups::const_iterator i = Groups.begin(); i != Groups.end(); ++i)
-        if (LootGroup* group = *i)
-            if (group->HasQuestDrop())
-                return true;
+    for (LootGroup const& group : Groups)
+        if (group.HasQuestDrop())
+            return true;
 
     return false;
 }
@@ -649,33 +685,28 @@ bool LootTemplate::HasQuestDropForPlayer(LootTemplateMap const& store, Player co
         if (groupId > Groups.size())
             return false;                                   // Error message already printed at loading stage
 
-        if (!Groups[groupId - 1])
-            return false;
-
-        return Groups[groupId - 1]->HasQuestDropForPlayer(player);
+        return Groups[groupId - 1].HasQuestDropForPlayer(player);
     }
 
     // Checking non-grouped entries
-    for (LootStoreItemList::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
+    for (LootStoreItem const& item : Entries)
     {
-        LootStoreItem* item = *i;
-        if (item->reference > 0)                        // References processing
+        if (item.reference > 0)                         // References processing
         {
-            LootTemplateMap::const_iterator Referenced = store.find(item->reference);
+            LootTemplateMap::const_iterator Referenced = store.find(item.reference);
             if (Referenced == store.end())
                 continue;                                   // Error message already printed at loading stage
-            if (Referenced->second->HasQuestDropForPlayer(store, player, item->groupid))
+            if (Referenced->second->HasQuestDropForPlayer(store, player, item.groupid))
                 return true;
         }
-        else if (player->HasQuestForItem(item->itemid))
+        else if (player->HasQuestForItem(item.itemid))
             return true;                                    // active quest drop found
     }
 
     // Now checking groups
-    for (LootGroups::const_iterator i = Groups.begin(); i != Groups.end(); ++i)
-        if (LootGroup* group = *i)
-            if (group->HasQuestDropForPlayer(player))
-                return true;
+    for (LootGroup const& group : Groups)
+        if (group.HasQuestDropForPlayer(player))
+            return true;
 
     return false;
 }
@@ -685,29 +716,26 @@ void LootTemplate::Verify(LootStore const& lootstore, uint32 id) const
 {
     // Checking group chances
     for (uint32 i = 0; i < Groups.size(); ++i)
-        if (Groups[i])
-            Groups[i]->Verify(lootstore, id, i + 1);
+        Groups[i].Verify(lootstore, id, i + 1);
 
     /// @todo References validity checks
 }
 
 void LootTemplate::CheckLootRefs(LootTemplateMap const& store, LootIdSet* ref_set) const
 {
-    for (LootStoreItemList::const_iterator ieItr = Entries.begin(); ieItr != Entries.end(); ++ieItr)
+    for (LootStoreItem const& item : Entries)
     {
-        LootStoreItem* item = *ieItr;
-        if (item->reference > 0)
+        if (item.reference > 0)
         {
-            if (!LootTemplates_Reference.GetLootFor(item->reference))
-                LootTemplates_Reference.ReportNonExistingId(item->reference, "Reference", item->itemid);
+            if (!LootTemplates_Reference.GetLootFor(item.reference))
+                LootTemplates_Reference.ReportNonExistingId(item.reference, "Reference", item.itemid);
             else if (ref_set)
-                ref_set->erase(item->reference);
+                ref_set->erase(item.reference);
         }
     }
 
-    for (LootGroups::const_iterator grItr = Groups.begin(); grItr != Groups.end(); ++grItr)
-        if (LootGroup* group = *grItr)
-            group->CheckLootRefs(store, ref_set);
+    for (LootGroup const& group : Groups)
+        group.CheckLootRefs(store, ref_set);
 }
 
 bool LootTemplate::addConditionItem(Condition* cond)
@@ -718,49 +746,25 @@ bool LootTemplate::addConditionItem(Condition* cond)
         return false;
     }
 
-    if (!Entries.empty())
+    for (LootStoreItem& item : Entries)
     {
-        for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
+        if (item.itemid == uint32(cond->SourceEntry))
         {
-            if ((*i)->itemid == uint32(cond->SourceEntry))
-            {
-                (*i)->conditions.push_back(cond);
-                return true;
-            }
+            item.conditions.push_back(cond);
+            return true;
         }
     }
 
-    if (!Groups.empty())
+    for (LootGroup& group : Groups)
     {
-        for (LootGroups::iterator groupItr = Groups.begin(); groupItr != Groups.end(); ++groupItr)
+        for (LootStoreItemList* itemList : { group.GetExplicitlyChancedItemList(), group.GetEqualChancedItemList() })
         {
-            LootGroup* group = *groupItr;
-            if (!group)
-                continue;
-
-            LootStoreItemList* itemList = group->GetExplicitlyChancedItemList();
-            if (!itemList->empty())
-            {
-                for (LootStoreItemList::iterator i = itemList->begin(); i != itemList->end(); ++i)
-                {
-                    if ((*i)->itemid == uint32(cond->SourceEntry))
-                    {
-                        (*i)->conditions.push_back(cond);
-                        return true;
-                    }
-                }
-            }
-
-            itemList = group->GetEqualChancedItemList();
-            if (!itemList->empty())
+            for (LootStoreItem& item : *itemList)
             {
-                for (LootStoreItemList::iterator i = itemList->begin(); i != itemList->end(); ++i)
+                if (item.itemid == uint32(cond->SourceEntry))
                 {
-                    if ((*i)->itemid == uint32(cond->SourceEntry))
-                    {
-                        (*i)->conditions.push_back(cond);
-                        return true;
-                    }
+                    item.conditions.push_back(cond);
+                    return true;
                 }
             }
         }
@@ -770,8 +774,8 @@ bool LootTemplate::addConditionItem(Condition* cond)
 
 bool LootTemplate::isReference(uint32 id)
 {
-    for (LootStoreItemList::const_iterator ieItr = Entries.begin(); ieItr != Entries.end(); ++ieItr)
-        if ((*ieItr)->itemid == id && (*ieItr)->reference > 0)
+    for (LootStoreItem const& item : Entries)
+        if (item.itemid == id && item.reference > 0)
             return true;
 
     return false;//not found or not reference
@@ -55,7 +55,7 @@ struct TC_GAME_API LootStoreItem
                                                             // Checks correctness of values
 };
 
-typedef std::list<LootStoreItem*> LootStoreItemList;
+typedef std::vector<LootStoreItem> LootStoreItemList;
 typedef std::unordered_map<uint32, LootTemplate*> LootTemplateMap;
 
 typedef std::set<uint32> LootIdSet;
@@ -99,14 +99,16 @@ class TC_GAME_API LootStore
 class TC_GAME_API LootTemplate
 {
     class LootGroup;                                       // A set of loot definitions for items (refs are not allowed inside)
-    typedef std::vector<LootGroup*> LootGroups;
+    typedef std::vector<LootGroup> LootGroups;
 
     public:
-        LootTemplate() { }
+        LootTemplate();
         ~LootTemplate();
 
         // Adds an entry to the group (at loading stage)
-        void AddEntry(LootStoreItem* item);
+        void AddEntry(LootStoreItem const& item);
+        // Flattens the entries into the form used for rolling, must be called once all entries are added (at loading stage)
+        void Finalize();
         // Rolls for every item in the template and adds the rolled items the the loot
         void Process(Loot& loot, bool rate, uint16 lootMode, uint8 groupId = 0) const;
         void CopyConditions(ConditionContainer const& conditions);
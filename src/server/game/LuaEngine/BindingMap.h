@@ -7,10 +7,12 @@
 #ifndef _BINDING_MAP_H
 #define _BINDING_MAP_H
 
+#include <atomic>
 #include <memory>
 #include "Common.h"
 #include "ElunaUtility.h"
 #include <type_traits>
+#include <vector>
 
 extern "C"
 {
@@ -182,7 +184,6 @@ public:
         for (auto i = list.begin(); i != list.end();)
         {
             std::unique_ptr<Binding>& binding = (*i);
-            auto i_prev = (i++);
 
             lua_rawgeti(L, LUA_REGISTRYINDEX, binding->functionReference);
 
@@ -192,10 +193,14 @@ public:
 
                 if (binding->remainingShots == 0)
                 {
+                    // erasing invalidates the following iterators of the vector
                     id_lookup_table.erase(binding->id);
-                    list.erase(i_prev);
+                    i = list.erase(i);
+                    continue;
                 }
             }
+
+            ++i;
         }
     }
 };
@@ -249,6 +254,53 @@ struct UniqueObjectKey
     { }
 };
 
+/*
+ * Which packet opcodes have bindings, plus whether a catch-all event sees every opcode.
+ *
+ * Packets are sent and received from any thread, so checking a flag is lock free.
+ *   The flags are only changed by the owning state when bindings are registered,
+ *   cancelled, cleared or run out of shots.
+ */
+class PacketBindingFlags
+{
+private:
+    std::vector< std::atomic<uint8> > bound;
+    std::atomic<bool> anyBound;
+
+public:
+    PacketBindingFlags(uint32 opcodeCount) :
+        bound(opcodeCount),
+        anyBound(false)
+    { }
+
+    bool IsBound(uint32 opcode) const
+    {
+        return anyBound.load(std::memory_order_relaxed) || (opcode < bound.size() && bound[opcode].load(std::memory_order_relaxed));
+    }
+
+    void SetAnyBound(bool value)
+    {
+        anyBound = value;
+    }
+
+    void SetBound(uint32 opcode, bool value)
+    {
+        if (opcode < bound.size())
+            bound[opcode] = value ? 1 : 0;
+    }
+
+    /*
+     * Recompute every flag, `isBound(opcode)` tells whether `opcode` has bindings.
+     */
+    template<typename Pred>
+    void Update(bool anyValue, Pred isBound)
+    {
+        anyBound = anyValue;
+        for (uint32 opcode = 0; opcode < bound.size(); ++opcode)
+            bound[opcode] = isBound(opcode) ? 1 : 0;
+    }
+};
+
 class hash_helper
 {
 public:
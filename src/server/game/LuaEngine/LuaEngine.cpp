@@ -74,7 +74,10 @@ PlayerGossipBindings(NULL),
 MapEventBindings(NULL),
 InstanceEventBindings(NULL),
 
-CreatureUniqueBindings(NULL)
+CreatureUniqueBindings(NULL),
+
+PacketSendHooks(NUM_MSG_TYPES),
+PacketReceiveHooks(NUM_MSG_TYPES)
 {
     OpenLua();
     eventMgr = new EventMgr(this);
@@ -199,6 +202,8 @@ void Eluna::CreateBindStores()
     InstanceEventBindings    = new BindingMap< EntryKey<Hooks::InstanceEvents> >(L);
 
     CreatureUniqueBindings   = new BindingMap< UniqueObjectKey<Hooks::CreatureEvents> >(L);
+
+    UpdatePacketHooks();
 }
 
 void Eluna::DestroyBindStores()
@@ -717,6 +722,9 @@ static int cancelBinding(lua_State* L)
 
     bindings->Remove(bindingID);
 
+    if ((void*)bindings == E->ServerEventBindings || (void*)bindings == E->PacketEventBindings)
+        E->UpdatePacketHooks();
+
     return 0;
 }
 
@@ -744,6 +752,11 @@ int Eluna::Register(uint8 regtype, uint32 entry, ObjectGuid guid, uint32 instanc
                 auto key = EventKey<Hooks::ServerEvents>((Hooks::ServerEvents)event_id);
                 bindingID = ServerEventBindings->Insert(key, functionRef, shots);
                 createCancelCallback(this, bindingID, ServerEventBindings);
+
+                if (event_id == Hooks::SERVER_EVENT_ON_PACKET_SEND)
+                    PacketSendHooks.SetAnyBound(true);
+                else if (event_id == Hooks::SERVER_EVENT_ON_PACKET_RECEIVE)
+                    PacketReceiveHooks.SetAnyBound(true);
                 return 1; // Stack: callback
             }
             break;
@@ -811,6 +824,11 @@ int Eluna::Register(uint8 regtype, uint32 entry, ObjectGuid guid, uint32 instanc
                 auto key = EntryKey<Hooks::PacketEvents>((Hooks::PacketEvents)event_id, entry);
                 bindingID = PacketEventBindings->Insert(key, functionRef, shots);
                 createCancelCallback(this, bindingID, PacketEventBindings);
+
+                if (event_id == Hooks::PACKET_EVENT_ON_PACKET_SEND)
+                    PacketSendHooks.SetBound(entry, true);
+                else if (event_id == Hooks::PACKET_EVENT_ON_PACKET_RECEIVE)
+                    PacketReceiveHooks.SetBound(entry, true);
                 return 1; // Stack: callback
             }
             break;
@@ -8,6 +8,7 @@
 #define _LUA_ENGINE_H
 
 #include "Common.h"
+#include "BindingMap.h"
 #include "ElunaUtility.h"
 #include "Hooks.h"
 
@@ -264,6 +265,10 @@ public:
 
     BindingMap< UniqueObjectKey<Hooks::CreatureEvents> >* CreatureUniqueBindings;
 
+    // Opcodes bound by packet events or the catch-all server packet events
+    PacketBindingFlags PacketSendHooks;
+    PacketBindingFlags PacketReceiveHooks;
+
     static int StackTrace(lua_State* _L);
     static void Report(lua_State* _L);
 
@@ -467,6 +472,8 @@ public:
     void OnSpawn(GameObject* gameobject);
 
     /* Packet */
+    bool HasPacketHooks(Hooks::PacketEvents event, uint32 opcode) const;
+    void UpdatePacketHooks();
     bool OnPacketSend(WorldSession* session, const WorldPacket& packet);
     void OnPacketSendAny(Player* player, const WorldPacket& packet, bool& result);
     void OnPacketSendOne(Player* player, const WorldPacket& packet, bool& result);
@@ -23,8 +23,30 @@ using namespace Hooks;
     if (!PacketEventBindings->HasBindingsFor(key))\
         return;
 
+// Only reads the flags, packets are sent from any thread
+bool Eluna::HasPacketHooks(PacketEvents event, uint32 opcode) const
+{
+    return (event == PACKET_EVENT_ON_PACKET_SEND ? PacketSendHooks : PacketReceiveHooks).IsBound(opcode);
+}
+
+void Eluna::UpdatePacketHooks()
+{
+    PacketSendHooks.Update(ServerEventBindings->HasBindingsFor(EventKey<ServerEvents>(SERVER_EVENT_ON_PACKET_SEND)), [this](uint32 opcode)
+    {
+        return PacketEventBindings->HasBindingsFor(EntryKey<PacketEvents>(PACKET_EVENT_ON_PACKET_SEND, opcode));
+    });
+
+    PacketReceiveHooks.Update(ServerEventBindings->HasBindingsFor(EventKey<ServerEvents>(SERVER_EVENT_ON_PACKET_RECEIVE)), [this](uint32 opcode)
+    {
+        return PacketEventBindings->HasBindingsFor(EntryKey<PacketEvents>(PACKET_EVENT_ON_PACKET_RECEIVE, opcode));
+    });
+}
+
 bool Eluna::OnPacketSend(WorldSession* session, const WorldPacket& packet)
 {
+    if (!HasPacketHooks(PACKET_EVENT_ON_PACKET_SEND, packet.GetOpcode()))
+        return true;
+
     bool result = true;
     Player* player = NULL;
     if (session)
@@ -51,6 +73,10 @@ void Eluna::OnPacketSendAny(Player* player, const WorldPacket& packet, bool& res
     }
 
     CleanUpStack(2);
+
+    // the last binding ran out of shots
+    if (!ServerEventBindings->HasBindingsFor(key))
+        PacketSendHooks.SetAnyBound(false);
 }
 
 void Eluna::OnPacketSendOne(Player* player, const WorldPacket& packet, bool& result)
@@ -71,10 +97,17 @@ void Eluna::OnPacketSendOne(Player* player, const WorldPacket& packet, bool& res
     }
 
     CleanUpStack(2);
+
+    // the last binding ran out of shots
+    if (!PacketEventBindings->HasBindingsFor(key))
+        PacketSendHooks.SetBound(packet.GetOpcode(), false);
 }
 
 bool Eluna::OnPacketReceive(WorldSession* session, WorldPacket& packet)
 {
+    if (!HasPacketHooks(PACKET_EVENT_ON_PACKET_RECEIVE, packet.GetOpcode()))
+        return true;
+
     bool result = true;
     Player* player = NULL;
     if (session)
@@ -112,6 +145,10 @@ void Eluna::OnPacketReceiveAny(Player* player, WorldPacket& packet, bool& result
     }
 
     CleanUpStack(2);
+
+    // the last binding ran out of shots
+    if (!ServerEventBindings->HasBindingsFor(key))
+        PacketReceiveHooks.SetAnyBound(false);
 }
 
 void Eluna::OnPacketReceiveOne(Player* player, WorldPacket& packet, bool& result)
@@ -142,4 +179,8 @@ void Eluna::OnPacketReceiveOne(Player* player, WorldPacket& packet, bool& result
     }
 
     CleanUpStack(2);
+
+    // the last binding ran out of shots
+    if (!PacketEventBindings->HasBindingsFor(key))
+        PacketReceiveHooks.SetBound(packet.GetOpcode(), false);
 }
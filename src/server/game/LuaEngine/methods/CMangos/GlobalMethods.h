@@ -3030,6 +3030,8 @@ namespace LuaGlobalFunctions
             uint32 event_type = E->CHECKVAL<uint32>(2);
             E->PacketEventBindings->Clear(Key((Hooks::PacketEvents)event_type, entry));
         }
+
+        E->UpdatePacketHooks();
         return 0;
     }
 
@@ -3116,6 +3118,8 @@ namespace LuaGlobalFunctions
             uint32 event_type = E->CHECKVAL<uint32>(1);
             E->ServerEventBindings->Clear(Key((Hooks::ServerEvents)event_type));
         }
+
+        E->UpdatePacketHooks();
         return 0;
     }
 
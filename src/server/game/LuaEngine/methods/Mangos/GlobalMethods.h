@@ -2779,6 +2779,8 @@ namespace LuaGlobalFunctions
             uint32 event_type = E->CHECKVAL<uint32>(2);
             E->PacketEventBindings->Clear(Key((Hooks::PacketEvents)event_type, entry));
         }
+
+        E->UpdatePacketHooks();
         return 0;
     }
 
@@ -2864,6 +2866,8 @@ namespace LuaGlobalFunctions
             uint32 event_type = E->CHECKVAL<uint32>(1);
             E->ServerEventBindings->Clear(Key((Hooks::ServerEvents)event_type));
         }
+
+        E->UpdatePacketHooks();
         return 0;
     }
 
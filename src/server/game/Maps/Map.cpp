@@ -43,6 +43,7 @@
 #include "Pet.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
+#include "TimerWheel.h"
 #include "Transport.h"
 #include "Vehicle.h"
 #include "VMapFactory.h"
@@ -55,7 +56,6 @@
 #include "Weather.h"
 #include "WeatherMgr.h"
 #include "World.h"
-#include <boost/heap/fibonacci_heap.hpp>
 #include <unordered_set>
 #include <vector>
 
@@ -80,15 +80,18 @@ ZoneDynamicInfo::ZoneDynamicInfo() : MusicId(0), DefaultWeather(nullptr), Weathe
 RespawnInfo::~RespawnInfo() = default;
 
 struct RespawnInfoWithHandle;
-struct RespawnListContainer : boost::heap::fibonacci_heap<RespawnInfoWithHandle*, boost::heap::compare<CompareRespawnInfo>>
+struct RespawnListContainer : Trinity::TimerWheel<RespawnInfoWithHandle*>
 {
 };
 
 struct RespawnInfoWithHandle : RespawnInfo
 {
-    explicit RespawnInfoWithHandle(RespawnInfo const& other) : RespawnInfo(other) { }
+    explicit RespawnInfoWithHandle(RespawnInfo const& other) : RespawnInfo(other), handle(RespawnListContainer::InvalidHandle), removed(false) { }
 
-    RespawnListContainer::handle_type handle;
+    // InvalidHandle while the entry is part of the batch ProcessRespawns is working on
+    RespawnListContainer::Handle handle;
+    // deleted by outside logic while part of that batch, the batch frees it
+    bool removed;
 };
 
 Map::~Map()
@@ -109,6 +112,10 @@ Map::~Map()
     if (!m_scriptSchedule.empty())
         sMapMgr->DecreaseScheduledScriptCount(m_scriptSchedule.size());
 
+    std::vector<GameEventSpawnChange>* changes;
+    while (_queuedGameEventSpawnChanges.Dequeue(changes))
+        delete changes;
+
     MMAP::MMapFactory::createOrGetMMapManager()->unloadMapInstance(GetId(), i_InstanceId);
 }
 
@@ -279,7 +286,8 @@ Map::Map(uint32 id, time_t expiry, uint32 InstanceId, uint8 SpawnMode, Map* _par
 _creatureToMoveLock(false), _gameObjectsToMoveLock(false), _dynamicObjectsToMoveLock(false),
 i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
 m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
-m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
+_staticLineOfSightCache(sWorld->getIntConfig(CONFIG_LINE_OF_SIGHT_CACHE_SIZE)), _dynamicLineOfSightCache(sWorld->getIntConfig(CONFIG_LINE_OF_SIGHT_CACHE_SIZE) / 4),
+_dynamicLineOfSightGeneration(0), m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transports.end()),
 i_gridExpiry(expiry),
 i_scriptLock(false), _respawnTimes(std::make_unique<RespawnListContainer>()), _respawnCheckTimer(0)
@@ -776,6 +784,8 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 void Map::Update(uint32 t_diff)
 {
     _dynamicTree.update(t_diff);
+    // spawn state and transport positions change without the dynamic tree noticing
+    InvalidateDynamicLineOfSight();
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
@@ -789,15 +799,15 @@ void Map::Update(uint32 t_diff)
         }
     }
 
-    /// process any due respawns
+    /// process any due respawns, a wave larger than the budget continues on the next update
     if (_respawnCheckTimer <= t_diff)
-    {
-        ProcessRespawns();
-        _respawnCheckTimer = sWorld->getIntConfig(CONFIG_RESPAWN_MINCHECKINTERVALMS);
-    }
+        _respawnCheckTimer = ProcessRespawns() ? sWorld->getIntConfig(CONFIG_RESPAWN_MINCHECKINTERVALMS) : 0;
     else
         _respawnCheckTimer -= t_diff;
 
+    /// spawn and despawn game event objects, large holiday transitions continue on the next updates
+    ProcessGameEventSpawnChanges();
+
     /// update active cells around players and active objects
     resetMarkedCells();
 
@@ -1151,7 +1161,7 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
     ASSERT(CheckGridIntegrity(creature, true));
 }
 
-void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail)
+void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail, bool updateVisibility)
 {
     Cell integrity_check(go->GetPositionX(), go->GetPositionY());
     Cell old_cell = go->GetCurrentCell();
@@ -1176,7 +1186,8 @@ void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float
         go->Relocate(x, y, z, orientation);
         go->UpdateModelPosition();
         go->UpdatePositionData();
-        go->UpdateObjectVisibility(false);
+        if (updateVisibility)
+            go->UpdateObjectVisibility(false);
         RemoveGameObjectFromMoveList(go);
     }
 
@@ -1185,7 +1196,7 @@ void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float
     ASSERT(integrity_check == old_cell);
 }
 
-void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float z, float orientation)
+void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float z, float orientation, bool updateVisibility)
 {
     Cell integrity_check(dynObj->GetPositionX(), dynObj->GetPositionY());
     Cell old_cell = dynObj->GetCurrentCell();
@@ -1209,7 +1220,8 @@ void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float
     {
         dynObj->Relocate(x, y, z, orientation);
         dynObj->UpdatePositionData();
-        dynObj->UpdateObjectVisibility(false);
+        if (updateVisibility)
+            dynObj->UpdateObjectVisibility(false);
         RemoveDynamicObjectFromMoveList(dynObj);
     }
 
@@ -2884,14 +2896,98 @@ float Map::GetWaterLevel(float x, float y) const
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
     if ((checks & LINEOFSIGHT_CHECK_VMAP)
-      && !VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags))
+      && !IsInStaticLineOfSight(x1, y1, z1, x2, y2, z2, ignoreFlags))
         return false;
     if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT)
-      && !_dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask))
+      && !IsInDynamicLineOfSight(x1, y1, z1, x2, y2, z2, phasemask))
         return false;
     return true;
 }
 
+void Map::isInLineOfSight(std::span<VMAP::LineOfSightRay> rays, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    for (VMAP::LineOfSightRay& ray : rays)
+        ray.InLineOfSight = true;
+
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+    {
+        VMAP::VMapManager2* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
+        uint32 generation = vmgr->getLineOfSightGeneration(GetId());
+
+        // rays already cached are answered right away, the rest goes to the tree together
+        std::vector<VMAP::LineOfSightRay> uncached;
+        std::vector<std::pair<std::size_t, Optional<VMAP::LineOfSightCache::Key>>> uncachedKeys;
+        for (std::size_t i = 0; i < rays.size(); ++i)
+        {
+            VMAP::LineOfSightRay& ray = rays[i];
+            Optional<VMAP::LineOfSightCache::Key> key;
+            if (generation && _staticLineOfSightCache.IsEnabled()
+                && VMAP::LineOfSightCache::MakeKey(ray.X1, ray.Y1, ray.Z1, ray.X2, ray.Y2, ray.Z2, uint32(ignoreFlags), key.emplace()))
+            {
+                if (Optional<bool> result = _staticLineOfSightCache.Find(*key, generation))
+                {
+                    ray.InLineOfSight = *result;
+                    continue;
+                }
+            }
+            else
+                key.reset();
+
+            uncached.push_back(ray);
+            uncachedKeys.emplace_back(i, key);
+        }
+
+        if (!uncached.empty())
+        {
+            vmgr->isInLineOfSight(GetId(), uncached, ignoreFlags);
+            for (std::size_t i = 0; i < uncached.size(); ++i)
+            {
+                auto const& [index, key] = uncachedKeys[i];
+                rays[index].InLineOfSight = uncached[i].InLineOfSight;
+                if (key)
+                    _staticLineOfSightCache.Store(*key, generation, uncached[i].InLineOfSight);
+            }
+        }
+    }
+
+    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT))
+        for (VMAP::LineOfSightRay& ray : rays)
+            if (ray.InLineOfSight)
+                ray.InLineOfSight = IsInDynamicLineOfSight(ray.X1, ray.Y1, ray.Z1, ray.X2, ray.Y2, ray.Z2, phasemask);
+}
+
+bool Map::IsInStaticLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    VMAP::VMapManager2* vmgr = VMAP::VMapFactory::createOrGetVMapManager();
+
+    // generation 0 means no static geometry is tested, nothing worth caching
+    uint32 generation = _staticLineOfSightCache.IsEnabled() ? vmgr->getLineOfSightGeneration(GetId()) : 0;
+    VMAP::LineOfSightCache::Key key;
+    if (!generation || !VMAP::LineOfSightCache::MakeKey(x1, y1, z1, x2, y2, z2, uint32(ignoreFlags), key))
+        return vmgr->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags);
+
+    if (Optional<bool> result = _staticLineOfSightCache.Find(key, generation))
+        return *result;
+
+    bool result = vmgr->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags);
+    _staticLineOfSightCache.Store(key, generation, result);
+    return result;
+}
+
+bool Map::IsInDynamicLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const
+{
+    VMAP::LineOfSightCache::Key key;
+    if (!_dynamicLineOfSightCache.IsEnabled() || !VMAP::LineOfSightCache::MakeKey(x1, y1, z1, x2, y2, z2, phasemask, key))
+        return _dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+
+    if (Optional<bool> result = _dynamicLineOfSightCache.Find(key, _dynamicLineOfSightGeneration))
+        return *result;
+
+    bool result = _dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+    _dynamicLineOfSightCache.Store(key, _dynamicLineOfSightGeneration, result);
+    return result;
+}
+
 bool Map::getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 {
     G3D::Vector3 startPos(x1, y1, z1);
@@ -3032,7 +3128,7 @@ void Map::SendObjectUpdates()
         obj->BuildUpdate(update_players);
     }
 
-    WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
+    WorldPacket packet;                                     // storage comes from the packet buffer pool and is reused for every player
     for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
     {
         iter->second.BuildPacket(&packet);
@@ -3119,7 +3215,9 @@ void Map::Respawn(RespawnInfo* info, CharacterDatabaseTransaction dbTrans)
     if (info->respawnTime <= GameTime::GetGameTime())
         return;
     info->respawnTime = GameTime::GetGameTime();
-    _respawnTimes->increase(static_cast<RespawnInfoWithHandle*>(info)->handle);
+    RespawnInfoWithHandle* ri = static_cast<RespawnInfoWithHandle*>(info);
+    if (ri->handle != RespawnListContainer::InvalidHandle)
+        _respawnTimes->Reschedule(ri->handle, info->respawnTime);
     SaveRespawnInfoDB(*info, dbTrans);
 }
 
@@ -3174,7 +3272,7 @@ bool Map::AddRespawnInfo(RespawnInfo const& info)
         ABORT_MSG("Invalid respawn info for spawn id (%u,%u) being inserted", uint32(info.type), info.spawnId);
 
     RespawnInfoWithHandle* ri = new RespawnInfoWithHandle(info);
-    ri->handle = _respawnTimes->push(ri);
+    ri->handle = _respawnTimes->Schedule(ri->respawnTime, ri);
     bySpawnIdMap.emplace(ri->spawnId, ri);
     return true;
 }
@@ -3205,11 +3303,21 @@ RespawnInfo* Map::GetRespawnInfo(SpawnObjectType type, ObjectGuid::LowType spawn
 
 void Map::UnloadAllRespawnInfos() // delete everything from memory
 {
-    for (RespawnInfo* info : *_respawnTimes)
-        delete info;
-    _respawnTimes->clear();
-    _creatureRespawnTimesBySpawnId.clear();
-    _gameObjectRespawnTimesBySpawnId.clear();
+    for (RespawnInfoMap* map : { &_creatureRespawnTimesBySpawnId, &_gameObjectRespawnTimesBySpawnId })
+    {
+        for (auto const& [spawnId, info] : *map)
+        {
+            RespawnInfoWithHandle* ri = static_cast<RespawnInfoWithHandle*>(info);
+            if (ri->handle != RespawnListContainer::InvalidHandle)
+                delete ri;
+            else
+                ri->removed = true;
+        }
+
+        map->clear();
+    }
+
+    _respawnTimes->Clear();
 }
 
 void Map::DeleteRespawnInfo(RespawnInfo* info, CharacterDatabaseTransaction dbTrans)
@@ -3224,14 +3332,18 @@ void Map::DeleteRespawnInfo(RespawnInfo* info, CharacterDatabaseTransaction dbTr
     ASSERT(it != range.second, "Respawn stores inconsistent for map %u, spawnid %u (type %u)", GetId(), info->spawnId, uint32(info->type));
     spawnMap.erase(it);
 
-    // respawn heap
-    _respawnTimes->erase(static_cast<RespawnInfoWithHandle*>(info)->handle);
-
     // database
     DeleteRespawnInfoFromDB(info->type, info->spawnId, dbTrans);
 
-    // then cleanup the object
-    delete info;
+    // respawn schedule, then cleanup the object unless ProcessRespawns still holds it
+    RespawnInfoWithHandle* ri = static_cast<RespawnInfoWithHandle*>(info);
+    if (ri->handle != RespawnListContainer::InvalidHandle)
+    {
+        _respawnTimes->Remove(ri->handle);
+        delete ri;
+    }
+    else
+        ri->removed = true;
 }
 
 void Map::DeleteRespawnInfoFromDB(SpawnObjectType type, ObjectGuid::LowType spawnId, CharacterDatabaseTransaction dbTrans)
@@ -3244,11 +3356,8 @@ void Map::DeleteRespawnInfoFromDB(SpawnObjectType type, ObjectGuid::LowType spaw
     CharacterDatabase.ExecuteOrAppend(dbTrans, stmt);
 }
 
-void Map::DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 gridId)
+void Map::DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId)
 {
-    if (!IsGridLoaded(gridId)) // if grid isn't loaded, this will be processed in grid load handler
-        return;
-
     switch (type)
     {
         case SPAWN_TYPE_CREATURE:
@@ -3270,19 +3379,41 @@ void Map::DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 gr
     }
 }
 
-void Map::ProcessRespawns()
+bool Map::ProcessRespawns()
 {
     time_t now = GameTime::GetGameTime();
-    while (!_respawnTimes->empty())
+    uint32 const budget = sWorld->getIntConfig(CONFIG_RESPAWN_MAXPERCHECK);
+
+    // take the due entries off the schedule, they stay reachable through the spawn id maps until processed
+    std::vector<RespawnInfoWithHandle*> batch;
+    _respawnTimes->TakeDue(uint64(now), budget, batch);
+    for (RespawnInfoWithHandle* info : batch)
+        info->handle = RespawnListContainer::InvalidHandle;
+
+    std::size_t const backlog = _respawnTimes->CountDue(uint64(now));
+    time_t maxLatency = 0;
+
+    // a grid's spawns are validated and created in one pass
+    std::stable_sort(batch.begin(), batch.end(), [](RespawnInfoWithHandle const* a, RespawnInfoWithHandle const* b) { return a->gridId < b->gridId; });
+
+    bool gridLoaded = false;
+    for (std::size_t i = 0; i < batch.size(); ++i)
     {
-        RespawnInfoWithHandle* next = _respawnTimes->top();
-        if (now < next->respawnTime) // done for this tick
-            break;
+        RespawnInfoWithHandle* next = batch[i];
+        if (next->removed) // deleted by outside logic while waiting in this batch
+        {
+            delete next;
+            continue;
+        }
+
+        if (!i || batch[i - 1]->gridId != next->gridId)
+            gridLoaded = IsGridLoaded(next->gridId);
+
+        maxLatency = std::max(maxLatency, now - next->respawnTime);
 
         if (uint32 poolId = sPoolMgr->IsPartOfAPool(next->type, next->spawnId)) // is this part of a pool?
         { // if yes, respawn will be handled by (external) pooling logic, just delete the respawn time
             // step 1: remove entry from maps to avoid it being reachable by outside logic
-            _respawnTimes->pop();
             GetRespawnMapForType(next->type).erase(next->spawnId);
 
             // step 2: tell pooling logic to do its thing
@@ -3295,11 +3426,12 @@ void Map::ProcessRespawns()
         else if (CheckRespawn(next)) // see if we're allowed to respawn
         { // ok, respawn
             // step 1: remove entry from maps to avoid it being reachable by outside logic
-            _respawnTimes->pop();
             GetRespawnMapForType(next->type).erase(next->spawnId);
 
             // step 2: do the respawn, which involves external logic
-            DoRespawn(next->type, next->spawnId, next->gridId);
+            // if grid isn't loaded, this will be processed in grid load handler
+            if (gridLoaded)
+                DoRespawn(next->type, next->spawnId);
 
             // step 3: get rid of the actual entry
             RemoveRespawnTime(next->type, next->spawnId, nullptr, true);
@@ -3307,18 +3439,28 @@ void Map::ProcessRespawns()
         }
         else if (!next->respawnTime)
         { // just remove this respawn entry without rescheduling
-            _respawnTimes->pop();
             GetRespawnMapForType(next->type).erase(next->spawnId);
             RemoveRespawnTime(next->type, next->spawnId, nullptr, true);
             delete next;
         }
         else
-        { // new respawn time, update heap position
+        { // new respawn time, back on the schedule
             ASSERT(now < next->respawnTime); // infinite loop guard
-            _respawnTimes->decrease(next->handle);
+            next->handle = _respawnTimes->Schedule(next->respawnTime, next);
             SaveRespawnInfoDB(*next);
         }
     }
+
+    TC_METRIC_VALUE("map_respawn_backlog", uint64(backlog),
+        TC_METRIC_TAG("map_id", std::to_string(GetId())),
+        TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (!batch.empty())
+        TC_METRIC_VALUE("map_respawn_latency", uint64(maxLatency),
+            TC_METRIC_TAG("map_id", std::to_string(GetId())),
+            TC_METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    return !backlog;
 }
 
 void Map::ApplyDynamicModeRespawnScaling(WorldObject const* obj, ObjectGuid::LowType spawnId, uint32& respawnDelay, uint32 mode) const
@@ -3532,6 +3674,100 @@ void Map::AddFarSpellCallback(FarSpellCallback&& callback)
     _farSpellCallbacks.Enqueue(new FarSpellCallback(std::move(callback)));
 }
 
+void Map::QueueGameEventSpawnChanges(std::vector<GameEventSpawnChange>&& changes)
+{
+    _queuedGameEventSpawnChanges.Enqueue(new std::vector<GameEventSpawnChange>(std::move(changes)));
+}
+
+void Map::ProcessGameEventSpawnChanges()
+{
+    std::vector<GameEventSpawnChange>* queued;
+    while (_queuedGameEventSpawnChanges.Dequeue(queued))
+    {
+        _gameEventSpawnChanges.insert(_gameEventSpawnChanges.end(), queued->begin(), queued->end());
+        delete queued;
+    }
+
+    // changes are applied in the order they were queued, a spawn and a later despawn of the same object stay in order
+    uint32 const budget = sWorld->getIntConfig(CONFIG_EVENT_MAX_SPAWN_CHANGES_PER_MAP_UPDATE);
+    for (uint32 processed = 0; !_gameEventSpawnChanges.empty() && (!budget || processed < budget); ++processed)
+    {
+        ApplyGameEventSpawnChange(_gameEventSpawnChanges.front());
+        _gameEventSpawnChanges.pop_front();
+    }
+}
+
+void Map::ApplyGameEventSpawnChange(GameEventSpawnChange const& change)
+{
+    RemoveRespawnTime(change.Type, change.SpawnId);
+
+    if (!change.Spawn)
+    {
+        switch (change.Type)
+        {
+            case SPAWN_TYPE_CREATURE:
+            {
+                auto creatureBounds = GetCreatureBySpawnIdStore().equal_range(change.SpawnId);
+                for (auto itr = creatureBounds.first; itr != creatureBounds.second;)
+                {
+                    Creature* creature = itr->second;
+                    ++itr;
+                    creature->AddObjectToRemoveList();
+                }
+                break;
+            }
+            case SPAWN_TYPE_GAMEOBJECT:
+            {
+                auto gameobjectBounds = GetGameObjectBySpawnIdStore().equal_range(change.SpawnId);
+                for (auto itr = gameobjectBounds.first; itr != gameobjectBounds.second;)
+                {
+                    GameObject* go = itr->second;
+                    ++itr;
+                    go->AddObjectToRemoveList();
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        return;
+    }
+
+    // Spawn if necessary (loaded grids only), grids loaded since the change was queued already spawned it
+    if (Instanceable())
+        return;
+
+    switch (change.Type)
+    {
+        case SPAWN_TYPE_CREATURE:
+        {
+            CreatureData const* data = sObjectMgr->GetCreatureData(change.SpawnId);
+            if (!data || !IsGridLoaded(data->spawnPoint))
+                break;
+
+            Creature* creature = new Creature();
+            if (!creature->LoadFromDB(change.SpawnId, this, true, false))
+                delete creature;
+            break;
+        }
+        case SPAWN_TYPE_GAMEOBJECT:
+        {
+            GameObjectData const* data = sObjectMgr->GetGameObjectData(change.SpawnId);
+            if (!data || !IsGridLoaded(data->spawnPoint) || GetGameObjectBySpawnIdStore().count(change.SpawnId))
+                break;
+
+            GameObject* gameobject = new GameObject();
+            if (!gameobject->LoadFromDB(change.SpawnId, this, false))
+                delete gameobject;
+            else if (gameobject->isSpawnedByDefault())
+                AddToMap(gameobject);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
 void Map::DelayedUpdate(uint32 t_diff)
 {
     {
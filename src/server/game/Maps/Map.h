@@ -24,6 +24,7 @@
 #include "DynamicTree.h"
 #include "GridDefines.h"
 #include "GridRefManager.h"
+#include "LineOfSightCache.h"
 #include "MapDefines.h"
 #include "MapRefManager.h"
 #include "MPSCQueue.h"
@@ -35,9 +36,11 @@
 #include "Transaction.h"
 #include "UniqueTrackablePtr.h"
 #include <bitset>
+#include <deque>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <span>
 #ifdef ELUNA
 #include "LuaValue.h"
 #endif
@@ -73,7 +76,7 @@ enum Difficulty : uint8;
 enum WeatherState : uint32;
 
 namespace Trinity { struct ObjectUpdater; }
-namespace VMAP { enum class ModelIgnoreFlags : uint32; }
+namespace VMAP { enum class ModelIgnoreFlags : uint32; struct LineOfSightRay; }
 namespace G3D { class Plane; }
 
 struct ScriptAction
@@ -251,10 +254,6 @@ struct ZoneDynamicInfo
 #define MAP_INVALID_ZONE      0xFFFFFFFF
 
 struct RespawnInfo; // forward declaration
-struct CompareRespawnInfo
-{
-    bool operator()(RespawnInfo const* a, RespawnInfo const* b) const;
-};
 using ZoneDynamicInfoMap = std::unordered_map<uint32 /*zoneId*/, ZoneDynamicInfo>;
 struct RespawnListContainer;
 using RespawnInfoMap = std::unordered_map<ObjectGuid::LowType, RespawnInfo*>;
@@ -268,17 +267,6 @@ struct TC_GAME_API RespawnInfo
     time_t respawnTime;
     uint32 gridId;
 };
-inline bool CompareRespawnInfo::operator()(RespawnInfo const* a, RespawnInfo const* b) const
-{
-    if (a == b)
-        return false;
-    if (a->respawnTime != b->respawnTime)
-        return (a->respawnTime > b->respawnTime);
-    if (a->spawnId != b->spawnId)
-        return a->spawnId < b->spawnId;
-    ASSERT(a->type != b->type, "Duplicate respawn entry for spawnId (%u,%u) found!", a->type, a->spawnId);
-    return a->type < b->type;
-}
 
 extern template class TypeUnorderedMapContainer<AllMapStoredObjectTypes, ObjectGuid>;
 typedef TypeUnorderedMapContainer<AllMapStoredObjectTypes, ObjectGuid> MapStoredObjectTypesContainer;
@@ -320,8 +308,9 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         void PlayerRelocation(Player*, float x, float y, float z, float orientation);
         void CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail = true);
-        void GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail = true);
-        void DynamicObjectRelocation(DynamicObject* go, float x, float y, float z, float orientation);
+        // updateVisibility false leaves the visibility update of objects relocated within their cell to the caller
+        void GameObjectRelocation(GameObject* go, float x, float y, float z, float orientation, bool respawnRelocationOnFail = true, bool updateVisibility = true);
+        void DynamicObjectRelocation(DynamicObject* go, float x, float y, float z, float orientation, bool updateVisibility = true);
 
         template<class T, class CONTAINER>
         void Visit(Cell const& cell, TypeContainerVisitor<T, CONTAINER>& visitor);
@@ -537,9 +526,13 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const { return std::max<float>(GetHeight(x, y, z, vmap, maxSearchDist), GetGameObjectFloor(phasemask, x, y, z, maxSearchDist)); }
         float GetHeight(uint32 phasemask, Position const& pos, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const { return GetHeight(phasemask, pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), vmap, maxSearchDist); }
         bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+        // Same as isInLineOfSight for every ray, static geometry of all rays not cached yet is tested in one batch
+        void isInLineOfSight(std::span<VMAP::LineOfSightRay> rays, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+        // Must be called when a game object model changes in a way the dynamic tree does not see, like collision being toggled
+        void InvalidateDynamicLineOfSight() { ++_dynamicLineOfSightGeneration; }
         void Balance() { _dynamicTree.balance(); }
-        void RemoveGameObjectModel(GameObjectModel const& model) { _dynamicTree.remove(model); }
-        void InsertGameObjectModel(GameObjectModel const& model) { _dynamicTree.insert(model); }
+        void RemoveGameObjectModel(GameObjectModel const& model) { _dynamicTree.remove(model); InvalidateDynamicLineOfSight(); }
+        void InsertGameObjectModel(GameObjectModel const& model) { _dynamicTree.insert(model); InvalidateDynamicLineOfSight(); }
         bool ContainsGameObjectModel(GameObjectModel const& model) const { return _dynamicTree.contains(model);}
         float GetGameObjectFloor(uint32 phasemask, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
         {
@@ -685,6 +678,14 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         float m_VisibleDistance;
         DynamicMapTree _dynamicTree;
 
+        bool IsInStaticLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, VMAP::ModelIgnoreFlags ignoreFlags) const;
+        bool IsInDynamicLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const;
+
+        // map thread only; static results live until vmap tiles of the map change, dynamic ones for one update at most
+        mutable VMAP::LineOfSightCache _staticLineOfSightCache;
+        mutable VMAP::LineOfSightCache _dynamicLineOfSightCache;
+        uint32 _dynamicLineOfSightGeneration;
+
         MapRefManager m_mapRefManager;
         MapRefManager::iterator m_mapRefIter;
 
@@ -733,7 +734,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         ScriptScheduleMap m_scriptSchedule;
 
     public:
-        void ProcessRespawns();
+        // Handles due respawns up to Respawn.MaxPerCheck, returns false while more are due
+        bool ProcessRespawns();
         void ApplyDynamicModeRespawnScaling(WorldObject const* obj, ObjectGuid::LowType spawnId, uint32& respawnDelay, uint32 mode) const;
 
     private:
@@ -741,7 +743,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         // if return value is false, reschedule the respawn to new value of info->respawnTime iff nonzero, delete otherwise
         // if return value is false and info->respawnTime is nonzero, it is guaranteed to be greater than time(NULL)
         bool CheckRespawn(RespawnInfo* info);
-        void DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId, uint32 gridId);
+        void DoRespawn(SpawnObjectType type, ObjectGuid::LowType spawnId);
         bool AddRespawnInfo(RespawnInfo const& info);
         void UnloadAllRespawnInfos();
         RespawnInfo* GetRespawnInfo(SpawnObjectType type, ObjectGuid::LowType spawnId) const;
@@ -786,6 +788,16 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 
         typedef std::function<void(Map*)> FarSpellCallback;
         void AddFarSpellCallback(FarSpellCallback&& callback);
+
+        // Spawns and despawns of game event objects, queued by GameEventMgr and applied by the map's own
+        // update, up to Event.MaxSpawnChangesPerMapUpdate of them per update
+        struct GameEventSpawnChange
+        {
+            SpawnObjectType Type;
+            ObjectGuid::LowType SpawnId;
+            bool Spawn;
+        };
+        void QueueGameEventSpawnChanges(std::vector<GameEventSpawnChange>&& changes);
         bool IsParentMap() const { return GetParent() == this; }
 #ifdef ELUNA
         Eluna* GetEluna() const;
@@ -871,6 +883,12 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         std::unordered_set<Object*> _updateObjects;
 
         MPSCQueue<FarSpellCallback> _farSpellCallbacks;
+
+        void ProcessGameEventSpawnChanges();
+        void ApplyGameEventSpawnChange(GameEventSpawnChange const& change);
+
+        MPSCQueue<std::vector<GameEventSpawnChange>> _queuedGameEventSpawnChanges;
+        std::deque<GameEventSpawnChange> _gameEventSpawnChanges;
 #ifdef ELUNA
         std::unique_ptr<Eluna> eluna;
 #endif
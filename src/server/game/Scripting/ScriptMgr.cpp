@@ -892,6 +892,79 @@ public:
     }
 };
 
+/// Scripts of ScriptType by the hooks they override, a hook nobody overrides costs a single empty check
+template<typename ScriptType>
+class ScriptHookTable
+{
+    ScriptHookTable() { }
+
+public:
+    static constexpr std::size_t HookCount = typename ScriptType::HookMask().size();
+
+    static ScriptHookTable* Instance()
+    {
+        static ScriptHookTable instance;
+        return &instance;
+    }
+
+    template<typename ScriptStoreType>
+    void Build(ScriptStoreType const& scripts, std::string const* releasedContext)
+    {
+        Clear();
+        for (auto const& [context, script] : scripts)
+        {
+            if (releasedContext && context == *releasedContext)
+                continue;
+
+            typename ScriptType::HookMask const& hooks = script->GetHooks();
+            for (std::size_t hook = 0; hook < HookCount; ++hook)
+                if (hooks[hook])
+                    _hooks[hook].push_back(script.get());
+        }
+    }
+
+    void Clear()
+    {
+        for (std::vector<ScriptType*>& scripts : _hooks)
+            scripts.clear();
+    }
+
+    std::vector<ScriptType*> const& GetScripts(std::size_t hook) const { return _hooks[hook]; }
+
+private:
+    std::array<std::vector<ScriptType*>, HookCount> _hooks;
+};
+
+/// This hook is responsible for rebuilding the hook tables of UnitScript's and PlayerScript's
+template<typename ScriptType, typename Base>
+class ScriptHookTableRegistrySwapHooks
+    : public ScriptRegistrySwapHookBase
+{
+public:
+    void BeforeReleaseContext(std::string const& context) final override
+    {
+        ScriptHookTable<ScriptType>::Instance()->Build(static_cast<Base*>(this)->_scripts, &context);
+    }
+
+    void BeforeSwapContext(bool /*initialize*/) override
+    {
+        ScriptHookTable<ScriptType>::Instance()->Build(static_cast<Base*>(this)->_scripts, nullptr);
+    }
+
+    void BeforeUnload() final override
+    {
+        ScriptHookTable<ScriptType>::Instance()->Clear();
+    }
+};
+
+template<typename Base>
+class ScriptRegistrySwapHooks<UnitScript, Base>
+    : public ScriptHookTableRegistrySwapHooks<UnitScript, Base> { };
+
+template<typename Base>
+class ScriptRegistrySwapHooks<PlayerScript, Base>
+    : public ScriptHookTableRegistrySwapHooks<PlayerScript, Base> { };
+
 // Database unbound script registry
 template<typename ScriptType>
 class SpecializedScriptRegistry<ScriptType, false>
@@ -901,6 +974,9 @@ class SpecializedScriptRegistry<ScriptType, false>
     template<typename, typename>
     friend class ScriptRegistrySwapHooks;
 
+    template<typename, typename>
+    friend class ScriptHookTableRegistrySwapHooks;
+
 public:
     typedef std::unordered_multimap<std::string /*context*/, std::unique_ptr<ScriptType>> ScriptStoreType;
     typedef typename ScriptStoreType::iterator ScriptStoreIteratorType;
@@ -987,6 +1063,11 @@ private:
     FOR_SCRIPTS(T, itr, end) \
         itr->second
 
+// Only visits the scripts overriding hook H
+#define FOREACH_SCRIPT_HOOK(T, H) \
+    for (T* script : ScriptHookTable<T>::Instance()->GetScripts(H)) \
+        script
+
 // Utility macros for finding specific scripts.
 #define GET_SCRIPT(T, I, V) \
     T* V = ScriptRegistry<T>::Instance()->GetScriptById(I); \
@@ -1515,7 +1596,7 @@ void ScriptMgr::OnPlayerEnterMap(Map* map, Player* player)
         e->OnPlayerEnter(map, player);
 #endif
 
-    FOREACH_SCRIPT(PlayerScript)->OnMapChanged(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_MAP_CHANGED)->OnMapChanged(player);
 
     SCR_MAP_BGN(WorldMapScript, map, itr, end, entry, IsWorldMap);
         itr->second->OnPlayerEnter(map, player);
@@ -1989,7 +2070,7 @@ void ScriptMgr::OnPVPKill(Player* killer, Player* killed)
     if (Eluna* e = killer->GetEluna())
         e->OnPVPKill(killer, killed);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnPVPKill(killer, killed);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_PVP_KILL)->OnPVPKill(killer, killed);
 }
 
 void ScriptMgr::OnCreatureKill(Player* killer, Creature* killed)
@@ -1998,7 +2079,7 @@ void ScriptMgr::OnCreatureKill(Player* killer, Creature* killed)
     if(Eluna * e = killer->GetEluna())
         e->OnCreatureKill(killer, killed);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnCreatureKill(killer, killed);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_CREATURE_KILL)->OnCreatureKill(killer, killed);
 }
 
 void ScriptMgr::OnPlayerKilledByCreature(Creature* killer, Player* killed)
@@ -2007,7 +2088,7 @@ void ScriptMgr::OnPlayerKilledByCreature(Creature* killer, Player* killed)
     if (Eluna* e = killer->GetEluna())
         e->OnPlayerKilledByCreature(killer, killed);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnPlayerKilledByCreature(killer, killed);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_PLAYER_KILLED_BY_CREATURE)->OnPlayerKilledByCreature(killer, killed);
 }
 
 void ScriptMgr::OnPlayerLevelChanged(Player* player, uint8 oldLevel)
@@ -2016,7 +2097,7 @@ void ScriptMgr::OnPlayerLevelChanged(Player* player, uint8 oldLevel)
     if (Eluna* e = player->GetEluna())
         e->OnLevelChanged(player, oldLevel);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnLevelChanged(player, oldLevel);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_LEVEL_CHANGED)->OnLevelChanged(player, oldLevel);
 }
 
 void ScriptMgr::OnPlayerFreeTalentPointsChanged(Player* player, uint32 points)
@@ -2025,7 +2106,7 @@ void ScriptMgr::OnPlayerFreeTalentPointsChanged(Player* player, uint32 points)
     if (Eluna* e = player->GetEluna())
         e->OnFreeTalentPointsChanged(player, points);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnFreeTalentPointsChanged(player, points);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_FREE_TALENT_POINTS_CHANGED)->OnFreeTalentPointsChanged(player, points);
 }
 
 void ScriptMgr::OnPlayerTalentsReset(Player* player, bool involuntarily)
@@ -2034,7 +2115,7 @@ void ScriptMgr::OnPlayerTalentsReset(Player* player, bool involuntarily)
     if (Eluna* e = player->GetEluna())
         e->OnTalentsReset(player, involuntarily);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnTalentsReset(player, involuntarily);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_TALENTS_RESET)->OnTalentsReset(player, involuntarily);
 }
 
 void ScriptMgr::OnPlayerMoneyChanged(Player* player, int32& amount)
@@ -2043,12 +2124,12 @@ void ScriptMgr::OnPlayerMoneyChanged(Player* player, int32& amount)
     if (Eluna* e = player->GetEluna())
         e->OnMoneyChanged(player, amount);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnMoneyChanged(player, amount);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_MONEY_CHANGED)->OnMoneyChanged(player, amount);
 }
 
 void ScriptMgr::OnPlayerMoneyLimit(Player* player, int32 amount)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnMoneyLimit(player, amount);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_MONEY_LIMIT)->OnMoneyLimit(player, amount);
 }
 
 void ScriptMgr::OnGivePlayerXP(Player* player, uint32& amount, Unit* victim)
@@ -2057,7 +2138,7 @@ void ScriptMgr::OnGivePlayerXP(Player* player, uint32& amount, Unit* victim)
     if (Eluna* e = player->GetEluna())
         e->OnGiveXP(player, amount, victim);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnGiveXP(player, amount, victim);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_GIVE_XP)->OnGiveXP(player, amount, victim);
 }
 
 void ScriptMgr::OnPlayerReputationChange(Player* player, uint32 factionID, int32& standing, bool incremental)
@@ -2066,7 +2147,7 @@ void ScriptMgr::OnPlayerReputationChange(Player* player, uint32 factionID, int32
     if (Eluna* e = player->GetEluna())
         e->OnReputationChange(player, factionID, standing, incremental);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnReputationChange(player, factionID, standing, incremental);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_REPUTATION_CHANGE)->OnReputationChange(player, factionID, standing, incremental);
 }
 
 void ScriptMgr::OnPlayerDuelRequest(Player* target, Player* challenger)
@@ -2075,7 +2156,7 @@ void ScriptMgr::OnPlayerDuelRequest(Player* target, Player* challenger)
     if (Eluna* e = target->GetEluna())
         e->OnDuelRequest(target, challenger);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnDuelRequest(target, challenger);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_DUEL_REQUEST)->OnDuelRequest(target, challenger);
 }
 
 void ScriptMgr::OnPlayerDuelStart(Player* player1, Player* player2)
@@ -2084,7 +2165,7 @@ void ScriptMgr::OnPlayerDuelStart(Player* player1, Player* player2)
     if (Eluna* e = player1->GetEluna())
         e->OnDuelStart(player1, player2);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnDuelStart(player1, player2);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_DUEL_START)->OnDuelStart(player1, player2);
 }
 
 void ScriptMgr::OnPlayerDuelEnd(Player* winner, Player* loser, DuelCompleteType type)
@@ -2093,32 +2174,32 @@ void ScriptMgr::OnPlayerDuelEnd(Player* winner, Player* loser, DuelCompleteType
     if (Eluna* e = winner->GetEluna())
         e->OnDuelEnd(winner, loser, type);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnDuelEnd(winner, loser, type);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_DUEL_END)->OnDuelEnd(winner, loser, type);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_CHAT)->OnChat(player, type, lang, msg);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Player* receiver)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, receiver);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_CHAT_WHISPER)->OnChat(player, type, lang, msg, receiver);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Group* group)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, group);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_CHAT_GROUP)->OnChat(player, type, lang, msg, group);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Guild* guild)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, guild);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_CHAT_GUILD)->OnChat(player, type, lang, msg, guild);
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Channel* channel)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, channel);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_CHAT_CHANNEL)->OnChat(player, type, lang, msg, channel);
 }
 
 void ScriptMgr::OnPlayerEmote(Player* player, Emote emote)
@@ -2127,7 +2208,7 @@ void ScriptMgr::OnPlayerEmote(Player* player, Emote emote)
     if (Eluna* e = player->GetEluna())
         e->OnEmote(player, emote);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnEmote(player, emote);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_EMOTE)->OnEmote(player, emote);
 }
 
 void ScriptMgr::OnPlayerTextEmote(Player* player, uint32 textEmote, uint32 emoteNum, ObjectGuid guid)
@@ -2136,7 +2217,7 @@ void ScriptMgr::OnPlayerTextEmote(Player* player, uint32 textEmote, uint32 emote
     if (Eluna* e = player->GetEluna())
         e->OnTextEmote(player, textEmote, emoteNum, guid);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnTextEmote(player, textEmote, emoteNum, guid);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_TEXT_EMOTE)->OnTextEmote(player, textEmote, emoteNum, guid);
 }
 
 void ScriptMgr::OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck)
@@ -2145,7 +2226,7 @@ void ScriptMgr::OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck)
     if (Eluna* e = player->GetEluna())
         e->OnSpellCast(player, spell, skipCheck);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnSpellCast(player, spell, skipCheck);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_SPELL_CAST)->OnSpellCast(player, spell, skipCheck);
 }
 
 void ScriptMgr::OnPlayerLogin(Player* player, bool firstLogin)
@@ -2159,7 +2240,7 @@ void ScriptMgr::OnPlayerLogin(Player* player, bool firstLogin)
         e->OnLogin(player);
     }
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnLogin(player, firstLogin);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_LOGIN)->OnLogin(player, firstLogin);
 }
 
 void ScriptMgr::OnPlayerLogout(Player* player)
@@ -2168,7 +2249,7 @@ void ScriptMgr::OnPlayerLogout(Player* player)
     if (Eluna* e = sWorld->GetEluna())
         e->OnLogout(player);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnLogout(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_LOGOUT)->OnLogout(player);
 }
 
 void ScriptMgr::OnPlayerCreate(Player* player)
@@ -2177,7 +2258,7 @@ void ScriptMgr::OnPlayerCreate(Player* player)
     if (Eluna* e = sWorld->GetEluna())
         e->OnCreate(player);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnCreate(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_CREATE)->OnCreate(player);
 }
 
 void ScriptMgr::OnPlayerDelete(ObjectGuid guid, uint32 accountId)
@@ -2186,12 +2267,12 @@ void ScriptMgr::OnPlayerDelete(ObjectGuid guid, uint32 accountId)
     if (Eluna* e = sWorld->GetEluna())
         e->OnDelete(GUID_LOPART(guid));
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnDelete(guid, accountId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_DELETE)->OnDelete(guid, accountId);
 }
 
 void ScriptMgr::OnPlayerFailedDelete(ObjectGuid guid, uint32 accountId)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnFailedDelete(guid, accountId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_FAILED_DELETE)->OnFailedDelete(guid, accountId);
 }
 
 void ScriptMgr::OnPlayerSave(Player* player)
@@ -2200,7 +2281,7 @@ void ScriptMgr::OnPlayerSave(Player* player)
     if (Eluna* e = player->GetEluna())
         e->OnSave(player);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnSave(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_SAVE)->OnSave(player);
 }
 
 void ScriptMgr::OnPlayerBindToInstance(Player* player, Difficulty difficulty, uint32 mapid, bool permanent, uint8 extendState)
@@ -2209,7 +2290,7 @@ void ScriptMgr::OnPlayerBindToInstance(Player* player, Difficulty difficulty, ui
     if (Eluna* e = player->GetEluna())
         e->OnBindToInstance(player, difficulty, mapid, permanent);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnBindToInstance(player, difficulty, mapid, permanent, extendState);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_BIND_TO_INSTANCE)->OnBindToInstance(player, difficulty, mapid, permanent, extendState);
 }
 
 void ScriptMgr::OnPlayerUpdateZone(Player* player, uint32 newZone, uint32 newArea)
@@ -2218,7 +2299,7 @@ void ScriptMgr::OnPlayerUpdateZone(Player* player, uint32 newZone, uint32 newAre
     if (Eluna* e = player->GetEluna())
         e->OnUpdateZone(player, newZone, newArea);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnUpdateZone(player, newZone, newArea);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_UPDATE_ZONE)->OnUpdateZone(player, newZone, newArea);
 }
 
 void ScriptMgr::OnGossipSelect(Player* player, uint32 menu_id, uint32 sender, uint32 action)
@@ -2227,7 +2308,7 @@ void ScriptMgr::OnGossipSelect(Player* player, uint32 menu_id, uint32 sender, ui
     if (Eluna* e = player->GetEluna())
         e->HandleGossipSelectOption(player, menu_id, sender, action, "");
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnGossipSelect(player, menu_id, sender, action);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_GOSSIP_SELECT)->OnGossipSelect(player, menu_id, sender, action);
 }
 
 void ScriptMgr::OnGossipSelectCode(Player* player, uint32 menu_id, uint32 sender, uint32 action, const char* code)
@@ -2236,7 +2317,7 @@ void ScriptMgr::OnGossipSelectCode(Player* player, uint32 menu_id, uint32 sender
     if (Eluna* e = player->GetEluna())
         e->HandleGossipSelectOption(player, menu_id, sender, action, code);
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnGossipSelectCode(player, menu_id, sender, action, code);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_GOSSIP_SELECT_CODE)->OnGossipSelectCode(player, menu_id, sender, action, code);
 }
 
 void ScriptMgr::OnQuestStatusChange(Player* player, uint32 questId)
@@ -2249,22 +2330,22 @@ void ScriptMgr::OnQuestStatusChange(Player* player, uint32 questId)
         e->OnQuestStatusChanged(player, questId, qStatus);
     }
 #endif
-    FOREACH_SCRIPT(PlayerScript)->OnQuestStatusChange(player, questId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_QUEST_STATUS_CHANGE)->OnQuestStatusChange(player, questId);
 }
 
 void ScriptMgr::OnPlayerRepop(Player* player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnPlayerRepop(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_PLAYER_REPOP)->OnPlayerRepop(player);
 }
 
 void ScriptMgr::OnQuestObjectiveProgress(Player* player, Quest const* quest, uint32 objectiveIndex, uint16 progress)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnQuestObjectiveProgress(player, quest, objectiveIndex, progress);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_QUEST_OBJECTIVE_PROGRESS)->OnQuestObjectiveProgress(player, quest, objectiveIndex, progress);
 }
 
 void ScriptMgr::OnMovieComplete(Player* player, uint32 movieId)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnMovieComplete(player, movieId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, PLAYER_HOOK_ON_MOVIE_COMPLETE)->OnMovieComplete(player, movieId);
 }
 
 // Account
@@ -2453,27 +2534,27 @@ void ScriptMgr::OnGroupDisband(Group* group)
 // Unit
 void ScriptMgr::OnHeal(Unit* healer, Unit* reciever, uint32& gain)
 {
-    FOREACH_SCRIPT(UnitScript)->OnHeal(healer, reciever, gain);
+    FOREACH_SCRIPT_HOOK(UnitScript, UNIT_HOOK_ON_HEAL)->OnHeal(healer, reciever, gain);
 }
 
 void ScriptMgr::OnDamage(Unit* attacker, Unit* victim, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->OnDamage(attacker, victim, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, UNIT_HOOK_ON_DAMAGE)->OnDamage(attacker, victim, damage);
 }
 
 void ScriptMgr::ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifyPeriodicDamageAurasTick(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, UNIT_HOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK)->ModifyPeriodicDamageAurasTick(target, attacker, damage);
 }
 
 void ScriptMgr::ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifyMeleeDamage(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, UNIT_HOOK_MODIFY_MELEE_DAMAGE)->ModifyMeleeDamage(target, attacker, damage);
 }
 
 void ScriptMgr::ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifySpellDamageTaken(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, UNIT_HOOK_MODIFY_SPELL_DAMAGE_TAKEN)->ModifySpellDamageTaken(target, attacker, damage);
 }
 
 SpellScriptLoader::SpellScriptLoader(char const* name)
@@ -2709,6 +2790,7 @@ bool ItemScript::OnCastItemCombatSpell(Player* /*player*/, Unit* /*victim*/, Spe
 UnitScript::UnitScript(char const* name)
     : ScriptObject(name)
 {
+    _hooks.set();
     ScriptRegistry<UnitScript>::Instance()->AddScript(this);
 }
 
@@ -2916,6 +2998,7 @@ AchievementCriteriaScript::AchievementCriteriaScript(char const* name)
 PlayerScript::PlayerScript(char const* name)
     : ScriptObject(name)
 {
+    _hooks.set();
     ScriptRegistry<PlayerScript>::Instance()->AddScript(this);
 }
 
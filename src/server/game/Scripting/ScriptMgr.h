@@ -22,7 +22,9 @@
 #include "ObjectGuid.h"
 #include "Tuples.h"
 #include "Types.h"
+#include <bitset>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 class AccountMgr;
@@ -384,6 +386,34 @@ class TC_GAME_API ItemScript : public ScriptObject
         virtual void OnGossipSelectCode(Player* /*player*/, Item* /*item*/, uint32 /*sender*/, uint32 /*action*/, const char* /*code*/) { }
 };
 
+// True when the hook overload matching Signature is declared by a class derived from Base, that is the script overrides it.
+// Signature picks the overload, the deduced class is the one declaring it.
+template<typename Base, typename Signature, typename Class>
+constexpr bool IsScriptHookOverridden(Signature Class::* /*hook*/)
+{
+    return !std::is_same_v<Class, Base>;
+}
+
+// An overload hidden by a differently overloaded hook in T cannot be resolved, count it as overridden to stay on the safe side
+#define TC_SCRIPT_HOOK_OVERRIDDEN(Base, Signature, hook) \
+    [] \
+    { \
+        if constexpr (requires { IsScriptHookOverridden<Base, Signature>(&hook); }) \
+            return IsScriptHookOverridden<Base, Signature>(&hook); \
+        else \
+            return true; \
+    }()
+
+enum UnitScriptHook : uint8
+{
+    UNIT_HOOK_ON_HEAL,
+    UNIT_HOOK_ON_DAMAGE,
+    UNIT_HOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK,
+    UNIT_HOOK_MODIFY_MELEE_DAMAGE,
+    UNIT_HOOK_MODIFY_SPELL_DAMAGE_TAKEN,
+    UNIT_HOOK_END
+};
+
 class TC_GAME_API UnitScript : public ScriptObject
 {
     protected:
@@ -391,6 +421,15 @@ class TC_GAME_API UnitScript : public ScriptObject
         explicit UnitScript(char const* name);
 
     public:
+        typedef std::bitset<UNIT_HOOK_END> HookMask;
+
+        // Hooks ScriptMgr calls this script for, every hook unless the script was added through RegisterUnitScript
+        HookMask const& GetHooks() const { return _hooks; }
+        void SetHooks(HookMask const& hooks) { _hooks = hooks; }
+
+        template<typename T>
+        static HookMask GetOverriddenHooks();
+
         // Called when a unit deals healing to another unit
         virtual void OnHeal(Unit* healer, Unit* reciever, uint32& gain);
 
@@ -405,8 +444,23 @@ class TC_GAME_API UnitScript : public ScriptObject
 
         // Called when Spell Damage is being Dealt
         virtual void ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& damage);
+
+    private:
+        HookMask _hooks;
 };
 
+template<typename T>
+UnitScript::HookMask UnitScript::GetOverriddenHooks()
+{
+    HookMask hooks;
+    hooks[UNIT_HOOK_ON_HEAL] = TC_SCRIPT_HOOK_OVERRIDDEN(UnitScript, void(Unit*, Unit*, uint32&), T::OnHeal);
+    hooks[UNIT_HOOK_ON_DAMAGE] = TC_SCRIPT_HOOK_OVERRIDDEN(UnitScript, void(Unit*, Unit*, uint32&), T::OnDamage);
+    hooks[UNIT_HOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK] = TC_SCRIPT_HOOK_OVERRIDDEN(UnitScript, void(Unit*, Unit*, uint32&), T::ModifyPeriodicDamageAurasTick);
+    hooks[UNIT_HOOK_MODIFY_MELEE_DAMAGE] = TC_SCRIPT_HOOK_OVERRIDDEN(UnitScript, void(Unit*, Unit*, uint32&), T::ModifyMeleeDamage);
+    hooks[UNIT_HOOK_MODIFY_SPELL_DAMAGE_TAKEN] = TC_SCRIPT_HOOK_OVERRIDDEN(UnitScript, void(Unit*, Unit*, int32&), T::ModifySpellDamageTaken);
+    return hooks;
+}
+
 class TC_GAME_API CreatureScript : public ScriptObject
 {
     protected:
@@ -623,6 +677,47 @@ class TC_GAME_API AchievementCriteriaScript : public ScriptObject
         virtual bool OnCheck(Player* source, Unit* target) = 0;
 };
 
+enum PlayerScriptHook : uint8
+{
+    PLAYER_HOOK_ON_PVP_KILL,
+    PLAYER_HOOK_ON_CREATURE_KILL,
+    PLAYER_HOOK_ON_PLAYER_KILLED_BY_CREATURE,
+    PLAYER_HOOK_ON_LEVEL_CHANGED,
+    PLAYER_HOOK_ON_FREE_TALENT_POINTS_CHANGED,
+    PLAYER_HOOK_ON_TALENTS_RESET,
+    PLAYER_HOOK_ON_MONEY_CHANGED,
+    PLAYER_HOOK_ON_MONEY_LIMIT,
+    PLAYER_HOOK_ON_GIVE_XP,
+    PLAYER_HOOK_ON_REPUTATION_CHANGE,
+    PLAYER_HOOK_ON_DUEL_REQUEST,
+    PLAYER_HOOK_ON_DUEL_START,
+    PLAYER_HOOK_ON_DUEL_END,
+    PLAYER_HOOK_ON_CHAT,
+    PLAYER_HOOK_ON_CHAT_WHISPER,
+    PLAYER_HOOK_ON_CHAT_GROUP,
+    PLAYER_HOOK_ON_CHAT_GUILD,
+    PLAYER_HOOK_ON_CHAT_CHANNEL,
+    PLAYER_HOOK_ON_EMOTE,
+    PLAYER_HOOK_ON_TEXT_EMOTE,
+    PLAYER_HOOK_ON_SPELL_CAST,
+    PLAYER_HOOK_ON_LOGIN,
+    PLAYER_HOOK_ON_LOGOUT,
+    PLAYER_HOOK_ON_CREATE,
+    PLAYER_HOOK_ON_DELETE,
+    PLAYER_HOOK_ON_FAILED_DELETE,
+    PLAYER_HOOK_ON_SAVE,
+    PLAYER_HOOK_ON_BIND_TO_INSTANCE,
+    PLAYER_HOOK_ON_UPDATE_ZONE,
+    PLAYER_HOOK_ON_MAP_CHANGED,
+    PLAYER_HOOK_ON_GOSSIP_SELECT,
+    PLAYER_HOOK_ON_GOSSIP_SELECT_CODE,
+    PLAYER_HOOK_ON_QUEST_OBJECTIVE_PROGRESS,
+    PLAYER_HOOK_ON_QUEST_STATUS_CHANGE,
+    PLAYER_HOOK_ON_PLAYER_REPOP,
+    PLAYER_HOOK_ON_MOVIE_COMPLETE,
+    PLAYER_HOOK_END
+};
+
 class TC_GAME_API PlayerScript : public ScriptObject
 {
     protected:
@@ -630,6 +725,14 @@ class TC_GAME_API PlayerScript : public ScriptObject
         explicit PlayerScript(char const* name);
 
     public:
+        typedef std::bitset<PLAYER_HOOK_END> HookMask;
+
+        // Hooks ScriptMgr calls this script for, every hook unless the script was added through RegisterPlayerScript
+        HookMask const& GetHooks() const { return _hooks; }
+        void SetHooks(HookMask const& hooks) { _hooks = hooks; }
+
+        template<typename T>
+        static HookMask GetOverriddenHooks();
 
         // Called when a player kills another player
         virtual void OnPVPKill(Player* killer, Player* killed);
@@ -734,8 +837,55 @@ class TC_GAME_API PlayerScript : public ScriptObject
         // Called when a player completes a movie
         virtual void OnMovieComplete(Player* player, uint32 movieId);
 
+    private:
+        HookMask _hooks;
 };
 
+template<typename T>
+PlayerScript::HookMask PlayerScript::GetOverriddenHooks()
+{
+    HookMask hooks;
+    hooks[PLAYER_HOOK_ON_PVP_KILL] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, Player*), T::OnPVPKill);
+    hooks[PLAYER_HOOK_ON_CREATURE_KILL] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, Creature*), T::OnCreatureKill);
+    hooks[PLAYER_HOOK_ON_PLAYER_KILLED_BY_CREATURE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Creature*, Player*), T::OnPlayerKilledByCreature);
+    hooks[PLAYER_HOOK_ON_LEVEL_CHANGED] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint8), T::OnLevelChanged);
+    hooks[PLAYER_HOOK_ON_FREE_TALENT_POINTS_CHANGED] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32), T::OnFreeTalentPointsChanged);
+    hooks[PLAYER_HOOK_ON_TALENTS_RESET] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, bool), T::OnTalentsReset);
+    hooks[PLAYER_HOOK_ON_MONEY_CHANGED] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, int32&), T::OnMoneyChanged);
+    hooks[PLAYER_HOOK_ON_MONEY_LIMIT] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, int32), T::OnMoneyLimit);
+    hooks[PLAYER_HOOK_ON_GIVE_XP] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32&, Unit*), T::OnGiveXP);
+    hooks[PLAYER_HOOK_ON_REPUTATION_CHANGE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, int32&, bool), T::OnReputationChange);
+    hooks[PLAYER_HOOK_ON_DUEL_REQUEST] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, Player*), T::OnDuelRequest);
+    hooks[PLAYER_HOOK_ON_DUEL_START] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, Player*), T::OnDuelStart);
+    hooks[PLAYER_HOOK_ON_DUEL_END] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, Player*, DuelCompleteType), T::OnDuelEnd);
+    hooks[PLAYER_HOOK_ON_CHAT] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, uint32, std::string&), T::OnChat);
+    hooks[PLAYER_HOOK_ON_CHAT_WHISPER] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, uint32, std::string&, Player*), T::OnChat);
+    hooks[PLAYER_HOOK_ON_CHAT_GROUP] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, uint32, std::string&, Group*), T::OnChat);
+    hooks[PLAYER_HOOK_ON_CHAT_GUILD] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, uint32, std::string&, Guild*), T::OnChat);
+    hooks[PLAYER_HOOK_ON_CHAT_CHANNEL] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, uint32, std::string&, Channel*), T::OnChat);
+    hooks[PLAYER_HOOK_ON_EMOTE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, Emote), T::OnEmote);
+    hooks[PLAYER_HOOK_ON_TEXT_EMOTE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, uint32, ObjectGuid), T::OnTextEmote);
+    hooks[PLAYER_HOOK_ON_SPELL_CAST] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, Spell*, bool), T::OnSpellCast);
+    hooks[PLAYER_HOOK_ON_LOGIN] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, bool), T::OnLogin);
+    hooks[PLAYER_HOOK_ON_LOGOUT] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*), T::OnLogout);
+    hooks[PLAYER_HOOK_ON_CREATE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*), T::OnCreate);
+    hooks[PLAYER_HOOK_ON_DELETE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(ObjectGuid, uint32), T::OnDelete);
+    hooks[PLAYER_HOOK_ON_FAILED_DELETE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(ObjectGuid, uint32), T::OnFailedDelete);
+    hooks[PLAYER_HOOK_ON_SAVE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*), T::OnSave);
+    hooks[PLAYER_HOOK_ON_BIND_TO_INSTANCE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, Difficulty, uint32, bool, uint8), T::OnBindToInstance);
+    hooks[PLAYER_HOOK_ON_UPDATE_ZONE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, uint32), T::OnUpdateZone);
+    hooks[PLAYER_HOOK_ON_MAP_CHANGED] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*), T::OnMapChanged);
+    hooks[PLAYER_HOOK_ON_GOSSIP_SELECT] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, uint32, uint32), T::OnGossipSelect);
+    hooks[PLAYER_HOOK_ON_GOSSIP_SELECT_CODE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32, uint32, uint32, const char*), T::OnGossipSelectCode);
+    hooks[PLAYER_HOOK_ON_QUEST_OBJECTIVE_PROGRESS] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, Quest const*, uint32, uint16), T::OnQuestObjectiveProgress);
+    hooks[PLAYER_HOOK_ON_QUEST_STATUS_CHANGE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32), T::OnQuestStatusChange);
+    hooks[PLAYER_HOOK_ON_PLAYER_REPOP] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*), T::OnPlayerRepop);
+    hooks[PLAYER_HOOK_ON_MOVIE_COMPLETE] = TC_SCRIPT_HOOK_OVERRIDDEN(PlayerScript, void(Player*, uint32), T::OnMovieComplete);
+    return hooks;
+}
+
+#undef TC_SCRIPT_HOOK_OVERRIDDEN
+
 class TC_GAME_API AccountScript : public ScriptObject
 {
     protected:
@@ -1182,6 +1332,10 @@ class FactoryGameObjectScript : public GameObjectScript
 };
 #define RegisterGameObjectAIWithFactory(ai_name, factory_fn) new FactoryGameObjectScript<ai_name, &factory_fn>(#ai_name)
 
+// UnitScript and PlayerScript added through these are only called for the hooks they override
+#define RegisterUnitScript(script_name) (new script_name())->SetHooks(UnitScript::GetOverriddenHooks<script_name>())
+#define RegisterPlayerScript(script_name) (new script_name())->SetHooks(PlayerScript::GetOverriddenHooks<script_name>())
+
 #define sScriptMgr ScriptMgr::instance()
 
 #endif
@@ -73,7 +73,7 @@ class WorldPacket : public ByteBuffer
         void Initialize(uint16 opcode, size_t newres = 200)
         {
             clear();
-            _storage.reserve(newres);
+            reserve(newres);
             m_opcode = opcode;
         }
 
@@ -23,6 +23,7 @@
 #include "AccountMgr.h"
 #include "AddonMgr.h"
 #include "BattlegroundMgr.h"
+#include "CharacterCache.h"
 #include "CharacterPackets.h"
 #include "Config.h"
 #include "Common.h"
@@ -142,6 +143,8 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     m_currentBankerGUID(),
     _timeSyncClockDeltaQueue(std::make_unique<boost::circular_buffer<std::pair<int64, uint32>>>(6)),
     _timeSyncClockDelta(0),
+    _movementRelaysFull(0),
+    _movementRelaysNear(0),
     _pendingTimeSyncRequests(),
     _timeSyncNextCounter(0),
     _timeSyncTimer(0),
@@ -210,11 +213,28 @@ ObjectGuid::LowType WorldSession::GetGUIDLow() const
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet)
 {
-    ASSERT(packet->GetOpcode() != NULL_OPCODE);
+    if (!PrepareSendPacket(*packet))
+        return;
 
-    if (!m_Socket)
+    m_Socket->SendPacket(*packet);
+}
+
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!PrepareSendPacket(*packet))
         return;
 
+    m_Socket->SendPacket(packet);
+}
+
+/// Checks and accounting shared by both SendPacket overloads, returns false if the packet must not be sent
+bool WorldSession::PrepareSendPacket(WorldPacket const& packet)
+{
+    ASSERT(packet.GetOpcode() != NULL_OPCODE);
+
+    if (!m_Socket)
+        return false;
+
 #ifdef TRINITY_DEBUG
     // Code for network use statistic
     static uint64 sendPacketCount = 0;
@@ -231,10 +251,10 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     if ((cur_time - lastTime) < 60)
     {
         sendPacketCount += 1;
-        sendPacketBytes += packet->size();
+        sendPacketBytes += packet.size();
 
         sendLastPacketCount += 1;
-        sendLastPacketBytes += packet->size();
+        sendLastPacketBytes += packet.size();
     }
     else
     {
@@ -245,25 +265,25 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
         lastTime = cur_time;
         sendLastPacketCount = 1;
-        sendLastPacketBytes = packet->wpos();               // wpos is real written size
+        sendLastPacketBytes = packet.wpos();                // wpos is real written size
     }
 #endif                                                      // !TRINITY_DEBUG
 
-    sScriptMgr->OnPacketSend(this, *packet);
+    sScriptMgr->OnPacketSend(this, packet);
 
 #ifdef ELUNA
     if (Player* plr = GetPlayer())
     {
         if (Eluna* e = plr->GetEluna())
         {
-            if (!e->OnPacketSend(this, *packet))
-                return;
+            if (!e->OnPacketSend(this, packet))
+                return false;
         }
     }
 #endif
 
-    TC_LOG_TRACE("network.opcode", "S->C: {} {}", GetPlayerInfo(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())));
-    m_Socket->SendPacket(*packet);
+    TC_LOG_TRACE("network.opcode", "S->C: {} {}", GetPlayerInfo(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet.GetOpcode())));
+    return true;
 }
 
 /// Add an incoming packet to the queue
@@ -469,6 +489,13 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     }
 
     TC_METRIC_VALUE("processed_packets", processedPackets);
+    if (_movementRelaysFull || _movementRelaysNear)
+    {
+        TC_METRIC_VALUE("movement_relay_full", _movementRelaysFull);
+        TC_METRIC_VALUE("movement_relay_near", _movementRelaysNear);
+        _movementRelaysFull = 0;
+        _movementRelaysNear = 0;
+    }
 
     _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
 
@@ -1331,6 +1358,38 @@ void WorldSession::ProcessQueryCallbacks()
     _queryHolderProcessor.ProcessReadyCallbacks();
 }
 
+void WorldSession::QueryCharacterCacheByName(std::string const& name, std::function<void(CharacterCacheEntry const*)>&& callback)
+{
+    if (CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByName(name))
+    {
+        callback(characterInfo);
+        return;
+    }
+
+    if (sCharacterCache->IsComplete())
+    {
+        callback(nullptr);
+        return;
+    }
+
+    // the miss above already queued a fill of the cache, this only answers the current request
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CACHE_BY_NAME);
+    stmt->setString(0, name);
+    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
+        .WithPreparedCallback([callback = std::move(callback)](PreparedQueryResult result)
+    {
+        if (!result)
+        {
+            callback(nullptr);
+            return;
+        }
+
+        CharacterCacheEntry characterInfo;
+        CharacterCache::ReadCharacterCacheEntry(result->Fetch(), characterInfo);
+        callback(&characterInfo);
+    }));
+}
+
 TransactionCallback& WorldSession::AddTransactionCallback(TransactionCallback&& callback)
 {
     return _transactionCallbacks.AddCallback(std::move(callback));
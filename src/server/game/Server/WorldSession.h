@@ -32,6 +32,7 @@
 #include "Packet.h"
 #include "SharedDefines.h"
 #include <boost/circular_buffer_fwd.hpp>
+#include <functional>
 #include <string>
 #include <map>
 #include <memory>
@@ -54,6 +55,7 @@ class WorldSocket;
 struct AddonInfo;
 struct AreaTableEntry;
 struct AuctionEntry;
+struct CharacterCacheEntry;
 struct DeclinedName;
 struct ItemTemplate;
 struct MovementInfo;
@@ -472,6 +474,8 @@ class TC_GAME_API WorldSession
         void static WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
         void SendPacket(WorldPacket const* packet);
+        // the same buffer may be handed to many sessions, it is copied into the socket buffer by the network thread
+        void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
         void SendNotification(const char *format, ...) ATTR_PRINTF(2, 3);
         void SendNotification(uint32 string_id, ...);
         void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName *declinedName);
@@ -685,13 +689,13 @@ class TC_GAME_API WorldSession
         void HandleCharEnum(PreparedQueryResult result);
         void HandlePlayerLogin(LoginQueryHolder const& holder);
         void HandleCharFactionOrRaceChange(WorldPacket& recvData);
-        void HandleCharFactionOrRaceChangeCallback(std::shared_ptr<CharacterFactionChangeInfo> factionChangeInfo, PreparedQueryResult result);
+        void HandleCharFactionOrRaceChangeCallback(std::shared_ptr<CharacterFactionChangeInfo> factionChangeInfo, PreparedQueryResult result, bool nameOwnerChecked);
         void HandleCharRenameOpcode(WorldPacket& recvData);
         void HandleCharRenameCallBack(std::shared_ptr<CharacterRenameInfo> renameInfo, PreparedQueryResult result);
         void HandleSetPlayerDeclinedNames(WorldPacket& recvData);
         void HandleAlterAppearance(WorldPacket& recvData);
         void HandleCharCustomize(WorldPacket& recvData);
-        void HandleCharCustomizeCallback(std::shared_ptr<CharacterCustomizeInfo> customizeInfo, PreparedQueryResult result);
+        void HandleCharCustomizeCallback(std::shared_ptr<CharacterCustomizeInfo> customizeInfo, PreparedQueryResult result, bool nameOwnerChecked);
         void HandleOpeningCinematic(WorldPackets::Misc::OpeningCinematic& packet);
 
         void SendCharCreate(ResponseCodes result);
@@ -799,6 +803,8 @@ class TC_GAME_API WorldSession
         void HandleMoveWorldportAck();                // for server-side calls
 
         void HandleMovementOpcodes(WorldPacket& recvPacket);
+        // Whether a movement packet goes to every observer, or only to those within Movement.Relay.InnerRadius
+        static bool IsFullMovementRelay(uint16 opcode, uint32 lastFullRelay, uint32 now, uint32 outerInterval);
         void HandleSetActiveMoverOpcode(WorldPacket& recvData);
         void HandleMoveNotActiveMover(WorldPacket& recvData);
         void HandleDismissControlledVehicle(WorldPacket& recvData);
@@ -1195,11 +1201,15 @@ class TC_GAME_API WorldSession
 
     public:
         QueryCallbackProcessor& GetQueryProcessor() { return _queryProcessor; }
+        // Like CharacterCache::GetCharacterCacheByName, but asks the database when a bounded character cache does not know the name.
+        // callback may run later and must check that the session still has the same player, the entry is only valid during the call
+        void QueryCharacterCacheByName(std::string const& name, std::function<void(CharacterCacheEntry const*)>&& callback);
         TransactionCallback& AddTransactionCallback(TransactionCallback&& callback);
         SQLQueryHolderCallback& AddQueryHolderCallback(SQLQueryHolderCallback&& callback);
 
     private:
         void ProcessQueryCallbacks();
+        bool PrepareSendPacket(WorldPacket const& packet);
 
         QueryCallbackProcessor _queryProcessor;
         AsyncCallbackProcessor<TransactionCallback> _transactionCallbacks;
@@ -1322,6 +1332,11 @@ class TC_GAME_API WorldSession
         int64 _timeSyncClockDelta;
         void ComputeNewClockDelta();
 
+        // Heartbeats reach observers outside Movement.Relay.InnerRadius only every Movement.Relay.OuterInterval
+        void RelayMovement(Unit* mover, WorldPacket const* data);
+        uint32 _movementRelaysFull;
+        uint32 _movementRelaysNear;
+
         std::map<uint32, uint32> _pendingTimeSyncRequests; // key: counter. value: server time when packet with that counter was sent.
         uint32 _timeSyncNextCounter;
         uint32 _timeSyncTimer;
@@ -91,28 +91,29 @@ bool WorldSocket::Update()
         MessageBuffer buffer(_sendBufferSize);
         do
         {
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+            WorldPacket const& payload = queued->GetPayload();
+            ServerPktHeader header(payload.size() + 2, payload.GetOpcode());
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
+            if (buffer.GetRemainingSpace() < payload.size() + header.getHeaderLength())
             {
                 QueuePacket(std::move(buffer));
                 buffer.Resize(_sendBufferSize);
             }
 
-            if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
+            if (buffer.GetRemainingSpace() >= payload.size() + header.getHeaderLength())
             {
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!payload.empty())
+                    buffer.Write(payload.contents(), payload.size());
             }
             else    // single packet larger than buffer size
             {
-                MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
+                MessageBuffer packetBuffer(payload.size() + header.getHeaderLength());
                 packetBuffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    packetBuffer.Write(queued->contents(), queued->size());
+                if (!payload.empty())
+                    packetBuffer.Write(payload.contents(), payload.size());
 
                 QueuePacket(std::move(packetBuffer));
             }
@@ -429,6 +430,17 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
 }
 
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptablePacket(std::move(packet), _authCrypt.IsInitialized()));
+}
+
 void WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
 {
     std::shared_ptr<AuthSession> authSession = std::make_shared<AuthSession>();
@@ -37,11 +37,20 @@ public:
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    // only references the payload, it is copied straight into the send buffer
+    EncryptablePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : WorldPacket(packet->GetOpcode(), 0), _sharedPayload(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
     bool NeedsEncryption() const { return _encrypt; }
 
+    WorldPacket const& GetPayload() const { return _sharedPayload ? *_sharedPayload : *this; }
+
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    std::shared_ptr<WorldPacket const> _sharedPayload;
     bool _encrypt;
 };
 
@@ -79,6 +88,7 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
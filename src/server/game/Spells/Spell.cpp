@@ -495,6 +495,9 @@ public:
     explicit SpellEvent(Spell* spell);
     ~SpellEvent();
 
+    static void* operator new(std::size_t size) { return SpellPool::Allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { SpellPool::Deallocate(ptr, size); }
+
     bool Execute(uint64 e_time, uint32 p_time) override;
     void Abort(uint64 e_time) override;
     bool IsDeletable() const override;
@@ -1327,6 +1330,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffectInfo const& spellEffectInfo, Sp
             Trinity::Containers::RandomResize(targets, maxTargets);
         }
 
+        PrepareAreaTargetsLineOfSight(targets, spellEffectInfo, center);
+
         for (WorldObject* itr : targets)
         {
             if (Unit* unit = itr->ToUnit())
@@ -3679,7 +3684,7 @@ uint64 Spell::handle_delayed(uint64 t_offset)
 
     // now recheck units targeting correctness (need before any effects apply to prevent adding immunity at first effect not allow apply second spell effect and similar cases)
     {
-        std::vector<TargetInfo> delayedTargets;
+        TargetInfoContainer<TargetInfo, 5> delayedTargets;
         m_UniqueTargetInfo.erase(std::remove_if(m_UniqueTargetInfo.begin(), m_UniqueTargetInfo.end(), [&](TargetInfo& target) -> bool
         {
             if (single_missile || target.TimeDelay <= t_offset)
@@ -3699,7 +3704,7 @@ uint64 Spell::handle_delayed(uint64 t_offset)
 
     // now recheck gameobject targeting correctness
     {
-        std::vector<GOTargetInfo> delayedGOTargets;
+        TargetInfoContainer<GOTargetInfo, 2> delayedGOTargets;
         m_UniqueGOTargetInfo.erase(std::remove_if(m_UniqueGOTargetInfo.begin(), m_UniqueGOTargetInfo.end(), [&](GOTargetInfo& goTarget) -> bool
         {
             if (single_missile || goTarget.TimeDelay <= t_offset)
@@ -7388,6 +7393,46 @@ CurrentSpellTypes Spell::GetCurrentContainer() const
     return CURRENT_GENERIC_SPELL;
 }
 
+bool Spell::IsLineOfSightIgnored() const
+{
+    // check for ignore LOS on the effect itself
+    if (m_spellInfo->HasAttribute(SPELL_ATTR2_CAN_TARGET_NOT_IN_LOS) || DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_spellInfo->Id, nullptr, SPELL_DISABLE_LOS))
+        return true;
+
+    // check if gameobject ignores LOS
+    if (GameObject const* gobCaster = m_caster->ToGameObject())
+        if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+            return true;
+
+    // if spell is triggered, need to check for LOS disable on the aura triggering it and inherit that behaviour
+    if (IsTriggered() && m_triggeredByAuraSpell && (m_triggeredByAuraSpell->HasAttribute(SPELL_ATTR2_CAN_TARGET_NOT_IN_LOS) || DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_triggeredByAuraSpell->Id, nullptr, SPELL_DISABLE_LOS)))
+        return true;
+
+    return false;
+}
+
+// Area targets are checked one by one against center in CheckEffectTarget, test all of them in one batch
+// up front so those checks are answered from the map line of sight caches
+void Spell::PrepareAreaTargetsLineOfSight(std::list<WorldObject*> const& targets, SpellEffectInfo const& spellEffectInfo, Position const* center) const
+{
+    if (targets.size() < 2 || IsLineOfSightIgnored())
+        return;
+
+    // these effects test line of sight to the caster instead
+    if (spellEffectInfo.IsEffect(SPELL_EFFECT_RESURRECT_NEW) || spellEffectInfo.IsEffect(SPELL_EFFECT_SKIN_PLAYER_CORPSE))
+        return;
+
+    std::vector<VMAP::LineOfSightRay> rays;
+    rays.reserve(targets.size());
+    // the later checks use the phase mask of the target, the batch can only share one
+    for (WorldObject* target : targets)
+        if (target->IsUnit() && target->IsInWorld() && target->GetPhaseMask() == m_caster->GetPhaseMask())
+            rays.push_back(target->GetLineOfSightRay(center->GetPositionX(), center->GetPositionY(), center->GetPositionZ()));
+
+    if (rays.size() > 1)
+        m_caster->GetMap()->isInLineOfSight(rays, m_caster->GetPhaseMask(), LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::M2);
+}
+
 bool Spell::CheckEffectTarget(Unit const* target, SpellEffectInfo const& spellEffectInfo, Position const* losPosition) const
 {
     switch (spellEffectInfo.ApplyAuraName)
@@ -7410,17 +7455,7 @@ bool Spell::CheckEffectTarget(Unit const* target, SpellEffectInfo const& spellEf
             break;
     }
 
-    // check for ignore LOS on the effect itself
-    if (m_spellInfo->HasAttribute(SPELL_ATTR2_CAN_TARGET_NOT_IN_LOS) || DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_spellInfo->Id, nullptr, SPELL_DISABLE_LOS))
-        return true;
-
-    // check if gameobject ignores LOS
-    if (GameObject const* gobCaster = m_caster->ToGameObject())
-        if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
-            return true;
-
-    // if spell is triggered, need to check for LOS disable on the aura triggering it and inherit that behaviour
-    if (IsTriggered() && m_triggeredByAuraSpell && (m_triggeredByAuraSpell->HasAttribute(SPELL_ATTR2_CAN_TARGET_NOT_IN_LOS) || DisableMgr::IsDisabledFor(DISABLE_TYPE_SPELL, m_triggeredByAuraSpell->Id, nullptr, SPELL_DISABLE_LOS)))
+    if (IsLineOfSightIgnored())
         return true;
 
     /// @todo shit below shouldn't be here, but it's temporary
@@ -7547,7 +7582,7 @@ Unit* Spell::GetUnitCasterForEffectHandlers() const
     return m_originalCaster ? m_originalCaster : m_caster->ToUnit();
 }
 
-SpellEvent::SpellEvent(Spell* spell) : BasicEvent(), m_Spell(spell)
+SpellEvent::SpellEvent(Spell* spell) : BasicEvent(), m_Spell(spell, std::default_delete<Spell>(), SpellPool::Allocator<Spell>())
 {
 }
 
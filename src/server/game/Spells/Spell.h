@@ -20,11 +20,14 @@
 
 #include "ConditionMgr.h"
 #include "DBCEnums.h"
+#include "GridPositionIndex.h"
 #include "ObjectGuid.h"
 #include "Position.h"
 #include "SharedDefines.h"
 #include "SpellDefines.h"
+#include "SpellPool.h"
 #include "UniqueTrackablePtr.h"
+#include <boost/container/small_vector.hpp>
 #include <memory>
 
 namespace WorldPackets
@@ -119,6 +122,10 @@ enum SpellRangeFlag
 struct SpellValue
 {
     explicit  SpellValue(SpellInfo const* proto);
+
+    static void* operator new(std::size_t size) { return SpellPool::Allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { SpellPool::Deallocate(ptr, size); }
+
     int32     EffectBasePoints[MAX_SPELL_EFFECTS];
     uint32    MaxAffectedTargets;
     float     RadiusMod;
@@ -283,6 +290,10 @@ class TC_GAME_API Spell
         Spell(WorldObject* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID = ObjectGuid::Empty);
         ~Spell();
 
+        // every cast creates one, the memory comes from the SpellPool of the calling thread
+        static void* operator new(std::size_t size) { return SpellPool::Allocate(size); }
+        static void operator delete(void* ptr, std::size_t size) { SpellPool::Deallocate(ptr, size); }
+
         void InitExplicitTargets(SpellCastTargets const& targets);
         void SelectExplicitTargets();
 
@@ -361,6 +372,8 @@ class TC_GAME_API Spell
         void UpdateSpellCastDataAmmo(WorldPackets::Spells::SpellAmmo& data);
 
         bool CheckEffectTarget(Unit const* target, SpellEffectInfo const& spellEffectInfo, Position const* losPosition) const;
+        bool IsLineOfSightIgnored() const;
+        void PrepareAreaTargetsLineOfSight(std::list<WorldObject*> const& targets, SpellEffectInfo const& spellEffectInfo, Position const* center) const;
         bool CanAutoCast(Unit* target);
         void CheckSrc();
         void CheckDst();
@@ -593,7 +606,11 @@ class TC_GAME_API Spell
             Unit* _spellHitTarget = nullptr; // changed for example by reflect
             bool _enablePVP = false;         // need to enable PVP at DoDamageAndTriggers?
         };
-        std::vector<TargetInfo> m_UniqueTargetInfo;
+        // most casts hit a handful of targets, those are stored inside the spell
+        template <typename T, std::size_t InlineCount>
+        using TargetInfoContainer = boost::container::small_vector<T, InlineCount>;
+
+        TargetInfoContainer<TargetInfo, 5> m_UniqueTargetInfo;
         uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
 
         struct GOTargetInfo : public TargetInfoBase
@@ -603,7 +620,7 @@ class TC_GAME_API Spell
             ObjectGuid TargetGUID;
             uint64 TimeDelay = 0ULL;
         };
-        std::vector<GOTargetInfo> m_UniqueGOTargetInfo;
+        TargetInfoContainer<GOTargetInfo, 2> m_UniqueGOTargetInfo;
 
         struct ItemTargetInfo : public TargetInfoBase
         {
@@ -611,7 +628,7 @@ class TC_GAME_API Spell
 
             Item* TargetItem = nullptr;
         };
-        std::vector<ItemTargetInfo> m_UniqueItemInfo;
+        TargetInfoContainer<ItemTargetInfo, 1> m_UniqueItemInfo;
 
         struct CorpseTargetInfo : public TargetInfoBase
         {
@@ -620,7 +637,7 @@ class TC_GAME_API Spell
             ObjectGuid TargetGUID;
             uint64 TimeDelay = 0ULL;
         };
-        std::vector<CorpseTargetInfo> m_UniqueCorpseTargetInfo;
+        TargetInfoContainer<CorpseTargetInfo, 1> m_UniqueCorpseTargetInfo;
 
         template <class Container>
         void DoProcessTargetContainer(Container& targetContainer);
@@ -747,6 +764,7 @@ namespace Trinity
             WorldObject* referer, SpellInfo const* spellInfo, SpellTargetCheckTypes selectionType, ConditionContainer const* condList);
 
         bool operator()(WorldObject* target) const;
+        Optional<GridSearchArea> GetSearchArea() const { return GridSearchArea{ _position->GetPositionX(), _position->GetPositionY(), _range }; }
     };
 
     struct TC_GAME_API WorldObjectSpellConeTargetCheck : public WorldObjectSpellAreaTargetCheck
@@ -289,10 +289,8 @@ class TC_GAME_API SpellInfo
     friend class SpellMgr;
 
     public:
+        // fields read on every cast and target check come first so they share few cache lines
         uint32 Id;
-        SpellCategoryEntry const* CategoryEntry;
-        uint32 Dispel;
-        uint32 Mechanic;
         uint32 Attributes;
         uint32 AttributesEx;
         uint32 AttributesEx2;
@@ -302,11 +300,18 @@ class TC_GAME_API SpellInfo
         uint32 AttributesEx6;
         uint32 AttributesEx7;
         uint32 AttributesCu;
-        uint64 Stances;
-        uint64 StancesNot;
+        uint32 SchoolMask;
+        uint32 DmgClass;
+        uint32 PreventionType;
+        uint32 Dispel;
+        uint32 Mechanic;
+        uint32 SpellFamilyName;
+        flag96 SpellFamilyFlags;
         uint32 Targets;
+        uint32 ExplicitTargetMask;
         uint32 TargetCreatureType;
-        uint32 RequiresSpellFocus;
+        uint64 Stances;
+        uint64 StancesNot;
         uint32 FacingCasterFlags;
         uint32 CasterAuraState;
         uint32 TargetAuraState;
@@ -316,30 +321,38 @@ class TC_GAME_API SpellInfo
         uint32 TargetAuraSpell;
         uint32 ExcludeCasterAuraSpell;
         uint32 ExcludeTargetAuraSpell;
+        uint32 InterruptFlags;
+        uint32 AuraInterruptFlags;
+        uint32 ChannelInterruptFlags;
+        SpellCategoryEntry const* CategoryEntry;
         SpellCastTimesEntry const* CastTimeEntry;
+        SpellDurationEntry const* DurationEntry;
+        SpellRangeEntry const* RangeEntry;
+        SpellChainNode const* ChainEntry;
+        Powers PowerType;
+        uint32 ManaCost;
+        uint32 ManaCostPerlevel;
+        uint32 ManaCostPercentage;
+        uint32 RuneCostID;
+        float  Speed;
+        uint32 MaxAffectedTargets;
+        uint32 MaxTargetLevel;
+        std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> _effects;
+
+        // fields read when a cast starts or finishes, or only by a few systems
+        uint32 RequiresSpellFocus;
         uint32 RecoveryTime;
         uint32 CategoryRecoveryTime;
         uint32 StartRecoveryCategory;
         uint32 StartRecoveryTime;
-        uint32 InterruptFlags;
-        uint32 AuraInterruptFlags;
-        uint32 ChannelInterruptFlags;
         uint32 ProcFlags;
         uint32 ProcChance;
         uint32 ProcCharges;
         uint32 MaxLevel;
         uint32 BaseLevel;
         uint32 SpellLevel;
-        SpellDurationEntry const* DurationEntry;
-        Powers PowerType;
-        uint32 ManaCost;
-        uint32 ManaCostPerlevel;
         uint32 ManaPerSecond;
         uint32 ManaPerSecondPerLevel;
-        uint32 ManaCostPercentage;
-        uint32 RuneCostID;
-        SpellRangeEntry const* RangeEntry;
-        float  Speed;
         uint32 StackAmount;
         std::array<uint32, 2> Totem;
         std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
@@ -354,17 +367,7 @@ class TC_GAME_API SpellInfo
         uint32 Priority;
         std::array<char const*, 16> SpellName;
         std::array<char const*, 16> Rank;
-        uint32 MaxTargetLevel;
-        uint32 MaxAffectedTargets;
-        uint32 SpellFamilyName;
-        flag96 SpellFamilyFlags;
-        uint32 DmgClass;
-        uint32 PreventionType;
         int32  AreaGroupId;
-        uint32 SchoolMask;
-        std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> _effects;
-        uint32 ExplicitTargetMask;
-        SpellChainNode const* ChainEntry;
 
         SpellInfo(SpellEntry const* spellEntry);
         ~SpellInfo();
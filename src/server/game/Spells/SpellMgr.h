@@ -731,6 +731,9 @@ class TC_GAME_API SpellMgr
         PetLevelupSpellMap         mPetLevelupSpellMap;
         PetDefaultSpellsMap        mPetDefaultSpellsMap;           // only spells not listed in related mPetLevelupSpellMap entry
         SpellInfoMap               mSpellInfoMap;
+        // every SpellInfo lives in this one block in spell id order, mSpellInfoMap indexes into it
+        SpellInfo*                 mSpellInfoStorage;
+        std::size_t                mSpellInfoStorageSize;
 
     friend class UnitTestDataLoader;
 };
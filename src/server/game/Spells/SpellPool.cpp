@@ -0,0 +1,199 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SpellPool.h"
+#include <array>
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace
+{
+    constexpr uint32 PublishInterval = 4096;
+
+    std::atomic<uint64> TotalHits(0);
+    std::atomic<uint64> TotalMisses(0);
+    std::atomic<uint64> TotalDrops(0);
+
+    // freed blocks are linked through their first bytes
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    struct FreeList
+    {
+        std::size_t Size = 0;
+        FreeBlock* Head = nullptr;
+        std::size_t Count = 0;
+    };
+
+    class ThreadPool
+    {
+    public:
+        ThreadPool() : _hits(0), _misses(0), _drops(0), _operations(0) { }
+
+        ~ThreadPool()
+        {
+            for (FreeList& list : _lists)
+            {
+                while (FreeBlock* block = list.Head)
+                {
+                    list.Head = block->Next;
+                    ::operator delete(block);
+                }
+            }
+
+            Publish();
+            State = Destroyed;
+        }
+
+        void* Allocate(std::size_t size)
+        {
+            if (FreeList* list = GetList(size))
+            {
+                if (FreeBlock* block = list->Head)
+                {
+                    list->Head = block->Next;
+                    --list->Count;
+                    ++_hits;
+                    Count();
+                    return block;
+                }
+            }
+
+            ++_misses;
+            Count();
+            return ::operator new(size);
+        }
+
+        void Deallocate(void* ptr, std::size_t size)
+        {
+            FreeList* list = GetList(size);
+            if (list && list->Count < SpellPool::MaxPooledPerSize)
+            {
+                list->Head = new (ptr) FreeBlock{ list->Head };
+                ++list->Count;
+            }
+            else
+            {
+                ::operator delete(ptr);
+                ++_drops;
+            }
+
+            Count();
+        }
+
+        enum StateType : uint8
+        {
+            Uninitialized,
+            Alive,
+            Destroyed
+        };
+
+        // trivially destructible, stays readable while thread local objects are destroyed
+        static thread_local StateType State;
+
+    private:
+        // the list for the size, claims a free slot for sizes not seen yet
+        FreeList* GetList(std::size_t size)
+        {
+            if (size < sizeof(FreeBlock))
+                return nullptr;
+
+            for (FreeList& list : _lists)
+            {
+                if (list.Size == size)
+                    return &list;
+
+                if (!list.Size)
+                {
+                    list.Size = size;
+                    return &list;
+                }
+            }
+
+            return nullptr;
+        }
+
+        void Count()
+        {
+            if (++_operations >= PublishInterval)
+                Publish();
+        }
+
+        void Publish()
+        {
+            TotalHits.fetch_add(std::exchange(_hits, 0), std::memory_order_relaxed);
+            TotalMisses.fetch_add(std::exchange(_misses, 0), std::memory_order_relaxed);
+            TotalDrops.fetch_add(std::exchange(_drops, 0), std::memory_order_relaxed);
+            _operations = 0;
+        }
+
+        std::array<FreeList, SpellPool::MaxPooledSizes> _lists;
+        uint64 _hits;
+        uint64 _misses;
+        uint64 _drops;
+        uint32 _operations;
+    };
+
+    thread_local ThreadPool::StateType ThreadPool::State = ThreadPool::Uninitialized;
+
+    // nullptr once the thread's pool is gone, spells destroyed during thread or process exit bypass it
+    ThreadPool* GetThreadPool()
+    {
+        if (ThreadPool::State == ThreadPool::Destroyed)
+            return nullptr;
+
+        thread_local ThreadPool pool;
+        ThreadPool::State = ThreadPool::Alive;
+        return &pool;
+    }
+}
+
+void* SpellPool::Allocate(std::size_t size)
+{
+    if (ThreadPool* pool = GetThreadPool())
+        return pool->Allocate(size);
+
+    TotalMisses.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(size);
+}
+
+void SpellPool::Deallocate(void* ptr, std::size_t size)
+{
+    if (!ptr)
+        return;
+
+    if (ThreadPool* pool = GetThreadPool())
+    {
+        pool->Deallocate(ptr, size);
+        return;
+    }
+
+    TotalDrops.fetch_add(1, std::memory_order_relaxed);
+    ::operator delete(ptr);
+}
+
+SpellPool::Stats SpellPool::GetStats()
+{
+    Stats stats;
+    stats.Hits = TotalHits.load(std::memory_order_relaxed);
+    stats.Misses = TotalMisses.load(std::memory_order_relaxed);
+    stats.Drops = TotalDrops.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,70 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_SPELL_POOL_H
+#define TRINITYCORE_SPELL_POOL_H
+
+#include "Define.h"
+#include <cstddef>
+
+/*
+ * Thread local recycling of the memory every cast allocates: the Spell itself, its SpellValue, its SpellEvent
+ * and the control block of the pointer tracking it. Freed blocks are kept per object size, up to MaxPooledPerSize
+ * blocks for each of the first MaxPooledSizes sizes a thread sees. Maps are updated on the map update threads,
+ * so every thread's pool serves the maps it updates. Memory freed on another thread than the one that allocated
+ * it simply joins that thread's pool.
+ */
+namespace SpellPool
+{
+    constexpr std::size_t MaxPooledSizes = 8;
+    constexpr std::size_t MaxPooledPerSize = 512;
+
+    struct Stats
+    {
+        uint64 Hits = 0;        // allocations served from a pool
+        uint64 Misses = 0;      // allocations that had to use the global allocator
+        uint64 Drops = 0;       // freed blocks handed to the global allocator because their pool was full or gone
+    };
+
+    TC_GAME_API void* Allocate(std::size_t size);
+
+    // size must be the one the block was allocated with
+    TC_GAME_API void Deallocate(void* ptr, std::size_t size);
+
+    // Totals of all threads, threads publish their counters every few thousand operations and on exit
+    TC_GAME_API Stats GetStats();
+
+    // Standard allocator over the pool, for storage allocated on behalf of a spell by library types
+    template <typename T>
+    struct Allocator
+    {
+        using value_type = T;
+
+        Allocator() noexcept = default;
+
+        template <typename T2>
+        Allocator(Allocator<T2> const&) noexcept { }
+
+        T* allocate(std::size_t count) { return static_cast<T*>(Allocate(count * sizeof(T))); }
+        void deallocate(T* ptr, std::size_t count) noexcept { Deallocate(ptr, count * sizeof(T)); }
+
+        template <typename T2>
+        bool operator==(Allocator<T2> const&) const noexcept { return true; }
+    };
+}
+
+#endif // TRINITYCORE_SPELL_POOL_H
@@ -27,8 +27,14 @@
 #include "Util.h"
 #include "Warden.h"
 #include "AccountMgr.h"
+#include "BoundedThreadPool.h"
 #include <charconv>
 
+namespace
+{
+std::unique_ptr<Trinity::BoundedThreadPool> VerificationPool;
+}
+
 Warden::Warden() : _session(nullptr), _checkTimer(10 * IN_MILLISECONDS), _clientResponseTimer(0),
                    _dataSent(false), _initialized(false)
 {
@@ -39,6 +45,37 @@ Warden::~Warden()
     _initialized = false;
 }
 
+void Warden::StartVerificationPool(std::size_t threads, std::size_t maxQueuedTasks)
+{
+    if (!threads)
+        return;
+
+    VerificationPool = std::make_unique<Trinity::BoundedThreadPool>(threads, std::max<std::size_t>(maxQueuedTasks, 1));
+}
+
+void Warden::StopVerificationPool()
+{
+    if (!VerificationPool)
+        return;
+
+    VerificationPool->Join();
+    VerificationPool.reset();
+}
+
+std::size_t Warden::GetPendingVerifications()
+{
+    return VerificationPool ? VerificationPool->GetPendingTasks() : 0;
+}
+
+bool WardenVerifyCallback::InvokeIfReady()
+{
+    if (_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    _warden->ApplyVerdict(_future.get());
+    return true;
+}
+
 void Warden::MakeModuleForClient()
 {
     TC_LOG_DEBUG("warden", "Make module for client");
@@ -102,6 +139,8 @@ void Warden::Update(uint32 diff)
     if (!_initialized)
         return;
 
+    _verifyProcessor.ProcessReadyCallbacks();
+
     if (_dataSent)
     {
         uint32 maxClientResponseDelay = sWorld->getIntConfig(CONFIG_WARDEN_CLIENT_RESPONSE_DELAY);
@@ -119,7 +158,7 @@ void Warden::Update(uint32 diff)
                 _clientResponseTimer += diff;
         }
     }
-    else
+    else if (!_verifyProcessor.HasPendingCallbacks()) // the hold off starts once the last response is verified
     {
         if (diff >= _checkTimer)
             RequestChecks();
@@ -206,6 +245,43 @@ char const* Warden::ApplyPenalty(WardenCheck const* check)
     return EnumUtils::ToTitle(action);
 }
 
+void Warden::QueueVerification(std::function<WardenCheckVerdict()> work)
+{
+    if (VerificationPool)
+    {
+        if (Optional<std::future<WardenCheckVerdict>> future = VerificationPool->TryPostWork(std::move(work)))
+        {
+            _verifyProcessor.AddCallback(WardenVerifyCallback(std::move(*future), this));
+            return;
+        }
+    }
+
+    // no pool or too many responses waiting, verify in place
+    ApplyVerdict(work());
+}
+
+void Warden::ApplyVerdict(WardenCheckVerdict const& verdict)
+{
+    // an invalid response does not start the hold off, checks are requested again right away
+    if (verdict.Failure)
+    {
+        char const* penalty = ApplyPenalty(nullptr);
+        TC_LOG_WARN("warden", "{} {}. Action: {}", _session->GetPlayerInfo(), verdict.Failure, penalty);
+        return;
+    }
+
+    if (verdict.FailedCheck > 0)
+    {
+        WardenCheck const& check = sWardenCheckMgr->GetCheckData(verdict.FailedCheck);
+        char const* penalty = ApplyPenalty(&check);
+        TC_LOG_WARN("warden", "{} failed Warden check {} ({}). Action: {}", _session->GetPlayerInfo(), verdict.FailedCheck, EnumUtils::ToConstant(check.Type), penalty);
+    }
+
+    // Set hold off timer, minimum timer should at least be 1 second
+    uint32 holdOff = sWorld->getIntConfig(CONFIG_WARDEN_CLIENT_CHECK_HOLDOFF);
+    _checkTimer = (holdOff < 1 ? 1 : holdOff) * IN_MILLISECONDS;
+}
+
 void Warden::HandleData(ByteBuffer& buff)
 {
     DecryptData(buff.contents(), buff.size());
@@ -19,11 +19,14 @@
 #define _WARDEN_BASE_H
 
 #include "ARC4.h"
+#include "AsyncCallbackProcessor.h"
 #include "AuthDefines.h"
 #include "ByteBuffer.h"
 #include "Optional.h"
 #include "WardenCheckMgr.h"
 #include <array>
+#include <functional>
+#include <future>
 
 enum WardenOpcodes
 {
@@ -81,13 +84,44 @@ struct ClientWardenModule
 };
 
 class WorldSession;
+class Warden;
+
+// Outcome of verifying a check response, computed without touching the session
+struct WardenCheckVerdict
+{
+    char const* Failure = nullptr;                  // the response itself is invalid, default action applies
+    uint16 FailedCheck = 0;                         // last check that did not match
+};
+
+// Check response verified on the warden pool, applied from Warden::Update on the session thread
+class WardenVerifyCallback
+{
+public:
+    WardenVerifyCallback(std::future<WardenCheckVerdict>&& future, Warden* warden) : _future(std::move(future)), _warden(warden) { }
+
+    WardenVerifyCallback(WardenVerifyCallback&&) = default;
+    WardenVerifyCallback& operator=(WardenVerifyCallback&&) = default;
+
+    bool InvokeIfReady();
+
+private:
+    std::future<WardenCheckVerdict> _future;
+    Warden* _warden;
+};
 
 class TC_GAME_API Warden
 {
+    friend class WardenVerifyCallback;
+
     public:
         Warden();
         virtual ~Warden();
 
+        /// Starts the pool verifying check responses of all sessions; responses are verified in place while more than maxQueuedTasks are waiting
+        static void StartVerificationPool(std::size_t threads, std::size_t maxQueuedTasks);
+        static void StopVerificationPool();
+        static std::size_t GetPendingVerifications();
+
         virtual void Init(WorldSession* session, SessionKey const& K) = 0;
         void Update(uint32 diff);
         void HandleData(ByteBuffer& buff);
@@ -116,6 +150,10 @@ class TC_GAME_API Warden
         // If nullptr is passed, the default action from config is executed
         char const* ApplyPenalty(WardenCheck const* check);
 
+        // work must only use its own captures and the immutable check store, it may run on another thread
+        void QueueVerification(std::function<WardenCheckVerdict()> work);
+        void ApplyVerdict(WardenCheckVerdict const& verdict);
+
         WorldSession* _session;
         std::array<uint8, 16> _inputKey = {};
         std::array<uint8, 16> _outputKey = {};
@@ -127,6 +165,7 @@ class TC_GAME_API Warden
         bool _dataSent;
         Optional<ClientWardenModule> _module;
         bool _initialized;
+        AsyncCallbackProcessor<WardenVerifyCallback> _verifyProcessor;
 };
 
 #endif
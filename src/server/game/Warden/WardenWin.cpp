@@ -210,77 +210,78 @@ static uint16 GetCheckPacketSize(WardenCheck const& check)
     return size;
 }
 
-void WardenWin::RequestChecks()
+WardenCheckRequest::WardenCheckRequest(WardenCheck const& check, uint8 resultLength) : Check(&check), PacketSize(GetCheckPacketSize(check))
 {
-    TC_LOG_DEBUG("warden", "Request data from {} (account {}) - loaded: {}", _session->GetPlayerName(), _session->GetAccountId(), _session->GetPlayer() && !_session->PlayerLoading());
+    ByteBuffer strings(0);
+    ByteBuffer body(0);
 
-    // If all checks for a category are done, fill its todo list again
-    for (WardenCheckCategory category : EnumUtils::Iterate<WardenCheckCategory>())
+    if (check.Type == LUA_EVAL_CHECK)
     {
-        auto& [checks, checksIt] = _checks[category];
-        if ((checksIt == checks.end()) && !checks.empty())
-        {
-            TC_LOG_DEBUG("warden", "Finished all {} checks, re-shuffling", EnumUtils::ToConstant(category));
-            Trinity::Containers::RandomShuffle(checks);
-            checksIt = checks.begin();
-        }
+        strings << uint8(sizeof(_luaEvalPrefix) - 1 + check.Str.size() + sizeof(_luaEvalMidfix) - 1 + check.IdStr.size() + sizeof(_luaEvalPostfix) - 1);
+        strings.append(_luaEvalPrefix, sizeof(_luaEvalPrefix) - 1);
+        strings.append(check.Str.data(), check.Str.size());
+        strings.append(_luaEvalMidfix, sizeof(_luaEvalMidfix) - 1);
+        strings.append(check.IdStr.data(), check.IdStr.size());
+        strings.append(_luaEvalPostfix, sizeof(_luaEvalPostfix) - 1);
     }
-
-    _serverTicks = GameTime::GetGameTimeMS();
-    _currentChecks.clear();
-
-    // Build check request
-    ByteBuffer buff;
-    buff << uint8(WARDEN_SMSG_CHEAT_CHECKS_REQUEST);
-
-    for (WardenCheckCategory category : EnumUtils::Iterate<WardenCheckCategory>())
+    else if (!check.Str.empty())
     {
-        if (IsWardenCategoryInWorldOnly(category) && !_session->GetPlayer())
-            continue;
-
-        auto& [checks, checksIt] = _checks[category];
-        for (uint32 i = 0, n = sWorld->getIntConfig(GetWardenCategoryCountConfig(category)); i < n; ++i)
-        {
-            if (checksIt == checks.end()) // all checks were already sent, list will be re-filled on next Update() run
-                break;
-            _currentChecks.push_back(*(checksIt++));
-        }
+        strings << uint8(check.Str.size());
+        strings.append(check.Str.data(), check.Str.size());
     }
 
-    Trinity::Containers::RandomShuffle(_currentChecks);
+    switch (check.Type)
+    {
+        case MEM_CHECK:
+            body << uint8(0x00);
+            body << uint32(check.Address);
+            body << uint8(resultLength);
+            break;
+        case PAGE_CHECK_A:
+        case PAGE_CHECK_B:
+            body.append(check.Data.data(), check.Data.size());
+            body << uint32(check.Address);
+            body << uint8(check.Length);
+            break;
+        case DRIVER_CHECK:
+            body.append(check.Data.data(), check.Data.size());
+            break;
+        default:
+            break;
+    }
 
-    uint16 expectedSize = 4;
-    Trinity::Containers::EraseIf(_currentChecks,
-        [&expectedSize](uint16 id)
-        {
-            uint8 const thisSize = GetCheckPacketSize(sWardenCheckMgr->GetCheckData(id));
-            if ((expectedSize + thisSize) > 450) // warden packets are truncated to 512 bytes clientside
-                return true;
-            expectedSize += thisSize;
-            return false;
-        }
-    );
+    if (!strings.empty())
+        Strings.assign(strings.contents(), strings.contents() + strings.size());
+    if (!body.empty())
+        Body.assign(body.contents(), body.contents() + body.size());
+}
 
-    for (uint16 const id : _currentChecks)
+// checks are loaded once at startup, so are their requests
+static std::vector<WardenCheckRequest> const& GetCheckRequests()
+{
+    static std::vector<WardenCheckRequest> const requests = []()
     {
-        WardenCheck const& check = sWardenCheckMgr->GetCheckData(id);
-        if (check.Type == LUA_EVAL_CHECK)
-        {
-            buff << uint8(sizeof(_luaEvalPrefix) - 1 + check.Str.size() + sizeof(_luaEvalMidfix) - 1 + check.IdStr.size() + sizeof(_luaEvalPostfix) - 1);
-            buff.append(_luaEvalPrefix, sizeof(_luaEvalPrefix) - 1);
-            buff.append(check.Str.data(), check.Str.size());
-            buff.append(_luaEvalMidfix, sizeof(_luaEvalMidfix) - 1);
-            buff.append(check.IdStr.data(), check.IdStr.size());
-            buff.append(_luaEvalPostfix, sizeof(_luaEvalPostfix) - 1);
-        }
-        else if (!check.Str.empty())
+        std::vector<WardenCheckRequest> requests(sWardenCheckMgr->GetMaxValidCheckId());
+        for (uint16 id = 0; id < requests.size(); ++id)
         {
-            buff << uint8(check.Str.size());
-            buff.append(check.Str.data(), check.Str.size());
+            WardenCheck const& check = sWardenCheckMgr->GetCheckData(id);
+            if (check.Type == NONE_CHECK)
+                continue;
+
+            requests[id] = WardenCheckRequest(check, check.Type == MEM_CHECK ? uint8(sWardenCheckMgr->GetCheckResult(id).size()) : 0);
         }
-    }
 
-    uint8 xorByte = _inputKey[0];
+        return requests;
+    }();
+
+    return requests;
+}
+
+void WardenWin::AppendCheckRequests(ByteBuffer& buff, std::vector<WardenCheckRequest const*> const& requests, uint8 xorByte)
+{
+    for (WardenCheckRequest const* request : requests)
+        if (!request->Strings.empty())
+            buff.append(request->Strings.data(), request->Strings.size());
 
     // Add TIMING_CHECK
     buff << uint8(0x00);
@@ -288,38 +289,20 @@ void WardenWin::RequestChecks()
 
     uint8 index = 1;
 
-    for (uint16 const id : _currentChecks)
+    for (WardenCheckRequest const* request : requests)
     {
-        WardenCheck const& check = sWardenCheckMgr->GetCheckData(id);
+        WardenCheck const& check = *request->Check;
 
         WardenCheckType const type = check.Type;
         buff << uint8(type ^ xorByte);
+        if (!request->Body.empty())
+            buff.append(request->Body.data(), request->Body.size());
         switch (type)
         {
-            case MEM_CHECK:
-            {
-                buff << uint8(0x00);
-                buff << uint32(check.Address);
-                buff << uint8(sWardenCheckMgr->GetCheckResult(id).size());
-                break;
-            }
-            case PAGE_CHECK_A:
-            case PAGE_CHECK_B:
-            {
-                buff.append(check.Data.data(), check.Data.size());
-                buff << uint32(check.Address);
-                buff << uint8(check.Length);
-                break;
-            }
             case MPQ_CHECK:
             case LUA_EVAL_CHECK:
-            {
-                buff << uint8(index++);
-                break;
-            }
             case DRIVER_CHECK:
             {
-                buff.append(check.Data.data(), check.Data.size());
                 buff << uint8(index++);
                 break;
             }
@@ -344,6 +327,67 @@ void WardenWin::RequestChecks()
         }
     }
     buff << uint8(xorByte);
+}
+
+void WardenWin::RequestChecks()
+{
+    TC_LOG_DEBUG("warden", "Request data from {} (account {}) - loaded: {}", _session->GetPlayerName(), _session->GetAccountId(), _session->GetPlayer() && !_session->PlayerLoading());
+
+    // If all checks for a category are done, fill its todo list again
+    for (WardenCheckCategory category : EnumUtils::Iterate<WardenCheckCategory>())
+    {
+        auto& [checks, checksIt] = _checks[category];
+        if ((checksIt == checks.end()) && !checks.empty())
+        {
+            TC_LOG_DEBUG("warden", "Finished all {} checks, re-shuffling", EnumUtils::ToConstant(category));
+            Trinity::Containers::RandomShuffle(checks);
+            checksIt = checks.begin();
+        }
+    }
+
+    _serverTicks = GameTime::GetGameTimeMS();
+    _currentChecks.clear();
+
+    // Build check request
+    ByteBuffer buff;
+    buff << uint8(WARDEN_SMSG_CHEAT_CHECKS_REQUEST);
+
+    for (WardenCheckCategory category : EnumUtils::Iterate<WardenCheckCategory>())
+    {
+        if (IsWardenCategoryInWorldOnly(category) && !_session->GetPlayer())
+            continue;
+
+        auto& [checks, checksIt] = _checks[category];
+        for (uint32 i = 0, n = sWorld->getIntConfig(GetWardenCategoryCountConfig(category)); i < n; ++i)
+        {
+            if (checksIt == checks.end()) // all checks were already sent, list will be re-filled on next Update() run
+                break;
+            _currentChecks.push_back(*(checksIt++));
+        }
+    }
+
+    Trinity::Containers::RandomShuffle(_currentChecks);
+
+    std::vector<WardenCheckRequest> const& requests = GetCheckRequests();
+
+    uint16 expectedSize = 4;
+    Trinity::Containers::EraseIf(_currentChecks,
+        [&expectedSize, &requests](uint16 id)
+        {
+            uint16 const thisSize = requests[id].PacketSize;
+            if ((expectedSize + thisSize) > 450) // warden packets are truncated to 512 bytes clientside
+                return true;
+            expectedSize += thisSize;
+            return false;
+        }
+    );
+
+    std::vector<WardenCheckRequest const*> currentRequests;
+    currentRequests.reserve(_currentChecks.size());
+    for (uint16 const id : _currentChecks)
+        currentRequests.push_back(&requests[id]);
+
+    AppendCheckRequests(buff, currentRequests, _inputKey[0]);
     buff.hexlike();
 
     auto idstring = [this]() -> std::string
@@ -382,152 +426,164 @@ void WardenWin::HandleCheckResult(ByteBuffer &buff)
     _dataSent = false;
     _clientResponseTimer = 0;
 
-    uint16 Length;
-    buff >> Length;
-    uint32 Checksum;
-    buff >> Checksum;
+    // hashing and comparing the response only needs the request it answers, not the session
+    std::vector<uint8> response;
+    if (buff.rpos() < buff.size())
+        response.assign(buff.contents() + buff.rpos(), buff.contents() + buff.size());
+    buff.rfinish();
 
-    if (Length != (buff.size() - buff.rpos()))
+    QueueVerification([response = std::move(response), checks = std::exchange(_currentChecks, {}), serverTicks = _serverTicks,
+        receivedTicks = GameTime::GetGameTimeMS(), accountId = _session->GetAccountId()]()
     {
-        buff.rfinish();
-        char const* penalty = ApplyPenalty(nullptr);
-        TC_LOG_WARN("warden", "{} sends manipulated warden packet. Action: {}", _session->GetPlayerInfo(), penalty);
-        return;
-    }
+        return VerifyCheckResult(response, checks, serverTicks, receivedTicks, accountId);
+    });
+}
 
-    if (!IsValidCheckSum(Checksum, buff.contents() + buff.rpos(), Length))
-    {
-        buff.rfinish();
-        char const* penalty = ApplyPenalty(nullptr);
-        TC_LOG_WARN("warden", "{} failed checksum. Action: {}", _session->GetPlayerInfo(), penalty);
-        return;
-    }
+WardenCheckVerdict WardenWin::VerifyCheckResult(std::vector<uint8> const& response, std::vector<uint16> const& checks, uint32 serverTicks, uint32 receivedTicks, uint32 accountId)
+{
+    WardenCheckVerdict verdict;
+    ByteBuffer buff(response.size());
+    if (!response.empty())
+        buff.append(response.data(), response.size());
 
-    // TIMING_CHECK
+    try
     {
-        uint8 result;
-        buff >> result;
-        /// @todo test it.
-        if (result == 0x00)
+        uint16 Length;
+        buff >> Length;
+        uint32 Checksum;
+        buff >> Checksum;
+
+        if (Length != (buff.size() - buff.rpos()))
         {
-            char const* penalty = ApplyPenalty(nullptr);
-            TC_LOG_WARN("warden", "{} failed timing check. Action: {}", _session->GetPlayerInfo(), penalty);
-            return;
+            verdict.Failure = "sends manipulated warden packet";
+            return verdict;
         }
 
-        uint32 newClientTicks;
-        buff >> newClientTicks;
-
-        uint32 ticksNow = GameTime::GetGameTimeMS();
-        uint32 ourTicks = newClientTicks + (ticksNow - _serverTicks);
-
-        TC_LOG_DEBUG("warden", "Server tick count now:    {}", ticksNow);
-        TC_LOG_DEBUG("warden", "Server tick count at req: {}", _serverTicks);
-        TC_LOG_DEBUG("warden", "Client ticks in response: {}", newClientTicks);
-        TC_LOG_DEBUG("warden", "Round trip response time: {} ms", ourTicks - newClientTicks);
-    }
-
-    uint16 checkFailed = 0;
-    for (uint16 const id : _currentChecks)
-    {
-        WardenCheck const& check = sWardenCheckMgr->GetCheckData(id);
+        if (!IsValidCheckSum(Checksum, buff.contents() + buff.rpos(), Length))
+        {
+            verdict.Failure = "failed checksum";
+            return verdict;
+        }
 
-        switch (check.Type)
+        // TIMING_CHECK
         {
-            case MEM_CHECK:
+            uint8 result;
+            buff >> result;
+            /// @todo test it.
+            if (result == 0x00)
             {
-                uint8 Mem_Result;
-                buff >> Mem_Result;
+                verdict.Failure = "failed timing check";
+                return verdict;
+            }
 
-                if (Mem_Result != 0)
-                {
-                    TC_LOG_DEBUG("warden", "RESULT MEM_CHECK not 0x00, CheckId {} account Id {}", id, _session->GetAccountId());
-                    checkFailed = id;
-                    continue;
-                }
+            uint32 newClientTicks;
+            buff >> newClientTicks;
 
-                WardenCheckResult const& expected = sWardenCheckMgr->GetCheckResult(id);
+            uint32 ourTicks = newClientTicks + (receivedTicks - serverTicks);
 
-                std::vector<uint8> response;
-                response.resize(expected.size());
-                buff.read(response.data(), response.size());
+            TC_LOG_DEBUG("warden", "Server tick count now:    {}", receivedTicks);
+            TC_LOG_DEBUG("warden", "Server tick count at req: {}", serverTicks);
+            TC_LOG_DEBUG("warden", "Client ticks in response: {}", newClientTicks);
+            TC_LOG_DEBUG("warden", "Round trip response time: {} ms", ourTicks - newClientTicks);
+        }
 
-                if (response != expected)
-                {
-                    TC_LOG_DEBUG("warden", "RESULT MEM_CHECK fail CheckId {} account Id {}", id, _session->GetAccountId());
-                    TC_LOG_DEBUG("warden", "Expected: {}", ByteArrayToHexStr(expected));
-                    TC_LOG_DEBUG("warden", "Got:      {}", ByteArrayToHexStr(response));
-                    checkFailed = id;
-                    continue;
-                }
+        for (uint16 const id : checks)
+        {
+            WardenCheck const& check = sWardenCheckMgr->GetCheckData(id);
 
-                TC_LOG_DEBUG("warden", "RESULT MEM_CHECK passed CheckId {} account Id {}", id, _session->GetAccountId());
-                break;
-            }
-            case PAGE_CHECK_A:
-            case PAGE_CHECK_B:
-            case DRIVER_CHECK:
-            case MODULE_CHECK:
+            switch (check.Type)
             {
-                if (buff.read<uint8>() != 0xE9)
+                case MEM_CHECK:
                 {
-                    TC_LOG_DEBUG("warden", "RESULT {} fail, CheckId {} account Id {}", EnumUtils::ToConstant(check.Type), id, _session->GetAccountId());
-                    checkFailed = id;
-                    continue;
+                    uint8 Mem_Result;
+                    buff >> Mem_Result;
+
+                    if (Mem_Result != 0)
+                    {
+                        TC_LOG_DEBUG("warden", "RESULT MEM_CHECK not 0x00, CheckId {} account Id {}", id, accountId);
+                        verdict.FailedCheck = id;
+                        continue;
+                    }
+
+                    WardenCheckResult const& expected = sWardenCheckMgr->GetCheckResult(id);
+
+                    std::vector<uint8> result;
+                    result.resize(expected.size());
+                    buff.read(result.data(), result.size());
+
+                    if (result != expected)
+                    {
+                        TC_LOG_DEBUG("warden", "RESULT MEM_CHECK fail CheckId {} account Id {}", id, accountId);
+                        TC_LOG_DEBUG("warden", "Expected: {}", ByteArrayToHexStr(expected));
+                        TC_LOG_DEBUG("warden", "Got:      {}", ByteArrayToHexStr(result));
+                        verdict.FailedCheck = id;
+                        continue;
+                    }
+
+                    TC_LOG_DEBUG("warden", "RESULT MEM_CHECK passed CheckId {} account Id {}", id, accountId);
+                    break;
                 }
-
-                TC_LOG_DEBUG("warden", "RESULT {} passed CheckId {} account Id {}", EnumUtils::ToConstant(check.Type), id, _session->GetAccountId());
-                break;
-            }
-            case LUA_EVAL_CHECK:
-            {
-                uint8 const result = buff.read<uint8>();
-                if (result == 0)
-                    buff.read_skip(buff.read<uint8>()); // discard attached string
-
-                TC_LOG_DEBUG("warden", "LUA_EVAL_CHECK CheckId {} account Id {} got in-warden dummy response ({})", id, _session->GetAccountId(), result);
-                break;
-            }
-            case MPQ_CHECK:
-            {
-                uint8 Mpq_Result;
-                buff >> Mpq_Result;
-
-                if (Mpq_Result != 0)
+                case PAGE_CHECK_A:
+                case PAGE_CHECK_B:
+                case DRIVER_CHECK:
+                case MODULE_CHECK:
                 {
-                    TC_LOG_DEBUG("warden", "RESULT MPQ_CHECK not 0x00 account id {}", _session->GetAccountId());
-                    checkFailed = id;
-                    continue;
+                    if (buff.read<uint8>() != 0xE9)
+                    {
+                        TC_LOG_DEBUG("warden", "RESULT {} fail, CheckId {} account Id {}", EnumUtils::ToConstant(check.Type), id, accountId);
+                        verdict.FailedCheck = id;
+                        continue;
+                    }
+
+                    TC_LOG_DEBUG("warden", "RESULT {} passed CheckId {} account Id {}", EnumUtils::ToConstant(check.Type), id, accountId);
+                    break;
                 }
+                case LUA_EVAL_CHECK:
+                {
+                    uint8 const result = buff.read<uint8>();
+                    if (result == 0)
+                        buff.read_skip(buff.read<uint8>()); // discard attached string
 
-                std::vector<uint8> result;
-                result.resize(Trinity::Crypto::SHA1::DIGEST_LENGTH);
-                buff.read(result.data(), result.size());
-                if (result != sWardenCheckMgr->GetCheckResult(id)) // SHA1
+                    TC_LOG_DEBUG("warden", "LUA_EVAL_CHECK CheckId {} account Id {} got in-warden dummy response ({})", id, accountId, result);
+                    break;
+                }
+                case MPQ_CHECK:
                 {
-                    TC_LOG_DEBUG("warden", "RESULT MPQ_CHECK fail, CheckId {} account Id {}", id, _session->GetAccountId());
-                    checkFailed = id;
-                    continue;
+                    uint8 Mpq_Result;
+                    buff >> Mpq_Result;
+
+                    if (Mpq_Result != 0)
+                    {
+                        TC_LOG_DEBUG("warden", "RESULT MPQ_CHECK not 0x00 account id {}", accountId);
+                        verdict.FailedCheck = id;
+                        continue;
+                    }
+
+                    std::vector<uint8> result;
+                    result.resize(Trinity::Crypto::SHA1::DIGEST_LENGTH);
+                    buff.read(result.data(), result.size());
+                    if (result != sWardenCheckMgr->GetCheckResult(id)) // SHA1
+                    {
+                        TC_LOG_DEBUG("warden", "RESULT MPQ_CHECK fail, CheckId {} account Id {}", id, accountId);
+                        verdict.FailedCheck = id;
+                        continue;
+                    }
+
+                    TC_LOG_DEBUG("warden", "RESULT MPQ_CHECK passed, CheckId {} account Id {}", id, accountId);
+                    break;
                 }
-
-                TC_LOG_DEBUG("warden", "RESULT MPQ_CHECK passed, CheckId {} account Id {}", id, _session->GetAccountId());
-                break;
+                default:                                        // Should never happen
+                    break;
             }
-            default:                                        // Should never happen
-                break;
         }
     }
-
-    if (checkFailed > 0)
+    catch (ByteBufferException const&)
     {
-        WardenCheck const& check = sWardenCheckMgr->GetCheckData(checkFailed);
-        char const* penalty = ApplyPenalty(&check);
-        TC_LOG_WARN("warden", "{} failed Warden check {} ({}). Action: {}", _session->GetPlayerInfo(), checkFailed, EnumUtils::ToConstant(check.Type), penalty);
+        // the checksum matched but the content does not fit the checks that were sent
+        verdict.Failure = "sends manipulated warden packet";
     }
 
-    // Set hold off timer, minimum timer should at least be 1 second
-    uint32 holdOff = sWorld->getIntConfig(CONFIG_WARDEN_CLIENT_CHECK_HOLDOFF);
-    _checkTimer = (holdOff < 1 ? 1 : holdOff) * IN_MILLISECONDS;
+    return verdict;
 }
 
 size_t WardenWin::DEBUG_ForceSpecificChecks(std::vector<uint16> const& checks)
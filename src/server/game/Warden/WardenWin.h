@@ -25,6 +25,7 @@
 #include <array>
 #include <list>
 #include <utility>
+#include <vector>
 
 #pragma pack(push, 1)
 
@@ -64,6 +65,18 @@ static_assert(sizeof(WardenInitModuleRequest) == (1 + 2 + 4 + 1 + 1 + 1 + 1 + (4
 class WorldSession;
 class Warden;
 
+// Request bytes of a check that are the same for every session
+struct TC_GAME_API WardenCheckRequest
+{
+    WardenCheckRequest() = default;
+    WardenCheckRequest(WardenCheck const& check, uint8 resultLength);
+
+    WardenCheck const* Check = nullptr;
+    std::vector<uint8> Strings;                     // string table entry
+    std::vector<uint8> Body;                        // bytes following the check type, without string index and module seed
+    uint16 PacketSize = 0;
+};
+
 class TC_GAME_API WardenWin : public Warden
 {
     public:
@@ -79,7 +92,13 @@ class TC_GAME_API WardenWin : public Warden
 
         size_t DEBUG_ForceSpecificChecks(std::vector<uint16> const& checks) override;
 
+        // Appends everything following the command byte of a check request
+        static void AppendCheckRequests(ByteBuffer& buff, std::vector<WardenCheckRequest const*> const& requests, uint8 xorByte);
+
     private:
+        // Runs on the warden verification pool
+        static WardenCheckVerdict VerifyCheckResult(std::vector<uint8> const& response, std::vector<uint16> const& checks, uint32 serverTicks, uint32 receivedTicks, uint32 accountId);
+
         uint32 _serverTicks;
         std::array<std::pair<std::vector<uint16>, std::vector<uint16>::const_iterator>, NUM_CHECK_CATEGORIES> _checks;
         std::vector<uint16> _currentChecks;
@@ -1130,6 +1130,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_CHATFLOOD_MUTE_TIME]     = sConfigMgr->GetIntDefault("ChatFlood.MuteTime", 10);
 
     m_bool_configs[CONFIG_EVENT_ANNOUNCE] = sConfigMgr->GetBoolDefault("Event.Announce", false);
+    m_int_configs[CONFIG_EVENT_MAX_SPAWN_CHANGES_PER_MAP_UPDATE] = sConfigMgr->GetIntDefault("Event.MaxSpawnChangesPerMapUpdate", 200);
 
     m_float_configs[CONFIG_CREATURE_FAMILY_FLEE_ASSISTANCE_RADIUS] = sConfigMgr->GetFloatDefault("CreatureFamilyFleeAssistanceRadius", 30.0f);
     m_float_configs[CONFIG_CREATURE_FAMILY_ASSISTANCE_RADIUS] = sConfigMgr->GetFloatDefault("CreatureFamilyAssistanceRadius", 10.0f);
@@ -1321,6 +1322,15 @@ void World::LoadConfigSettings(bool reload)
     m_visibility_notify_periodInBG         = sConfigMgr->GetIntDefault("Visibility.Notify.Period.InBG",         DEFAULT_VISIBILITY_NOTIFY_PERIOD);
     m_visibility_notify_periodInArenas     = sConfigMgr->GetIntDefault("Visibility.Notify.Period.InArenas",     DEFAULT_VISIBILITY_NOTIFY_PERIOD);
 
+    m_bool_configs[CONFIG_MOVEMENT_RELAY_ENABLED] = sConfigMgr->GetBoolDefault("Movement.Relay.Enabled", false);
+    m_float_configs[CONFIG_MOVEMENT_RELAY_INNER_RADIUS] = sConfigMgr->GetFloatDefault("Movement.Relay.InnerRadius", 40.0f);
+    if (m_float_configs[CONFIG_MOVEMENT_RELAY_INNER_RADIUS] < 0.0f)
+    {
+        TC_LOG_ERROR("server.loading", "Movement.Relay.InnerRadius ({}) can't be negative. Set to 40.", m_float_configs[CONFIG_MOVEMENT_RELAY_INNER_RADIUS]);
+        m_float_configs[CONFIG_MOVEMENT_RELAY_INNER_RADIUS] = 40.0f;
+    }
+    m_int_configs[CONFIG_MOVEMENT_RELAY_OUTER_INTERVAL] = sConfigMgr->GetIntDefault("Movement.Relay.OuterInterval", 1500);
+
     ///- Load the CharDelete related config options
     m_int_configs[CONFIG_CHARDELETE_METHOD] = sConfigMgr->GetIntDefault("CharDelete.Method", 0);
     m_int_configs[CONFIG_CHARDELETE_MIN_LEVEL] = sConfigMgr->GetIntDefault("CharDelete.MinLevel", 0);
@@ -1348,6 +1358,7 @@ void World::LoadConfigSettings(bool reload)
 
     // Respawn Settings
     m_int_configs[CONFIG_RESPAWN_MINCHECKINTERVALMS] = sConfigMgr->GetIntDefault("Respawn.MinCheckIntervalMS", 5000);
+    m_int_configs[CONFIG_RESPAWN_MAXPERCHECK] = sConfigMgr->GetIntDefault("Respawn.MaxPerCheck", 1000);
     m_int_configs[CONFIG_RESPAWN_DYNAMICMODE] = sConfigMgr->GetIntDefault("Respawn.DynamicMode", 0);
     if (m_int_configs[CONFIG_RESPAWN_DYNAMICMODE] > 1)
     {
@@ -1415,6 +1426,8 @@ void World::LoadConfigSettings(bool reload)
         TC_LOG_INFO("server.loading", "Using DataDir {}", m_dataPath);
     }
 
+    m_bool_configs[CONFIG_DBC_MEMORY_MAPPED] = sConfigMgr->GetBoolDefault("DBC.MemoryMapped", false);
+
     m_bool_configs[CONFIG_ENABLE_MMAPS] = sConfigMgr->GetBoolDefault("mmap.enablePathFinding", true);
     TC_LOG_INFO("server.loading", "WORLD: MMap data directory is: {}mmaps", m_dataPath);
 
@@ -1430,6 +1443,7 @@ void World::LoadConfigSettings(bool reload)
     VMAP::VMapFactory::createOrGetVMapManager()->setEnableHeightCalc(enableHeight);
     TC_LOG_INFO("server.loading", "VMap support included. LineOfSight: {}, getHeight: {}, indoorCheck: {}", enableLOS, enableHeight, enableIndoor);
     TC_LOG_INFO("server.loading", "VMap data directory is: {}vmaps", m_dataPath);
+    m_int_configs[CONFIG_LINE_OF_SIGHT_CACHE_SIZE] = sConfigMgr->GetIntDefault("vmap.LineOfSightCacheSize", 1024);
 
     m_int_configs[CONFIG_MAX_WHO] = sConfigMgr->GetIntDefault("MaxWhoListReturns", 49);
     m_bool_configs[CONFIG_START_ALL_SPELLS] = sConfigMgr->GetBoolDefault("PlayerStart.AllSpells", false);
@@ -1555,6 +1569,9 @@ void World::LoadConfigSettings(bool reload)
     // Allow to cache data queries
     m_bool_configs[CONFIG_CACHE_DATA_QUERIES] = sConfigMgr->GetBoolDefault("CacheDataQueries", true);
 
+    // Limit the amount of characters kept in the character cache
+    m_int_configs[CONFIG_CHARACTER_CACHE_MAX_ENTRIES] = sConfigMgr->GetIntDefault("CharacterCache.MaxEntries", 0);
+
     // Whether to use LoS from game objects
     m_bool_configs[CONFIG_CHECK_GOBJECT_LOS] = sConfigMgr->GetBoolDefault("CheckGameObjectLoS", true);
 
@@ -1657,7 +1674,7 @@ void World::SetInitialWorldSettings()
 
     ///- Load the DBC files
     TC_LOG_INFO("server.loading", "Initialize data stores...");
-    LoadDBCStores(m_dataPath);
+    LoadDBCStores(m_dataPath, getBoolConfig(CONFIG_DBC_MEMORY_MAPPED));
     DetectDBCLang();
 
     // Load cinematic cameras
@@ -2576,6 +2593,11 @@ void World::Update(uint32 diff)
         ProcessQueryCallbacks();
     }
 
+    {
+        TC_METRIC_TIMER("world_update_time", TC_METRIC_TAG("type", "Update character cache"));
+        sCharacterCache->Update();
+    }
+
     ///- Erase corpses once every 20 minutes
     if (m_timers[WUPDATE_CORPSES].Passed())
     {
@@ -181,6 +181,8 @@ enum WorldBoolConfigs : uint32
     CONFIG_RESPAWN_DYNAMIC_ESCORTNPC,
     CONFIG_REGEN_HP_CANNOT_REACH_TARGET_IN_RAID,
     CONFIG_ALLOW_LOGGING_IP_ADDRESSES_IN_DATABASE,
+    CONFIG_MOVEMENT_RELAY_ENABLED,
+    CONFIG_DBC_MEMORY_MAPPED,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -206,6 +208,7 @@ enum WorldFloatConfigs : uint32
     CONFIG_ARENA_MATCHMAKER_RATING_MODIFIER,
     CONFIG_RESPAWN_DYNAMICRATE_CREATURE,
     CONFIG_RESPAWN_DYNAMICRATE_GAMEOBJECT,
+    CONFIG_MOVEMENT_RELAY_INNER_RADIUS,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -394,6 +397,10 @@ enum WorldIntConfigs : uint32
     CONFIG_AUCTION_SEARCH_DELAY,
     CONFIG_TALENTS_INSPECTING,
     CONFIG_RESPAWN_MINCHECKINTERVALMS,
+    CONFIG_RESPAWN_MAXPERCHECK,
+    CONFIG_EVENT_MAX_SPAWN_CHANGES_PER_MAP_UPDATE,
+    CONFIG_MOVEMENT_RELAY_OUTER_INTERVAL,
+    CONFIG_LINE_OF_SIGHT_CACHE_SIZE,
     CONFIG_RESPAWN_DYNAMICMODE,
     CONFIG_RESPAWN_GUIDWARNLEVEL,
     CONFIG_RESPAWN_GUIDALERTLEVEL,
@@ -403,6 +410,7 @@ enum WorldIntConfigs : uint32
     CONFIG_RESPAWN_GUIDWARNING_FREQUENCY,
     CONFIG_SOCKET_TIMEOUTTIME_ACTIVE,
     CONFIG_PENDING_MOVE_CHANGES_TIMEOUT,
+    CONFIG_CHARACTER_CACHE_MAX_ENTRIES,
     INT_CONFIG_VALUE_COUNT
 };
 
@@ -218,7 +218,16 @@ public:
             return;
         }
 
-        if (sCharacterCache->GetCharacterGuidByName(delInfo.name))
+        bool nameInUse = !sCharacterCache->GetCharacterGuidByName(delInfo.name).IsEmpty();
+        if (!nameInUse && !sCharacterCache->IsComplete())
+        {
+            // a bounded character cache does not know every name
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHECK_NAME);
+            stmt->setString(0, delInfo.name);
+            nameInUse = bool(CharacterDatabase.Query(stmt));
+        }
+
+        if (nameInUse)
         {
             handler->PSendSysMessage(LANG_CHARACTER_DELETED_SKIP_NAME, delInfo.name.c_str(), delInfo.guid.GetCounter(), delInfo.accountId);
             return;
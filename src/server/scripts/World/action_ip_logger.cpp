@@ -319,6 +319,6 @@ public:
 void AddSC_action_ip_logger()
 {
     new AccountActionIpLogger();
-    new CharacterActionIpLogger();
-    new CharacterDeleteActionIpLogger();
+    RegisterPlayerScript(CharacterActionIpLogger);
+    RegisterPlayerScript(CharacterDeleteActionIpLogger);
 }
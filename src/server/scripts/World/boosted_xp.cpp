@@ -47,5 +47,5 @@ public:
 
 void AddSC_xp_boost()
 {
-    new xp_boost_PlayerScript();
+    RegisterPlayerScript(xp_boost_PlayerScript);
 }
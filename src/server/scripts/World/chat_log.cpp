@@ -143,7 +143,7 @@ class ChatLogScript : public PlayerScript
 
 void AddSC_chat_log()
 {
-    new ChatLogScript();
+    RegisterPlayerScript(ChatLogScript);
 }
 
 #undef TC_LOG_CHAT
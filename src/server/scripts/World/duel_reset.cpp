@@ -123,5 +123,5 @@ class DuelResetScript : public PlayerScript
 
 void AddSC_duel_reset()
 {
-    new DuelResetScript();
+    RegisterPlayerScript(DuelResetScript);
 }
@@ -17,6 +17,7 @@
 
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
+#include "MappedFile.h"
 
 DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
 {
@@ -29,17 +30,27 @@ DBCStorageBase::~DBCStorageBase()
         delete[] strings;
 }
 
-bool DBCStorageBase::Load(char const* path, char**& indexTable)
+bool DBCStorageBase::Load(char const* path, bool memoryMapped, std::size_t alignment, char**& indexTable)
 {
     indexTable = nullptr;
 
     DBCFileLoader dbc;
     // Check if load was sucessful, only then continue
-    if (!dbc.Load(path, _fileFormat))
+    if (!(memoryMapped ? dbc.LoadMapped(path, _fileFormat) : dbc.Load(path, _fileFormat)))
         return false;
 
     _fieldCount = dbc.GetCols();
 
+    // records need no conversion, keep the mapping and point at them
+    if (memoryMapped)
+    {
+        if ((indexTable = dbc.ProduceInPlaceIndex(_fileFormat, alignment, _indexTableSize)))
+        {
+            _mapping = dbc.ReleaseMapping();
+            return true;
+        }
+    }
+
     // load raw non-string data
     _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
 
@@ -57,6 +68,10 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
     if (!indexTable)
         return false;
 
+    // records used in place have no strings
+    if (_mapping)
+        return true;
+
     DBCFileLoader dbc;
     // Check if load was successful, only then continue
     if (!dbc.Load(path, _fileFormat))
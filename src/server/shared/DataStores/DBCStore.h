@@ -21,9 +21,15 @@
 #include "Common.h"
 #include "DBCStorageIterator.h"
 #include "Errors.h"
+#include <memory>
 #include <vector>
 #include <cstring>
 
+namespace Trinity
+{
+    class MappedFile;
+}
+
  /// Interface class for common access
 class TC_SHARED_API DBCStorageBase
 {
@@ -33,13 +39,16 @@ class TC_SHARED_API DBCStorageBase
 
         char const* GetFormat() const { return _fileFormat; }
         uint32 GetFieldCount() const { return _fieldCount; }
+        // Records are used right inside the memory mapped file
+        bool IsInPlace() const { return _mapping != nullptr; }
 
-        virtual bool Load(char const* path) = 0;
+        // memoryMapped maps the file instead of reading it, records are used in place when the structure layout allows it
+        virtual bool Load(char const* path, bool memoryMapped) = 0;
         virtual bool LoadStringsFrom(char const* path) = 0;
         virtual void LoadFromDB(char const* table, char const* format, char const* index) = 0;
 
     protected:
-        bool Load(char const* path, char**& indexTable);
+        bool Load(char const* path, bool memoryMapped, std::size_t alignment, char**& indexTable);
         bool LoadStringsFrom(char const* path, char** indexTable);
         void LoadFromDB(char const* table, char const* format, char const* index, char**& indexTable);
 
@@ -48,6 +57,7 @@ class TC_SHARED_API DBCStorageBase
         char* _dataTable;
         std::vector<char*> _stringPool;
         uint32 _indexTableSize;
+        std::unique_ptr<Trinity::MappedFile> _mapping;
 };
 
 template <class T>
@@ -92,9 +102,9 @@ class DBCStorage : public DBCStorageBase
 
         uint32 GetNumRows() const { return _indexTableSize; }
 
-        bool Load(char const* path) override
+        bool Load(char const* path, bool memoryMapped) override
         {
-            return DBCStorageBase::Load(path, _indexTable.AsChar);
+            return DBCStorageBase::Load(path, memoryMapped, alignof(T), _indexTable.AsChar);
         }
 
         bool LoadStringsFrom(char const* path) override
@@ -22,6 +22,7 @@
 #include "Log.h"
 #include "Util.h"
 #include <utf8.h>
+#include <algorithm>
 #include <sstream>
 #include <cmath>
 
@@ -99,13 +100,13 @@ void ByteBuffer::append(uint8 const* src, size_t cnt)
     if (_storage.capacity() < newSize) // custom memory allocation rules
     {
         if (newSize < 100)
-            _storage.reserve(300);
+            Grow(300);
         else if (newSize < 750)
-            _storage.reserve(2500);
+            Grow(2500);
         else if (newSize < 6000)
-            _storage.reserve(10000);
+            Grow(10000);
         else
-            _storage.reserve(400000);
+            Grow(std::max({ newSize, size_t(400000), _storage.capacity() * 2 }));
     }
 
     if (_storage.size() < newSize)
@@ -114,6 +115,13 @@ void ByteBuffer::append(uint8 const* src, size_t cnt)
     _wpos = newSize;
 }
 
+void ByteBuffer::Grow(size_t capacity)
+{
+    std::vector<uint8> storage = ByteBufferPool::Acquire(capacity);
+    storage.assign(_storage.begin(), _storage.end());
+    ByteBufferPool::Release(std::exchange(_storage, std::move(storage)));
+}
+
 void ByteBuffer::put(size_t pos, uint8 const* src, size_t cnt)
 {
     ASSERT(pos + cnt <= size(), "Attempted to put value with size: " SZFMTD " in ByteBuffer (pos: " SZFMTD " size: " SZFMTD ")", cnt, pos, size());
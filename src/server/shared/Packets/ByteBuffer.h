@@ -20,8 +20,10 @@
 
 #include "Define.h"
 #include "ByteConverter.h"
+#include "ByteBufferPool.h"
 #include <array>
 #include <string>
+#include <utility>
 #include <vector>
 #include <cstring>
 
@@ -71,15 +73,13 @@ class TC_SHARED_API ByteBuffer
     public:
         constexpr static size_t DEFAULT_SIZE = 0x1000;
 
-        // constructor
-        ByteBuffer() : _rpos(0), _wpos(0)
+        // constructor, storage comes from the ByteBufferPool of the calling thread and goes back to it when destroyed
+        ByteBuffer() : _rpos(0), _wpos(0), _storage(ByteBufferPool::Acquire(DEFAULT_SIZE))
         {
-            _storage.reserve(DEFAULT_SIZE);
         }
 
-        ByteBuffer(size_t reserve) : _rpos(0), _wpos(0)
+        ByteBuffer(size_t reserve) : _rpos(0), _wpos(0), _storage(ByteBufferPool::Acquire(reserve))
         {
-            _storage.reserve(reserve);
         }
 
         ByteBuffer(ByteBuffer&& buf) noexcept : _rpos(buf._rpos), _wpos(buf._wpos), _storage(std::move(buf._storage))
@@ -88,7 +88,10 @@ class TC_SHARED_API ByteBuffer
             buf._wpos = 0;
         }
 
-        ByteBuffer(ByteBuffer const& right) = default;
+        ByteBuffer(ByteBuffer const& right) : _rpos(right._rpos), _wpos(right._wpos), _storage(ByteBufferPool::Acquire(right._storage.size()))
+        {
+            _storage.assign(right._storage.begin(), right._storage.end());
+        }
 
         ByteBuffer(MessageBuffer&& buffer);
 
@@ -98,7 +101,10 @@ class TC_SHARED_API ByteBuffer
             {
                 _rpos = right._rpos;
                 _wpos = right._wpos;
-                _storage = right._storage;
+                if (_storage.capacity() < right._storage.size())
+                    ByteBufferPool::Release(std::exchange(_storage, ByteBufferPool::Acquire(right._storage.size())));
+
+                _storage.assign(right._storage.begin(), right._storage.end());
             }
 
             return *this;
@@ -112,13 +118,16 @@ class TC_SHARED_API ByteBuffer
                 right._rpos = 0;
                 _wpos = right._wpos;
                 right._wpos = 0;
-                _storage = std::move(right._storage);
+                ByteBufferPool::Release(std::exchange(_storage, std::move(right._storage)));
             }
 
             return *this;
         }
 
-        virtual ~ByteBuffer() = default;
+        virtual ~ByteBuffer()
+        {
+            ByteBufferPool::Release(std::move(_storage));
+        }
 
         void clear()
         {
@@ -418,8 +427,8 @@ class TC_SHARED_API ByteBuffer
 
         void reserve(size_t ressize)
         {
-            if (ressize > size())
-                _storage.reserve(ressize);
+            if (ressize > _storage.capacity())
+                Grow(ressize);
         }
 
         void shrink_to_fit()
@@ -489,6 +498,9 @@ class TC_SHARED_API ByteBuffer
         void hexlike() const;
 
     protected:
+        // moves the contents into pooled storage of at least capacity bytes
+        void Grow(size_t capacity);
+
         size_t _rpos, _wpos;
         std::vector<uint8> _storage;
 };
@@ -0,0 +1,245 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ByteBufferPool.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <mutex>
+#include <utility>
+
+namespace
+{
+    constexpr uint32 MinClassShift = std::countr_zero(ByteBufferPool::MinPooledSize);
+    constexpr uint32 ClassCount = std::countr_zero(ByteBufferPool::MaxPooledSize) - MinClassShift + 1;
+    constexpr uint32 PublishInterval = 4096;
+
+    std::atomic<uint64> TotalHits(0);
+    std::atomic<uint64> TotalMisses(0);
+    std::atomic<uint64> TotalDrops(0);
+
+    constexpr std::size_t GetClassSize(uint32 sizeClass) { return std::size_t(1) << (sizeClass + MinClassShift); }
+
+    constexpr std::size_t GetClassLimit(uint32 sizeClass)
+    {
+        return std::max(ByteBufferPool::MinPooledPerClass, ByteBufferPool::MaxPooledBytesPerClass / GetClassSize(sizeClass));
+    }
+
+    constexpr std::size_t GetSharedLimit(uint32 sizeClass)
+    {
+        return std::max(ByteBufferPool::MinPooledPerClass, ByteBufferPool::MaxSharedBytesPerClass / GetClassSize(sizeClass));
+    }
+
+    // Buffers move between threads and this tier in batches of half a thread class, which keeps the lock cold
+    class SharedPool
+    {
+    public:
+        // Moves up to count buffers of the class into buffers, returns how many were moved
+        std::size_t Take(uint32 sizeClass, std::vector<std::vector<uint8>>& buffers, std::size_t count)
+        {
+            SharedClass& shared = _classes[sizeClass];
+            std::lock_guard<std::mutex> lock(shared.Lock);
+            count = std::min(count, shared.Buffers.size());
+            std::move(shared.Buffers.end() - count, shared.Buffers.end(), std::back_inserter(buffers));
+            shared.Buffers.resize(shared.Buffers.size() - count);
+            return count;
+        }
+
+        // Moves the last buffers out of buffers until count were moved or the tier is full, returns how many were moved
+        std::size_t Give(uint32 sizeClass, std::vector<std::vector<uint8>>& buffers, std::size_t count)
+        {
+            SharedClass& shared = _classes[sizeClass];
+            std::lock_guard<std::mutex> lock(shared.Lock);
+            count = std::min({ count, buffers.size(), GetSharedLimit(sizeClass) - shared.Buffers.size() });
+            std::move(buffers.end() - count, buffers.end(), std::back_inserter(shared.Buffers));
+            buffers.resize(buffers.size() - count);
+            return count;
+        }
+
+    private:
+        struct SharedClass
+        {
+            std::mutex Lock;
+            std::vector<std::vector<uint8>> Buffers;
+        };
+
+        std::array<SharedClass, ClassCount> _classes;
+    };
+
+    SharedPool& GetSharedPool()
+    {
+        static SharedPool pool;
+        return pool;
+    }
+
+    class ThreadPool
+    {
+    public:
+        ThreadPool() : _hits(0), _misses(0), _drops(0), _operations(0) { }
+
+        ~ThreadPool()
+        {
+            // hand the storage of exiting threads to the others
+            for (uint32 sizeClass = 0; sizeClass < ClassCount; ++sizeClass)
+                GetSharedPool().Give(sizeClass, _buffers[sizeClass], _buffers[sizeClass].size());
+
+            Publish();
+            State = Destroyed;
+        }
+
+        std::vector<uint8> Acquire(uint32 sizeClass)
+        {
+            std::vector<std::vector<uint8>>& buffers = _buffers[sizeClass];
+            std::vector<uint8> storage;
+            if (buffers.empty())
+                GetSharedPool().Take(sizeClass, buffers, GetBatchSize(sizeClass));
+
+            if (!buffers.empty())
+            {
+                storage = std::move(buffers.back());
+                buffers.pop_back();
+                ++_hits;
+            }
+            else
+            {
+                storage.reserve(GetClassSize(sizeClass));
+                ++_misses;
+            }
+
+            Count();
+            return storage;
+        }
+
+        void Release(uint32 sizeClass, std::vector<uint8>&& storage)
+        {
+            std::vector<std::vector<uint8>>& buffers = _buffers[sizeClass];
+            if (buffers.size() >= GetClassLimit(sizeClass))
+                GetSharedPool().Give(sizeClass, buffers, GetBatchSize(sizeClass));
+
+            if (buffers.size() < GetClassLimit(sizeClass))
+            {
+                storage.clear();
+                buffers.push_back(std::move(storage));
+            }
+            else
+                ++_drops;
+
+            Count();
+        }
+
+        void Drop()
+        {
+            ++_drops;
+            Count();
+        }
+
+        enum StateType : uint8
+        {
+            Uninitialized,
+            Alive,
+            Destroyed
+        };
+
+        // trivially destructible, stays readable while thread local objects are destroyed
+        static thread_local StateType State;
+
+    private:
+        static constexpr std::size_t GetBatchSize(uint32 sizeClass) { return std::max<std::size_t>(1, GetClassLimit(sizeClass) / 2); }
+
+        void Count()
+        {
+            if (++_operations >= PublishInterval)
+                Publish();
+        }
+
+        void Publish()
+        {
+            TotalHits.fetch_add(std::exchange(_hits, 0), std::memory_order_relaxed);
+            TotalMisses.fetch_add(std::exchange(_misses, 0), std::memory_order_relaxed);
+            TotalDrops.fetch_add(std::exchange(_drops, 0), std::memory_order_relaxed);
+            _operations = 0;
+        }
+
+        std::array<std::vector<std::vector<uint8>>, ClassCount> _buffers;
+        uint64 _hits;
+        uint64 _misses;
+        uint64 _drops;
+        uint32 _operations;
+    };
+
+    thread_local ThreadPool::StateType ThreadPool::State = ThreadPool::Uninitialized;
+
+    // nullptr once the thread's pool is gone, buffers destroyed during thread or process exit bypass it
+    ThreadPool* GetThreadPool()
+    {
+        if (ThreadPool::State == ThreadPool::Destroyed)
+            return nullptr;
+
+        thread_local ThreadPool pool;
+        ThreadPool::State = ThreadPool::Alive;
+        return &pool;
+    }
+}
+
+std::vector<uint8> ByteBufferPool::Acquire(std::size_t reserve)
+{
+    std::vector<uint8> storage;
+    if (!reserve)
+        return storage;
+
+    if (reserve <= MaxPooledSize)
+    {
+        uint32 sizeClass = std::bit_width(std::max(reserve, MinPooledSize) - 1) - MinClassShift;
+        if (ThreadPool* pool = GetThreadPool())
+            return pool->Acquire(sizeClass);
+
+        reserve = GetClassSize(sizeClass);
+    }
+
+    storage.reserve(reserve);
+    return storage;
+}
+
+void ByteBufferPool::Release(std::vector<uint8>&& storage)
+{
+    std::size_t capacity = storage.capacity();
+    if (capacity < MinPooledSize)
+        return;
+
+    ThreadPool* pool = GetThreadPool();
+    if (!pool)
+        return;
+
+    // storage from elsewhere may have any capacity, file it under the largest class it can serve
+    if (capacity > MaxPooledSize)
+        pool->Drop();
+    else
+        pool->Release(std::bit_width(capacity) - 1 - MinClassShift, std::move(storage));
+
+    std::vector<uint8>().swap(storage);
+}
+
+ByteBufferPool::Stats ByteBufferPool::GetStats()
+{
+    Stats stats;
+    stats.Hits = TotalHits.load(std::memory_order_relaxed);
+    stats.Misses = TotalMisses.load(std::memory_order_relaxed);
+    stats.Drops = TotalDrops.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_BYTE_BUFFER_POOL_H
+#define TRINITYCORE_BYTE_BUFFER_POOL_H
+
+#include "Define.h"
+#include <vector>
+
+/*
+ * Thread local recycling of ByteBuffer storage.
+ * Buffers are kept in power of two size classes from MinPooledSize to MaxPooledSize, every class
+ * holds up to MaxPooledBytesPerClass worth of buffers (at least MinPooledPerClass) per thread.
+ * A thread whose class is full hands half of it to a shared tier, and a thread whose class runs
+ * dry refills from there, so storage acquired on map threads and released on network threads
+ * keeps circulating instead of being dropped on one side and allocated on the other.
+ * The shared tier holds up to MaxSharedBytesPerClass worth of buffers per class.
+ */
+namespace ByteBufferPool
+{
+    constexpr std::size_t MinPooledSize = 256;
+    constexpr std::size_t MaxPooledSize = 512 * 1024;
+    constexpr std::size_t MaxPooledBytesPerClass = 256 * 1024;
+    constexpr std::size_t MinPooledPerClass = 2;
+    constexpr std::size_t MaxSharedBytesPerClass = 1024 * 1024;
+
+    struct Stats
+    {
+        uint64 Hits = 0;        // acquisitions served from a pool
+        uint64 Misses = 0;      // acquisitions that had to allocate
+        uint64 Drops = 0;       // released buffers freed because their class and the shared tier were full or unpooled
+    };
+
+    // Empty storage with a capacity of at least reserve, sizes up to MaxPooledSize are rounded up to their class
+    TC_SHARED_API std::vector<uint8> Acquire(std::size_t reserve);
+
+    // Hands storage back, its contents are discarded
+    TC_SHARED_API void Release(std::vector<uint8>&& storage);
+
+    // Totals of all threads, threads publish their counters every few thousand operations and on exit
+    TC_SHARED_API Stats GetStats();
+}
+
+#endif // TRINITYCORE_BYTE_BUFFER_POOL_H
@@ -25,7 +25,7 @@
 #include "Util.h"
 #include <boost/asio/ip/tcp.hpp>
 
-RealmList::RealmList() : _updateInterval(0)
+RealmList::RealmList() : _updateInterval(0), _updateCounter(0)
 {
 }
 
@@ -165,6 +165,8 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     for (auto itr = existingRealms.begin(); itr != existingRealms.end(); ++itr)
         TC_LOG_INFO("server.authserver", "Removed realm \"{}\".", itr->second);
 
+    _updateCounter.fetch_add(1, std::memory_order_release);
+
     if (_updateInterval)
     {
         _updateTimer->expires_after(std::chrono::seconds(_updateInterval));
@@ -20,6 +20,7 @@
 
 #include "Define.h"
 #include "Realm.h"
+#include <atomic>
 #include <map>
 
 namespace boost
@@ -46,6 +47,9 @@ public:
     RealmMap const& GetRealms() const { return _realms; }
     Realm const* GetRealm(RealmHandle const& id) const;
 
+    /// Incremented every time the realm list is reloaded, data derived from it can use this to detect staleness
+    uint32 GetUpdateCounter() const { return _updateCounter.load(std::memory_order_acquire); }
+
 private:
     RealmList();
 
@@ -58,6 +62,7 @@ private:
     uint32 _updateInterval;
     std::unique_ptr<Trinity::Asio::DeadlineTimer> _updateTimer;
     std::unique_ptr<Trinity::Asio::Resolver> _resolver;
+    std::atomic<uint32> _updateCounter;
 };
 
 #define sRealmList RealmList::Instance()
@@ -25,6 +25,7 @@
 #include "Banner.h"
 #include "BattlegroundMgr.h"
 #include "BigNumber.h"
+#include "ByteBufferPool.h"
 #include "CliRunnable.h"
 #include "Configuration/Config.h"
 #include "DatabaseEnv.h"
@@ -49,8 +50,10 @@
 #include "ScriptReloadMgr.h"
 #include "SecretMgr.h"
 #include "SharedDefines.h"
+#include "SpellPool.h"
 #include "TCSoap.h"
 #include "ThreadPool.h"
+#include "Warden.h"
 #include "World.h"
 #include "WorldSocket.h"
 #include "WorldSocketMgr.h"
@@ -305,6 +308,17 @@ extern int main(int argc, char** argv)
         TC_METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         TC_METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+
+        ByteBufferPool::Stats bufferPoolStats = ByteBufferPool::GetStats();
+        TC_METRIC_VALUE("bytebuffer_pool_hits", bufferPoolStats.Hits);
+        TC_METRIC_VALUE("bytebuffer_pool_misses", bufferPoolStats.Misses);
+        TC_METRIC_VALUE("bytebuffer_pool_drops", bufferPoolStats.Drops);
+
+        SpellPool::Stats spellPoolStats = SpellPool::GetStats();
+        TC_METRIC_VALUE("spell_pool_hits", spellPoolStats.Hits);
+        TC_METRIC_VALUE("spell_pool_misses", spellPoolStats.Misses);
+        TC_METRIC_VALUE("spell_pool_drops", spellPoolStats.Drops);
+        TC_METRIC_VALUE("warden_pending_verifications", uint64(Warden::GetPendingVerifications()));
     });
 
     TC_METRIC_EVENT("events", "Worldserver started", "");
@@ -326,6 +340,14 @@ extern int main(int argc, char** argv)
     sSecretMgr->Initialize();
     sWorld->SetInitialWorldSettings();
 
+    if (sWorld->getBoolConfig(CONFIG_WARDEN_ENABLED))
+        Warden::StartVerificationPool(sConfigMgr->GetIntDefault("Warden.VerifyThreads", 1), sConfigMgr->GetIntDefault("Warden.VerifyMaxQueuedTasks", 4000));
+
+    std::shared_ptr<void> wardenHandle(nullptr, [](void*)
+    {
+        Warden::StopVerificationPool();
+    });
+
     std::shared_ptr<void> mapManagementHandle(nullptr, [](void*)
     {
         // unload battleground templates before different singletons destroyed
@@ -0,0 +1,59 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_EXTRACTOR_JOBS_H
+#define TRINITYCORE_EXTRACTOR_JOBS_H
+
+#include "Define.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Trinity
+{
+/*
+ * Runs job(index) for every index in [0, jobCount) on threadCount new threads, jobs are handed out in index order.
+ * Every thread calls setup before its first job and cleanup after its last one, the extractors open and close
+ * their own archive handles there since those can not be shared between threads.
+ */
+template<typename Setup, typename Job, typename Cleanup>
+void RunExtractorJobs(std::size_t jobCount, uint32 threadCount, Setup setup, Job job, Cleanup cleanup)
+{
+    if (!jobCount)
+        return;
+
+    std::atomic<std::size_t> nextJob(0);
+    auto worker = [&]()
+    {
+        setup();
+        for (std::size_t index = nextJob++; index < jobCount; index = nextJob++)
+            job(index);
+        cleanup();
+    };
+
+    std::vector<std::thread> threads;
+    threadCount = uint32(std::clamp<std::size_t>(threadCount, 1, jobCount));
+    for (uint32 i = 0; i < threadCount; ++i)
+        threads.emplace_back(worker);
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+}
+
+#endif // TRINITYCORE_EXTRACTOR_JOBS_H
@@ -0,0 +1,132 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ExtractorManifest.h"
+#include "Util.h"
+#include <boost/filesystem/operations.hpp>
+#include <array>
+
+namespace
+{
+    // "settings <hash>" followed by one "<input hash> <output hash> <output name>" line per entry
+    constexpr std::size_t HashLength = 2 * Trinity::Crypto::SHA1::DIGEST_LENGTH;
+    constexpr char SettingsPrefix[] = "settings ";
+
+    // output hash of entries that did not produce a file
+    constexpr Trinity::ExtractorManifest::Hash NoOutput = { };
+}
+
+std::size_t Trinity::ExtractorManifest::Open(boost::filesystem::path const& fileName, Hash const& settings)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    _directory = fileName.parent_path();
+    _entries.clear();
+
+    std::string settingsLine = SettingsPrefix + ByteArrayToHexStr(settings);
+    std::ifstream previous(fileName.string());
+    std::string line;
+    if (previous && std::getline(previous, line) && line == settingsLine)
+    {
+        while (std::getline(previous, line))
+        {
+            // the last line is cut short when the previous run was killed while writing it
+            if (line.length() <= 2 * HashLength + 2 || line[HashLength] != ' ' || line[2 * HashLength + 1] != ' ')
+                continue;
+
+            Entry entry;
+            HexStrToByteArray(std::string_view(line).substr(0, HashLength), entry.Input);
+            HexStrToByteArray(std::string_view(line).substr(HashLength + 1, HashLength), entry.Output);
+            _entries[line.substr(2 * HashLength + 2)] = entry;
+        }
+    }
+
+    previous.close();
+
+    // compact the record, repeated runs would otherwise append an entry for every output each time
+    _file.open(fileName.string(), std::ios::out | std::ios::trunc);
+    _file << settingsLine << '\n';
+    for (auto const& [outputName, entry] : _entries)
+        WriteEntry(outputName, entry);
+
+    _file.flush();
+    return _entries.size();
+}
+
+bool Trinity::ExtractorManifest::IsUpToDate(std::string const& outputName, Hash const& input) const
+{
+    Hash recorded;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        auto itr = _entries.find(outputName);
+        if (itr == _entries.end() || itr->second.Input != input)
+            return false;
+
+        recorded = itr->second.Output;
+    }
+
+    boost::system::error_code error;
+    if (recorded == NoOutput)
+        return !boost::filesystem::exists(GetPath(outputName), error);
+
+    // the file might have been changed or removed since
+    Hash current;
+    return HashFile(GetPath(outputName), current) && current == recorded;
+}
+
+void Trinity::ExtractorManifest::Complete(std::string const& outputName, Hash const& input)
+{
+    Entry entry;
+    entry.Input = input;
+    if (!HashFile(GetPath(outputName), entry.Output))
+        entry.Output = NoOutput;
+
+    std::lock_guard<std::mutex> lock(_lock);
+    _entries[outputName] = entry;
+    if (_file.is_open())
+    {
+        WriteEntry(outputName, entry);
+        _file.flush();
+    }
+}
+
+bool Trinity::ExtractorManifest::HashFile(boost::filesystem::path const& fileName, Hash& hash)
+{
+    std::ifstream file(fileName.string(), std::ios::in | std::ios::binary);
+    if (!file)
+        return false;
+
+    Trinity::Crypto::SHA1 sha;
+    std::array<char, 64 * 1024> buffer;
+    while (file)
+    {
+        file.read(buffer.data(), buffer.size());
+        sha.UpdateData(reinterpret_cast<uint8 const*>(buffer.data()), std::size_t(file.gcount()));
+    }
+
+    if (file.bad())
+        return false;
+
+    sha.Finalize();
+    hash = sha.GetDigest();
+    return true;
+}
+
+void Trinity::ExtractorManifest::WriteEntry(std::string const& outputName, Entry const& entry)
+{
+    _file << ByteArrayToHexStr(entry.Input) << ' ' << ByteArrayToHexStr(entry.Output) << ' ' << outputName << '\n';
+}
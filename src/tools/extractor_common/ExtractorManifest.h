@@ -0,0 +1,77 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYCORE_EXTRACTOR_MANIFEST_H
+#define TRINITYCORE_EXTRACTOR_MANIFEST_H
+
+#include "CryptoHash.h"
+#include <boost/filesystem/path.hpp>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Trinity
+{
+/*
+ * Record of the files an extractor produced, so interrupted or repeated runs only redo outputs whose inputs changed.
+ * Every entry ties an output file to the hash of the data it was produced from and to the hash of the file itself,
+ * the output is up to date while both still match. Entries are appended as soon as an output is complete, so the
+ * record survives the extractor being killed. All entries are dropped when the settings hash differs, it covers
+ * everything besides the input data that changes the output (file format versions, options, client build).
+ * Inputs that legitimately produce no output can be recorded too, they stay up to date while their file does not exist.
+ * Output names are relative to the directory of the manifest. All methods can be called from any thread.
+ */
+class ExtractorManifest
+{
+public:
+    using Hash = Trinity::Crypto::SHA1::Digest;
+
+    ExtractorManifest() = default;
+
+    ExtractorManifest(ExtractorManifest const&) = delete;
+    ExtractorManifest& operator=(ExtractorManifest const&) = delete;
+
+    // Reads the entries of a previous run and starts recording, returns the number of entries kept
+    std::size_t Open(boost::filesystem::path const& fileName, Hash const& settings);
+
+    bool IsUpToDate(std::string const& outputName, Hash const& input) const;
+
+    // Hashes the finished output and records it, a missing output file is recorded as such
+    void Complete(std::string const& outputName, Hash const& input);
+
+    boost::filesystem::path GetPath(std::string const& outputName) const { return _directory / outputName; }
+
+    static bool HashFile(boost::filesystem::path const& fileName, Hash& hash);
+
+private:
+    struct Entry
+    {
+        Hash Input;
+        Hash Output;
+    };
+
+    void WriteEntry(std::string const& outputName, Entry const& entry);
+
+    boost::filesystem::path _directory;
+    std::unordered_map<std::string, Entry> _entries;
+    std::ofstream _file;
+    mutable std::mutex _lock;
+};
+}
+
+#endif // TRINITYCORE_EXTRACTOR_MANIFEST_H
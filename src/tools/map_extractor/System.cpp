@@ -17,6 +17,8 @@
 
 #include "dbcfile.h"
 #include "Banner.h"
+#include "ExtractorJobs.h"
+#include "ExtractorManifest.h"
 #include "Locales.h"
 #include "mpq_libmpq04.h"
 #include "StringFormat.h"
@@ -27,9 +29,12 @@
 #include <boost/filesystem/directory.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
+#include <atomic>
 #include <deque>
 #include <fstream>
+#include <map>
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <cstdio>
 #include <cstdlib>
@@ -38,7 +43,7 @@
 #include <G3D/Plane.h>
 #include <boost/filesystem.hpp>
 
-extern ArchiveSet gOpenArchives;
+extern thread_local ArchiveSet gOpenArchives;
 
 typedef struct
 {
@@ -69,6 +74,7 @@ enum Extract
 
 // Select data for extract
 int   CONF_extract = EXTRACT_MAP | EXTRACT_DBC | EXTRACT_CAMERA;
+uint32 CONF_threads = std::thread::hardware_concurrency();
 // This option allow limit minimum height to some value (Allow save some memory)
 bool  CONF_allow_height_limit = true;
 float CONF_use_minHeight = -500.0f;
@@ -115,7 +121,8 @@ void Usage(char* prg)
         "-o set output path (max %d characters)\n"\
         "-e extract only MAP(1)/DBC(2)/Camera(4) - standard: all(7)\n"\
         "-f height stored as int (less map size but lost some accuracy) 1 by default\n"\
-        "Example: %s -f 0 -i \"c:\\games\\game\"", prg, MAX_PATH_LENGTH - 1, MAX_PATH_LENGTH - 1, prg);
+        "-t number of threads converting map tiles - standard: %u\n"\
+        "Example: %s -f 0 -i \"c:\\games\\game\"", prg, MAX_PATH_LENGTH - 1, MAX_PATH_LENGTH - 1, CONF_threads, prg);
     exit(1);
 }
 
@@ -167,6 +174,12 @@ void HandleArgs(int argc, char * arg[])
                 else
                     Usage(arg[0]);
                 break;
+            case 't':
+                if (c + 1 < argc)                            // all ok
+                    CONF_threads = std::max(atoi(arg[(c++) + 1]), 1);
+                else
+                    Usage(arg[0]);
+                break;
         }
     }
 }
@@ -340,32 +353,27 @@ float selectUInt16StepStore(float maxDiff)
 {
     return 65535 / maxDiff;
 }
-// Temporary grid data store
-uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-
-float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint16 uint16_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint8  uint8_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-
-uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float liquid_height[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
-uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-
-int16 flight_box_max[3][3];
-int16 flight_box_min[3][3];
-
-bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int /*cell_y*/, int /*cell_x*/, uint32 build)
+// Temporary grid data store, one per tile converting thread
+thread_local uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+thread_local float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+thread_local uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint16 uint16_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+thread_local uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint8  uint8_V9[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+
+thread_local uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float liquid_height[ADT_GRID_SIZE+1][ADT_GRID_SIZE+1];
+thread_local uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+thread_local int16 flight_box_max[3][3];
+thread_local int16 flight_box_min[3][3];
+
+bool ConvertADT(ADT_file& adt, std::string const& inputPath, std::string const& outputPath, int /*cell_y*/, int /*cell_x*/, uint32 build)
 {
-    ADT_file adt;
-
-    if (!adt.loadFile(inputPath))
-        return false;
-
     adt_MCIN *cells = adt.a_grid->getMCIN();
     if (!cells)
     {
@@ -921,10 +929,58 @@ bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int
     return true;
 }
 
-void ExtractMapsFromMpq(uint32 build)
+// Everything besides the adt itself that ends up in the map files
+Trinity::ExtractorManifest::Hash GetMapSettingsHash(uint32 build)
+{
+    Trinity::Crypto::SHA1 sha;
+    sha.UpdateData(Trinity::StringFormat("{} {} {} {} {} {} {} {} {} {} {}", MAP_MAGIC, MAP_VERSION_MAGIC, build,
+        CONF_allow_height_limit, CONF_use_minHeight, CONF_allow_float_to_int, CONF_float_to_int8_limit, CONF_float_to_int16_limit,
+        CONF_flat_height_delta_limit, CONF_flat_liquid_delta_limit, FILE_FORMAT_VERSION));
+
+    std::map<uint32, uint8> soundBanks;
+    for (auto const& [liquidTypeId, liquidType] : LiquidTypes)
+        soundBanks[liquidTypeId] = liquidType.SoundBank;
+
+    for (auto const& [liquidTypeId, soundBank] : soundBanks)
+        sha.UpdateData(Trinity::StringFormat(" {}:{}", liquidTypeId, soundBank));
+
+    sha.Finalize();
+    return sha.GetDigest();
+}
+
+struct TileJob
+{
+    uint32 MapIndex;
+    uint32 X;
+    uint32 Y;
+};
+
+void ExtractTile(TileJob const& job, Trinity::ExtractorManifest& manifest, uint32 build, std::atomic<uint32>& skipped)
+{
+    std::string mpqFileName = Trinity::StringFormat("World\\Maps\\{}\\{}_{}_{}.adt", map_ids[job.MapIndex].name, map_ids[job.MapIndex].name, job.X, job.Y);
+    std::string outputName = Trinity::StringFormat("maps/{:03}{:02}{:02}.map", map_ids[job.MapIndex].id, job.Y, job.X);
+
+    ADT_file adt;
+    if (!adt.loadFile(mpqFileName))
+        return;
+
+    Trinity::ExtractorManifest::Hash inputHash = Trinity::Crypto::SHA1::GetDigestOf(adt.GetData(), adt.GetDataSize());
+    if (manifest.IsUpToDate(outputName, inputHash))
+    {
+        ++skipped;
+        return;
+    }
+
+    if (ConvertADT(adt, mpqFileName, manifest.GetPath(outputName).string(), job.Y, job.X, build))
+        manifest.Complete(outputName, inputHash);
+}
+
+void LoadLocaleMPQFiles(int const locale);
+void LoadCommonMPQFiles();
+void CloseMPQFiles();
+
+void ExtractMapsFromMpq(uint32 build, int locale)
 {
-    std::string mpqFileName;
-    std::string outputFileName;
     std::string mpqMapName;
 
     printf("Extracting maps...\n");
@@ -937,7 +993,12 @@ void ExtractMapsFromMpq(uint32 build)
     path += "/maps/";
     CreateDir(path);
 
-    printf("Convert map files\n");
+    // tiles whose adt and settings did not change since they were last converted are skipped
+    Trinity::ExtractorManifest manifest;
+    if (std::size_t previousTiles = manifest.Open(boost::filesystem::path(output_path) / "maps.manifest", GetMapSettingsHash(build)))
+        printf("Found %u tiles converted by a previous run\n", uint32(previousTiles));
+
+    std::vector<TileJob> jobs;
     for(uint32 z = 0; z < map_count; ++z)
     {
         printf("Extract %s (%d/%u)                  \n", map_ids[z].name, z+1, map_count);
@@ -952,21 +1013,33 @@ void ExtractMapsFromMpq(uint32 build)
         }
 
         for(uint32 y = 0; y < WDT_MAP_SIZE; ++y)
-        {
             for(uint32 x = 0; x < WDT_MAP_SIZE; ++x)
-            {
-                if (!wdt.main->adt_list[y][x].exist)
-                    continue;
-
-                mpqFileName = Trinity::StringFormat("World\\Maps\\{}\\{}_{}_{}.adt", map_ids[z].name, map_ids[z].name, x, y);
-                outputFileName = Trinity::StringFormat("{}/maps/{:03}{:02}{:02}.map", output_path, map_ids[z].id, y, x);
-                ConvertADT(mpqFileName, outputFileName, y, x, build);
-            }
-            // draw progress bar
-            printf("Processing........................%d%%\r", (100 * (y+1)) / WDT_MAP_SIZE);
-        }
+                if (wdt.main->adt_list[y][x].exist)
+                    jobs.push_back({ z, x, y });
     }
+
+    printf("Convert %u map files using %u threads\n", uint32(jobs.size()), CONF_threads);
+    std::atomic<uint32> done(0);
+    std::atomic<uint32> skipped(0);
+    Trinity::RunExtractorJobs(jobs.size(), CONF_threads, [locale]()
+    {
+        LoadLocaleMPQFiles(locale);
+        LoadCommonMPQFiles();
+    }, [&](std::size_t index)
+    {
+        ExtractTile(jobs[index], manifest, build, skipped);
+
+        // draw progress bar
+        uint32 count = ++done;
+        if ((100 * count) / jobs.size() != (100 * (count - 1)) / jobs.size())
+            printf("Processing........................%u%%\r", uint32((100 * count) / jobs.size()));
+    }, []()
+    {
+        CloseMPQFiles();
+    });
     printf("\n");
+    if (skipped)
+        printf("%u map files were up to date\n", skipped.load());
 }
 
 bool ExtractFile( char const* mpq_name, std::string const& filename )
@@ -1115,7 +1188,7 @@ void LoadCommonMPQFiles()
     }
 }
 
-inline void CloseMPQFiles()
+void CloseMPQFiles()
 {
     for(ArchiveSet::iterator j = gOpenArchives.begin(); j != gOpenArchives.end();++j) (*j)->close();
         gOpenArchives.clear();
@@ -1196,7 +1269,7 @@ int main(int argc, char * arg[])
         LoadCommonMPQFiles();
 
         // Extract maps
-        ExtractMapsFromMpq(build);
+        ExtractMapsFromMpq(build, FirstLocale);
 
         // Close MPQs
         CloseMPQFiles();
@@ -19,7 +19,8 @@
 #include <deque>
 #include <cstdio>
 
-ArchiveSet gOpenArchives;
+// every extraction thread opens its own handles, libmpq archives can not be read from several threads
+thread_local ArchiveSet gOpenArchives;
 
 MPQArchive::MPQArchive(char const* filename)
 {
@@ -27,6 +27,8 @@
 #include <DetourCommon.h>
 #include <DetourNavMesh.h>
 #include <DetourNavMeshBuilder.h>
+#include <boost/filesystem/operations.hpp>
+#include <algorithm>
 #include <climits>
 
 namespace MMAP
@@ -246,9 +248,12 @@ namespace MMAP
             m_tileBuilders.push_back(new TileBuilder(this, m_skipLiquid, m_bigBaseUnit, m_debugOutput));
         }
 
+        openManifest();
+
+        std::vector<TileInfo> tileInfos;
         if (mapID)
         {
-            buildMap(*mapID);
+            buildMap(*mapID, tileInfos);
         }
         else
         {
@@ -256,10 +261,20 @@ namespace MMAP
             for (TileList::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it)
             {
                 if (!shouldSkipMap(it->m_mapId))
-                    buildMap(it->m_mapId);
+                    buildMap(it->m_mapId, tileInfos);
             }
         }
 
+        // a few tiles (cities, big wmos) take many times longer than the rest, starting them first
+        // keeps the run from ending with all but one thread idle
+        std::stable_sort(tileInfos.begin(), tileInfos.end(), [](TileInfo const& left, TileInfo const& right)
+        {
+            return left.m_inputSize > right.m_inputSize;
+        });
+
+        for (TileInfo const& tileInfo : tileInfos)
+            _queue.Push(tileInfo);
+
         while (!_queue.Empty())
         {
             std::this_thread::sleep_for(std::chrono::milliseconds(1000));
@@ -409,6 +424,8 @@ namespace MMAP
     /**************************************************************************/
     void MapBuilder::buildSingleTile(uint32 mapID, uint32 tileX, uint32 tileY)
     {
+        openManifest();
+
         dtNavMesh* navMesh = nullptr;
         buildNavMesh(mapID, navMesh);
         if (!navMesh)
@@ -429,7 +446,7 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void MapBuilder::buildMap(uint32 mapID)
+    void MapBuilder::buildMap(uint32 mapID, std::vector<TileInfo>& tileInfos)
     {
         std::set<uint32>* tiles = getTileList(mapID);
 
@@ -459,7 +476,8 @@ namespace MMAP
                 tileInfo.m_tileX = tileX;
                 tileInfo.m_tileY = tileY;
                 memcpy(&tileInfo.m_navMeshParams, navMesh->getParams(), sizeof(dtNavMeshParams));
-                _queue.Push(tileInfo);
+                tileInfo.m_inputSize = getTileInputSize(mapID, tileX, tileY);
+                tileInfos.push_back(tileInfo);
             }
 
             dtFreeNavMesh(navMesh);
@@ -467,16 +485,42 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void TileBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh)
+    uint64 MapBuilder::getTileInputSize(uint32 mapID, uint32 tileX, uint32 tileY) const
     {
-        if(shouldSkipTile(mapID, tileX, tileY))
+        boost::filesystem::path const inputs[] =
         {
-            ++m_mapBuilder->m_totalTilesProcessed;
-            return;
+            Trinity::StringFormat("maps/{:03}{:02}{:02}.map", mapID, tileY, tileX),
+            boost::filesystem::path("vmaps") / StaticMapTree::getTileFileName(mapID, tileY, tileX)
+        };
+
+        uint64 size = 0;
+        for (boost::filesystem::path const& input : inputs)
+        {
+            boost::system::error_code error;
+            uintmax_t fileSize = boost::filesystem::file_size(input, error);
+            if (!error)
+                size += fileSize;
         }
 
-        printf("%u%% [Map %03i] Building tile [%02u,%02u]\n", m_mapBuilder->currentPercentageDone(), mapID, tileX, tileY);
+        return size;
+    }
+
+    /**************************************************************************/
+    void MapBuilder::openManifest()
+    {
+        // everything else that changes the tiles is part of the input hash of each tile
+        Trinity::Crypto::SHA1 sha;
+        sha.UpdateData(Trinity::StringFormat("{} {} {}", MMAP_MAGIC, MMAP_VERSION, DT_NAVMESH_VERSION));
+        sha.Finalize();
+
+        m_manifest = std::make_unique<Trinity::ExtractorManifest>();
+        if (std::size_t builtTiles = m_manifest->Open("mmaps.manifest", sha.GetDigest()))
+            printf("Found %u tiles built by a previous run, unchanged tiles are not built again\n", uint32(builtTiles));
+    }
 
+    /**************************************************************************/
+    void TileBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh)
+    {
         MeshData meshData;
 
         // get heightmap data
@@ -513,12 +557,66 @@ namespace MMAP
 
         m_terrainBuilder->loadOffMeshConnections(mapID, tileX, tileY, meshData, m_mapBuilder->m_offMeshFilePath);
 
+        // loading the data takes a fraction of the time recast needs, hashing what was loaded covers exactly
+        // the terrain of the tile and its neighbours, the models spawned in it and its offmesh connections
+        Trinity::ExtractorManifest* manifest = m_mapBuilder->m_manifest.get();
+        std::string const outputName = Trinity::StringFormat("mmaps/{:03}{:02}{:02}.mmtile", mapID, tileY, tileX);
+        Trinity::ExtractorManifest::Hash inputHash = hashTileInput(mapID, meshData, bmin, bmax, navMesh);
+        if (manifest && !m_debugOutput && manifest->IsUpToDate(outputName, inputHash))
+        {
+            ++m_mapBuilder->m_totalTilesProcessed;
+            return;
+        }
+
+        printf("%u%% [Map %03i] Building tile [%02u,%02u]\n", m_mapBuilder->currentPercentageDone(), mapID, tileX, tileY);
+
+        // a rebuilt tile might not produce any output anymore
+        boost::system::error_code error;
+        boost::filesystem::remove(outputName, error);
+
         // build navmesh tile
-        buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
+        if (buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh) && manifest)
+            manifest->Complete(outputName, inputHash);
 
         ++m_mapBuilder->m_totalTilesProcessed;
     }
 
+    /**************************************************************************/
+    Trinity::ExtractorManifest::Hash TileBuilder::hashTileInput(uint32 mapID, MeshData const& meshData,
+        float bmin[3], float bmax[3], dtNavMesh const* navMesh) const
+    {
+        Trinity::Crypto::SHA1 sha;
+        auto hashArray = [&sha](auto const& array)
+        {
+            uint32 size = uint32(array.size());
+            sha.UpdateData(reinterpret_cast<uint8 const*>(&size), sizeof(size));
+            sha.UpdateData(reinterpret_cast<uint8 const*>(array.getCArray()), array.size() * sizeof(*array.getCArray()));
+        };
+
+        hashArray(meshData.solidVerts);
+        hashArray(meshData.solidTris);
+        hashArray(meshData.liquidVerts);
+        hashArray(meshData.liquidTris);
+        hashArray(meshData.liquidType);
+        hashArray(meshData.offMeshConnections);
+        hashArray(meshData.offMeshConnectionRads);
+        hashArray(meshData.offMeshConnectionDirs);
+        hashArray(meshData.offMeshConnectionsAreas);
+        hashArray(meshData.offMeshConnectionsFlags);
+
+        // config is zero initialized, there is no padding to worry about
+        rcConfig config = m_mapBuilder->GetMapSpecificConfig(mapID, bmin, bmax, TileConfig(m_bigBaseUnit));
+        sha.UpdateData(reinterpret_cast<uint8 const*>(&config), sizeof(config));
+        // the tile position in the navmesh is relative to the origin of the map
+        sha.UpdateData(reinterpret_cast<uint8 const*>(navMesh->getParams()->orig), sizeof(navMesh->getParams()->orig));
+
+        uint8 usesLiquids = m_terrainBuilder->usesLiquids();
+        sha.UpdateData(&usesLiquids, sizeof(usesLiquids));
+
+        sha.Finalize();
+        return sha.GetDigest();
+    }
+
     /**************************************************************************/
     void MapBuilder::buildNavMesh(uint32 mapID, dtNavMesh* &navMesh)
     {
@@ -595,7 +693,7 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
+    bool TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
         MeshData &meshData, float bmin[3], float bmax[3],
         dtNavMesh* navMesh)
     {
@@ -763,7 +861,7 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return false;
         }
         rcMergePolyMeshes(m_rcContext, pmmerge, nmerge, *iv.polyMesh);
 
@@ -774,7 +872,7 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return false;
         }
         rcMergePolyMeshDetails(m_rcContext, dmmerge, nmerge, *iv.polyMeshDetail);
 
@@ -834,6 +932,8 @@ namespace MMAP
         // will hold final navmesh
         unsigned char* navData = nullptr;
         int navDataSize = 0;
+        // tiles without polygons are not written at all, only failing to write one needs to be retried
+        bool written = true;
 
         do
         {
@@ -899,6 +999,7 @@ namespace MMAP
                 sprintf(message, "[Map %03i] Failed to open %s for writing!\n", mapID, fileName);
                 perror(message);
                 navMesh->removeTile(tileRef, nullptr, nullptr);
+                written = false;
                 break;
             }
 
@@ -937,6 +1038,8 @@ namespace MMAP
             iv.generateObjFile(mapID, tileX, tileY, meshData);
             iv.writeIV(mapID, tileX, tileY);
         }
+
+        return written;
     }
 
     /**************************************************************************/
@@ -1060,30 +1163,6 @@ namespace MMAP
         }
     }
 
-    /**************************************************************************/
-    bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const
-    {
-        char fileName[255];
-        sprintf(fileName, "mmaps/%03u%02i%02i.mmtile", mapID, tileY, tileX);
-        FILE* file = fopen(fileName, "rb");
-        if (!file)
-            return false;
-
-        MmapTileHeader header;
-        int count = fread(&header, sizeof(MmapTileHeader), 1, file);
-        fclose(file);
-        if (count != 1)
-            return false;
-
-        if (header.mmapMagic != MMAP_MAGIC || header.dtVersion != uint32(DT_NAVMESH_VERSION))
-            return false;
-
-        if (header.mmapVersion != MMAP_VERSION)
-            return false;
-
-        return true;
-    }
-
     rcConfig MapBuilder::GetMapSpecificConfig(uint32 mapID, float bmin[3], float bmax[3], const TileConfig &tileConfig) const
     {
         rcConfig config;
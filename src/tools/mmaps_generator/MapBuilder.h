@@ -20,6 +20,7 @@
 
 #include "TerrainBuilder.h"
 
+#include "ExtractorManifest.h"
 #include "Recast.h"
 #include "DetourNavMesh.h"
 #include "Optional.h"
@@ -29,6 +30,7 @@
 #include <set>
 #include <list>
 #include <atomic>
+#include <memory>
 #include <thread>
 
 using namespace VMAP;
@@ -94,12 +96,13 @@ namespace MMAP
 
     struct TileInfo
     {
-        TileInfo() : m_mapId(uint32(-1)), m_tileX(), m_tileY(), m_navMeshParams() {}
+        TileInfo() : m_mapId(uint32(-1)), m_tileX(), m_tileY(), m_navMeshParams(), m_inputSize() {}
 
         uint32 m_mapId;
         uint32 m_tileX;
         uint32 m_tileY;
         dtNavMeshParams m_navMeshParams;
+        uint64 m_inputSize;                 // size of the terrain and model files, used to build the biggest tiles first
     };
 
     // ToDo: move this to its own file. For now it will stay here to keep the changes to a minimum, especially in the cpp file
@@ -119,8 +122,8 @@ namespace MMAP
             void WaitCompletion();
 
             void buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh);
-            // move map building
-            void buildMoveMapTile(uint32 mapID,
+            // move map building, returns false if the result could not be written
+            bool buildMoveMapTile(uint32 mapID,
                 uint32 tileX,
                 uint32 tileY,
                 MeshData& meshData,
@@ -128,7 +131,9 @@ namespace MMAP
                 float bmax[3],
                 dtNavMesh* navMesh);
 
-            bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const;
+            // hash of everything the tile is built from: the loaded terrain, models and offmesh connections and the config
+            Trinity::ExtractorManifest::Hash hashTileInput(uint32 mapID, MeshData const& meshData,
+                float bmin[3], float bmax[3], dtNavMesh const* navMesh) const;
 
         private:
             bool m_bigBaseUnit;
@@ -169,8 +174,11 @@ namespace MMAP
             void buildMaps(Optional<uint32> mapID);
 
         private:
-            // builds all mmap tiles for the specified map id (ignores skip settings)
-            void buildMap(uint32 mapID);
+            // builds the navmesh of the specified map id and collects its mmap tiles (ignores skip settings)
+            void buildMap(uint32 mapID, std::vector<TileInfo>& tileInfos);
+            uint64 getTileInputSize(uint32 mapID, uint32 tileX, uint32 tileY) const;
+            // tiles whose inputs did not change since they were last built are skipped
+            void openManifest();
             // detect maps and tiles
             void discoverTiles();
             std::set<uint32>* getTileList(uint32 mapID);
@@ -215,6 +223,8 @@ namespace MMAP
             // build performance - not really used for now
             rcContext* m_rcContext;
 
+            std::unique_ptr<Trinity::ExtractorManifest> m_manifest;
+
             std::vector<TileBuilder*> m_tileBuilders;
             ProducerConsumerQueue<TileInfo> _queue;
             std::atomic<bool> _cancelationToken;
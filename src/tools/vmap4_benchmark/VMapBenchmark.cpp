@@ -0,0 +1,279 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Banner.h"
+#include "Locales.h"
+#include "Util.h"
+#include "VMapManager2.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+/*
+ * Replays line of sight and height queries against extracted vmaps.
+ * Line of sight is measured once ray by ray and once in batches traced as ray packets,
+ * both must give the same answers.
+ *
+ * Query files hold one query per line:
+ *   los <x1> <y1> <z1> <x2> <y2> <z2>
+ *   height <x> <y> <z> <max search distance>
+ * Without a query file random queries are generated over the loaded tiles.
+ */
+
+namespace
+{
+    constexpr float GridSize = 533.3333f;
+    constexpr int GridCount = 64;
+
+    struct HeightQuery
+    {
+        float X, Y, Z, MaxSearchDist;
+    };
+
+    struct Options
+    {
+        std::string VMapPath;
+        uint32 MapId = 0;
+        std::string QueryFile;
+        uint32 RandomQueries = 100000;
+        uint32 BatchSize = 32;
+        uint32 Passes = 5;
+    };
+
+    void PrintUsage(char const* program)
+    {
+        std::cout << "usage: " << program << " <vmap dir> <map id> [options]\n"
+            "  --queries <file>    replay queries from file instead of generating random ones\n"
+            "  --random <count>    number of random queries of each kind (default 100000)\n"
+            "  --batch <size>      rays per batched line of sight call (default 32)\n"
+            "  --passes <count>    how often every query set is replayed (default 5)" << std::endl;
+    }
+
+    bool ParseOptions(int argc, char* argv[], Options& options)
+    {
+        if (argc < 3)
+            return false;
+
+        options.VMapPath = argv[1];
+        options.MapId = uint32(std::strtoul(argv[2], nullptr, 10));
+        for (int i = 3; i < argc; ++i)
+        {
+            bool hasValue = i + 1 < argc;
+            if (!strcmp(argv[i], "--queries") && hasValue)
+                options.QueryFile = argv[++i];
+            else if (!strcmp(argv[i], "--random") && hasValue)
+                options.RandomQueries = uint32(std::strtoul(argv[++i], nullptr, 10));
+            else if (!strcmp(argv[i], "--batch") && hasValue)
+                options.BatchSize = std::max(uint32(std::strtoul(argv[++i], nullptr, 10)), 1u);
+            else if (!strcmp(argv[i], "--passes") && hasValue)
+                options.Passes = std::max(uint32(std::strtoul(argv[++i], nullptr, 10)), 1u);
+            else
+                return false;
+        }
+
+        return true;
+    }
+
+    // Returns the grids that were loaded, as x | y << 8
+    std::vector<uint32> LoadAllTiles(VMAP::VMapManager2& vmgr, Options const& options)
+    {
+        std::vector<uint32> tiles;
+        for (int x = 0; x < GridCount; ++x)
+        {
+            for (int y = 0; y < GridCount; ++y)
+            {
+                if (vmgr.existsMap(options.VMapPath.c_str(), options.MapId, x, y) != VMAP::LoadResult::Success)
+                    continue;
+
+                if (vmgr.loadMap(options.VMapPath.c_str(), options.MapId, x, y) == VMAP::VMAP_LOAD_RESULT_OK)
+                    tiles.push_back(uint32(x) | uint32(y) << 8);
+            }
+        }
+
+        return tiles;
+    }
+
+    bool ReadQueries(std::string const& fileName, std::vector<VMAP::LineOfSightRay>& lineOfSight, std::vector<HeightQuery>& heights)
+    {
+        std::ifstream file(fileName);
+        if (!file)
+            return false;
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::istringstream stream(line);
+            std::string type;
+            if (!(stream >> type))
+                continue;
+
+            if (type == "los")
+            {
+                VMAP::LineOfSightRay ray;
+                if (stream >> ray.X1 >> ray.Y1 >> ray.Z1 >> ray.X2 >> ray.Y2 >> ray.Z2)
+                    lineOfSight.push_back(ray);
+            }
+            else if (type == "height")
+            {
+                HeightQuery query;
+                if (stream >> query.X >> query.Y >> query.Z >> query.MaxSearchDist)
+                    heights.push_back(query);
+            }
+        }
+
+        return true;
+    }
+
+    // Points are put on the vmap ground where there is one, so most rays run close to geometry like the ones of units do
+    void GenerateQueries(VMAP::VMapManager2& vmgr, Options const& options, std::vector<uint32> const& tiles,
+        std::vector<VMAP::LineOfSightRay>& lineOfSight, std::vector<HeightQuery>& heights)
+    {
+        std::mt19937 random(options.MapId);
+        std::uniform_real_distribution<float> inGrid(0.0f, GridSize);
+        std::uniform_real_distribution<float> offset(-60.0f, 60.0f);
+        std::uniform_real_distribution<float> heightAboveGround(0.5f, 3.0f);
+        std::uniform_int_distribution<std::size_t> tile(0, tiles.size() - 1);
+
+        auto groundZ = [&](float x, float y)
+        {
+            float z = vmgr.getHeight(options.MapId, x, y, 1000.0f, 2000.0f);
+            return z > VMAP_INVALID_HEIGHT ? z : 0.0f;
+        };
+
+        for (uint32 i = 0; i < options.RandomQueries; ++i)
+        {
+            uint32 grid = tiles[tile(random)];
+            float x = (32 - int32(grid & 0xFF) - 1) * GridSize + inGrid(random);
+            float y = (32 - int32(grid >> 8) - 1) * GridSize + inGrid(random);
+
+            VMAP::LineOfSightRay ray;
+            ray.X1 = x;
+            ray.Y1 = y;
+            ray.Z1 = groundZ(x, y) + heightAboveGround(random);
+            ray.X2 = x + offset(random);
+            ray.Y2 = y + offset(random);
+            ray.Z2 = groundZ(ray.X2, ray.Y2) + heightAboveGround(random);
+            lineOfSight.push_back(ray);
+
+            heights.push_back({ x, y, ray.Z1 + 2.0f, 50.0f });
+        }
+    }
+
+    template<typename Work>
+    double MeasureNanoseconds(uint32 passes, std::size_t queries, Work&& work)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32 pass = 0; pass < passes; ++pass)
+            work();
+
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return queries ? elapsed.count() / (double(queries) * passes) : 0.0;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Trinity::VerifyOsVersion();
+
+    Trinity::Locale::Init();
+
+    Trinity::Banner::Show("VMAP benchmark", [](char const* text) { std::cout << text << std::endl; }, nullptr);
+
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    VMAP::VMapManager2 vmgr;
+    std::vector<uint32> tiles = LoadAllTiles(vmgr, options);
+    if (tiles.empty())
+    {
+        std::cout << "no vmap tiles of map " << options.MapId << " found in " << options.VMapPath << std::endl;
+        return 1;
+    }
+
+    std::cout << "loaded " << tiles.size() << " tiles of map " << options.MapId << std::endl;
+
+    std::vector<VMAP::LineOfSightRay> lineOfSight;
+    std::vector<HeightQuery> heights;
+    if (!options.QueryFile.empty())
+    {
+        if (!ReadQueries(options.QueryFile, lineOfSight, heights))
+        {
+            std::cout << "can not read " << options.QueryFile << std::endl;
+            return 1;
+        }
+    }
+    else
+        GenerateQueries(vmgr, options, tiles, lineOfSight, heights);
+
+    std::cout << lineOfSight.size() << " line of sight and " << heights.size() << " height queries, " << options.Passes << " passes" << std::endl;
+
+    std::vector<bool> singleResults(lineOfSight.size());
+    double singleNs = MeasureNanoseconds(options.Passes, lineOfSight.size(), [&]()
+    {
+        for (std::size_t i = 0; i < lineOfSight.size(); ++i)
+        {
+            VMAP::LineOfSightRay const& ray = lineOfSight[i];
+            singleResults[i] = vmgr.isInLineOfSight(options.MapId, ray.X1, ray.Y1, ray.Z1, ray.X2, ray.Y2, ray.Z2, VMAP::ModelIgnoreFlags::Nothing);
+        }
+    });
+
+    double batchNs = MeasureNanoseconds(options.Passes, lineOfSight.size(), [&]()
+    {
+        for (std::size_t first = 0; first < lineOfSight.size(); first += options.BatchSize)
+        {
+            std::size_t count = std::min<std::size_t>(lineOfSight.size() - first, options.BatchSize);
+            vmgr.isInLineOfSight(options.MapId, std::span<VMAP::LineOfSightRay>(lineOfSight.data() + first, count), VMAP::ModelIgnoreFlags::Nothing);
+        }
+    });
+
+    std::size_t mismatches = 0;
+    std::size_t blocked = 0;
+    for (std::size_t i = 0; i < lineOfSight.size(); ++i)
+    {
+        if (lineOfSight[i].InLineOfSight != singleResults[i])
+            ++mismatches;
+        if (!singleResults[i])
+            ++blocked;
+    }
+
+    float heightSum = 0.0f;
+    double heightNs = MeasureNanoseconds(options.Passes, heights.size(), [&]()
+    {
+        for (HeightQuery const& query : heights)
+            heightSum += vmgr.getHeight(options.MapId, query.X, query.Y, query.Z, query.MaxSearchDist);
+    });
+
+    std::cout << "line of sight, single rays:   " << singleNs << " ns/query (" << blocked << " blocked)\n"
+        "line of sight, batches of " << options.BatchSize << ": " << batchNs << " ns/query\n"
+        "height:                       " << heightNs << " ns/query (checksum " << heightSum << ")" << std::endl;
+
+    if (mismatches)
+    {
+        std::cout << mismatches << " batched line of sight results differ from single ray results" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
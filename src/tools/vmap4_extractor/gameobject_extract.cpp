@@ -18,25 +18,61 @@
 #include "model.h"
 #include "dbcfile.h"
 #include "adtfile.h"
+#include "ExtractorManifest.h"
 #include "vmapexport.h"
 #include "VMapDefinitions.h"
 #include <algorithm>
 #include <stdio.h>
 
-bool ExtractSingleModel(std::string& fname)
+namespace
 {
-    if (fname.length() < 4)
-        return false;
+    void FixModelExtension(std::string& fname)
+    {
+        std::string extension = fname.substr(fname.length() - 4, 4);
+        if (extension == ".mdx" || extension == ".MDX" || extension == ".mdl" || extension == ".MDL")
+        {
+            // replace .mdx -> .m2
+            fname.erase(fname.length()-2,2);
+            fname.append("2");
+        }
+        // >= 3.1.0 ADT MMDX section store filename.m2 filenames for corresponded .m2 file
+        // nothing do
+    }
 
-    std::string extension = fname.substr(fname.length() - 4, 4);
-    if (extension == ".mdx" || extension == ".MDX" || extension == ".mdl" || extension == ".MDL")
+    // Fixes the model path of a GameObjectDisplayInfo.dbc record in place, returns false for paths without extension
+    bool FixGameobjectModelPath(std::string& path, char*& name, char*& extension)
     {
-        // replace .mdx -> .m2
-        fname.erase(fname.length()-2,2);
-        fname.append("2");
+        fixnamen((char*)path.c_str(), path.size());
+        name = GetPlainName((char*)path.c_str());
+        fixname2(name, strlen(name));
+
+        extension = GetExtension(name);
+        if (!extension)
+            return false;
+
+        strToLower(extension);
+        return true;
     }
-    // >= 3.1.0 ADT MMDX section store filename.m2 filenames for corresponded .m2 file
-    // nothing do
+}
+
+std::string GetModelOutputName(std::string fname)
+{
+    if (fname.length() < 4)
+        return {};
+
+    FixModelExtension(fname);
+    char* name = GetPlainName(&fname[0]);
+    fixnamen(name, strlen(name));
+    fixname2(name, strlen(name));
+    return name;
+}
+
+bool ExtractSingleModel(std::string& fname, Trinity::ExtractorManifest* manifest /*= nullptr*/)
+{
+    if (fname.length() < 4)
+        return false;
+
+    FixModelExtension(fname);
 
     std::string originalName = fname;
 
@@ -48,14 +84,57 @@ bool ExtractSingleModel(std::string& fname)
     output += "/";
     output += name;
 
-    if (FileExists(output.c_str()))
+    if (!manifest && FileExists(output.c_str()))
         return true;
 
+    std::string manifestName = GetManifestName(name);
+    Trinity::ExtractorManifest::Hash inputHash = { };
+    if (manifest)
+    {
+        MPQFile file(originalName.c_str());
+        if (!file.isEof())
+            inputHash = Trinity::Crypto::SHA1::GetDigestOf(reinterpret_cast<uint8 const*>(file.getBuffer()), file.getSize());
+
+        if (manifest->IsUpToDate(manifestName, inputHash))
+            return true;
+    }
+
     Model mdl(originalName);
     if (!mdl.open())
+    {
+        // a file left by an earlier run would be taken as extracted from this model
+        if (manifest)
+            remove(output.c_str());
+        return false;
+    }
+
+    if (!mdl.ConvertToVMAPModel(output.c_str()))
         return false;
 
-    return mdl.ConvertToVMAPModel(output.c_str());
+    if (manifest)
+        manifest->Complete(manifestName, inputHash);
+    return true;
+}
+
+void CollectGameobjectModels(std::vector<ModelSource>& models)
+{
+    DBCFile dbc("DBFilesClient\\GameObjectDisplayInfo.dbc");
+    if (!dbc.open())
+        return;
+
+    for (DBCFile::Iterator it = dbc.begin(); it != dbc.end(); ++it)
+    {
+        std::string path = it->getString(1);
+        if (path.length() < 4)
+            continue;
+
+        char* name;
+        char* extension;
+        if (!FixGameobjectModelPath(path, name, extension) || !strcmp(extension, ".mdl"))
+            continue;
+
+        models.push_back({ path, !strcmp(extension, ".wmo") });
+    }
 }
 
 void ExtractGameobjectModels()
@@ -89,16 +168,11 @@ void ExtractGameobjectModels()
         if (path.length() < 4)
             continue;
 
-        fixnamen((char*)path.c_str(), path.size());
-        char * name = GetPlainName((char*)path.c_str());
-        fixname2(name, strlen(name));
-
-        char * ch_ext = GetExtension(name);
-        if (!ch_ext)
+        char* name;
+        char* ch_ext;
+        if (!FixGameobjectModelPath(path, name, ch_ext))
             continue;
 
-        strToLower(ch_ext);
-
         bool result = false;
         uint8 isWmo = 0;
         if (!strcmp(ch_ext, ".wmo"))
@@ -20,7 +20,8 @@
 #include <cstdio>
 #include <algorithm>
 
-ArchiveSet gOpenArchives;
+// every extraction thread opens its own handles, libmpq archives can not be read from several threads
+thread_local ArchiveSet gOpenArchives;
 
 MPQArchive::MPQArchive(char const* filename)
 {
@@ -18,8 +18,11 @@
 #include "adtfile.h"
 #include "Banner.h"
 #include "dbcfile.h"
+#include "ExtractorJobs.h"
+#include "ExtractorManifest.h"
 #include "StringFormat.h"
 #include "vmapexport.h"
+#include "VMapDefinitions.h"
 #include "Locales.h"
 #include "Util.h"
 #include "wdtfile.h"
@@ -31,7 +34,10 @@
 #include <iostream>
 #include <list>
 #include <map>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <cstdio>
 #include <cerrno>
@@ -49,7 +55,7 @@
 
 //-----------------------------------------------------------------------------
 
-extern ArchiveSet gOpenArchives;
+extern thread_local ArchiveSet gOpenArchives;
 
 typedef struct
 {
@@ -63,7 +69,9 @@ char output_path[128]=".";
 char input_path[1024]=".";
 bool hasInputPathParam = false;
 bool preciseVectorData = false;
+uint32 threadCount = std::thread::hardware_concurrency();
 std::unordered_map<std::string, WMODoodadData> WmoDoodads;
+std::mutex WmoDoodadsLock;
 
 // Constants
 
@@ -97,7 +105,41 @@ void strToLower(char* str)
     }
 }
 
-bool ExtractSingleWmo(std::string& fname)
+std::string GetWmoOutputName(std::string fname)
+{
+    char* plain_name = GetPlainName(&fname[0]);
+    fixnamen(plain_name, strlen(plain_name));
+    fixname2(plain_name, strlen(plain_name));
+    return plain_name;
+}
+
+std::string GetManifestName(char const* outputName)
+{
+    return Trinity::StringFormat("{}/{}", boost::filesystem::path(szWorkDirWmo).filename().string(), outputName);
+}
+
+// Root and group files of a wmo, these are all its output depends on
+Trinity::ExtractorManifest::Hash HashWmoFiles(std::string const& rootName, uint32 groupCount)
+{
+    Trinity::Crypto::SHA1 sha;
+    auto hashFile = [&](std::string const& fileName)
+    {
+        MPQFile file(fileName.c_str());
+        uint32 size = file.isEof() ? 0 : uint32(file.getSize());
+        sha.UpdateData(reinterpret_cast<uint8 const*>(&size), sizeof(size));
+        if (size)
+            sha.UpdateData(reinterpret_cast<uint8 const*>(file.getBuffer()), size);
+    };
+
+    hashFile(rootName);
+    for (uint32 i = 0; i < groupCount; ++i)
+        hashFile(Trinity::StringFormat("{}_{:03}.wmo", rootName.substr(0, rootName.length() - 4), i));
+
+    sha.Finalize();
+    return sha.GetDigest();
+}
+
+bool ExtractSingleWmo(std::string& fname, Trinity::ExtractorManifest* manifest /*= nullptr*/)
 {
     // Copy files from archive
     std::string originalName = fname;
@@ -108,7 +150,7 @@ bool ExtractSingleWmo(std::string& fname)
     fixname2(plain_name, strlen(plain_name));
     sprintf(szLocalFile, "%s/%s", szWorkDirWmo, plain_name);
 
-    if (FileExists(szLocalFile))
+    if (!manifest && FileExists(szLocalFile))
         return true;
 
     int p = 0;
@@ -130,21 +172,36 @@ bool ExtractSingleWmo(std::string& fname)
         return true;
 
     bool file_ok = true;
-    printf("Extracting %s\n", originalName.c_str());
     WMORoot froot(originalName);
     if (!froot.open())
     {
         printf("Couldn't open RootWmo!!!\n");
+        // a file left by an earlier run would be taken as extracted from this wmo
+        if (manifest)
+            remove(szLocalFile);
         return true;
     }
-    FILE *output = fopen(szLocalFile,"wb");
-    if(!output)
+
+    // an up to date file is not written again, but its doodads are still needed to place them on the maps
+    std::string manifestName = GetManifestName(plain_name);
+    Trinity::ExtractorManifest::Hash inputHash = { };
+    FILE* output = nullptr;
+    if (manifest)
+        inputHash = HashWmoFiles(originalName, froot.nGroups);
+
+    if (!manifest || !manifest->IsUpToDate(manifestName, inputHash))
     {
-        printf("couldn't open %s for writing!\n", szLocalFile);
-        return false;
+        printf("Extracting %s\n", originalName.c_str());
+        output = fopen(szLocalFile, "wb");
+        if (!output)
+        {
+            printf("couldn't open %s for writing!\n", szLocalFile);
+            return false;
+        }
+        froot.ConvertToVMAPRootWmo(output);
     }
-    froot.ConvertToVMAPRootWmo(output);
-    WMODoodadData& doodads = WmoDoodads[plain_name];
+
+    WMODoodadData doodads;
     std::swap(doodads, froot.DoodadData);
     int Wmo_nVertices = 0;
     uint32 groupCount = 0;
@@ -168,7 +225,8 @@ bool ExtractSingleWmo(std::string& fname)
             if (fgroup.ShouldSkip(&froot))
                 continue;
 
-            Wmo_nVertices += fgroup.ConvertToVMAPGroupWmo(output, preciseVectorData);
+            if (output)
+                Wmo_nVertices += fgroup.ConvertToVMAPGroupWmo(output, preciseVectorData);
             ++groupCount;
             for (uint16 groupReference : fgroup.DoodadReferences)
             {
@@ -184,6 +242,14 @@ bool ExtractSingleWmo(std::string& fname)
         }
     }
 
+    {
+        std::lock_guard<std::mutex> lock(WmoDoodadsLock);
+        WmoDoodads[plain_name] = std::move(doodads);
+    }
+
+    if (!output)
+        return true;
+
     fseek(output, 8, SEEK_SET); // store the correct no of vertices
     fwrite(&Wmo_nVertices,sizeof(int),1,output);
     // store the correct no of groups
@@ -193,9 +259,133 @@ bool ExtractSingleWmo(std::string& fname)
     // Delete the extracted file in the case of an error
     if (!file_ok)
         remove(szLocalFile);
+    else if (manifest)
+        manifest->Complete(manifestName, inputHash);
     return true;
 }
 
+// Model paths in the MMDX and MWMO chunks of a wdt or adt file, as ParsMapFiles passes them to the extraction
+void CollectModelSources(char const* fileName, bool isWdt, std::vector<ModelSource>& models)
+{
+    MPQFile file(fileName);
+    while (!file.isEof())
+    {
+        char fourcc[5];
+        uint32 size;
+        file.read(fourcc, 4);
+        file.read(&size, 4);
+        flipcc(fourcc);
+        fourcc[4] = 0;
+
+        size_t nextpos = file.getPos() + size;
+
+        bool isWmo = !strcmp(fourcc, "MWMO");
+        // wdt files only place wmos
+        if (size && (isWmo || (!isWdt && !strcmp(fourcc, "MMDX"))))
+        {
+            std::vector<char> buf(size);
+            file.read(buf.data(), size);
+            char* p = buf.data();
+            while (p < buf.data() + size)
+            {
+                if (isWmo)
+                    models.push_back({ p, true });
+                else
+                {
+                    fixnamen(p, strlen(p));
+                    char* s = GetPlainName(p);
+                    fixname2(s, strlen(s));
+                    models.push_back({ p, false });
+                }
+
+                p += strlen(p) + 1;
+            }
+        }
+
+        file.seek(int(nextpos));
+    }
+}
+
+void OpenArchives(std::vector<std::string> const& archiveNames)
+{
+    for (size_t i = 0; i < archiveNames.size(); ++i)
+    {
+        MPQArchive *archive = new MPQArchive(archiveNames[i].c_str());
+        if (gOpenArchives.empty() || gOpenArchives.front() != archive)
+            delete archive;
+    }
+}
+
+void CloseArchives()
+{
+    for (MPQArchive* archive : gOpenArchives)
+        delete archive;
+
+    gOpenArchives.clear();
+}
+
+/*
+ * Converts every model the maps and gameobjects use on all threads. ParsMapFiles and ExtractGameobjectModels
+ * then find them extracted already and only write the placements, in their original order, so the output
+ * is the same as extracting everything in that order.
+ * Of models extracted to the same file only the first one is converted here, the same one the sequential
+ * order would have kept. If it can not be converted the later ones are tried again by the sequential pass.
+ */
+void ExtractModels(std::vector<std::string> const& archiveNames, Trinity::ExtractorManifest& manifest)
+{
+    struct ScanJob
+    {
+        uint32 MapIndex;
+        int32 X;                                            // -1 for the wdt
+    };
+
+    std::vector<ScanJob> scanJobs;
+    for (unsigned int i = 0; i < map_count; ++i)
+    {
+        MPQFile wdt(Trinity::StringFormat("World\\Maps\\{}\\{}.wdt", map_ids[i].name, map_ids[i].name).c_str());
+        if (wdt.isEof())
+            continue;
+
+        for (int32 x = -1; x < 64; ++x)
+            scanJobs.push_back({ i, x });
+    }
+
+    printf("Collecting models of %u maps...\n", uint32(scanJobs.size() / 65));
+    std::vector<std::vector<ModelSource>> scanned(scanJobs.size() + 1);
+    Trinity::RunExtractorJobs(scanJobs.size(), threadCount, [&]() { OpenArchives(archiveNames); }, [&](std::size_t index)
+    {
+        ScanJob const& job = scanJobs[index];
+        char const* name = map_ids[job.MapIndex].name;
+        if (job.X < 0)
+        {
+            CollectModelSources(Trinity::StringFormat("World\\Maps\\{}\\{}.wdt", name, name).c_str(), true, scanned[index]);
+            return;
+        }
+
+        for (int32 y = 0; y < 64; ++y)
+            CollectModelSources(Trinity::StringFormat("World\\Maps\\{}\\{}_{}_{}.adt", name, name, job.X, y).c_str(), false, scanned[index]);
+    }, &CloseArchives);
+
+    CollectGameobjectModels(scanned.back());
+
+    std::vector<ModelSource> models;
+    std::unordered_set<std::string> outputNames;
+    for (std::vector<ModelSource>& sources : scanned)
+        for (ModelSource& source : sources)
+            if (outputNames.insert(source.IsWmo ? GetWmoOutputName(source.Path) : GetModelOutputName(source.Path)).second)
+                models.push_back(std::move(source));
+
+    printf("Extracting %u models using %u threads\n", uint32(models.size()), threadCount);
+    Trinity::RunExtractorJobs(models.size(), threadCount, [&]() { OpenArchives(archiveNames); }, [&](std::size_t index)
+    {
+        std::string path = models[index].Path;
+        if (models[index].IsWmo)
+            ExtractSingleWmo(path, &manifest);
+        else
+            ExtractSingleModel(path, &manifest);
+    }, &CloseArchives);
+}
+
 void ParsMapFiles()
 {
     char fn[512];
@@ -380,6 +570,13 @@ bool processArgv(int argc, char ** argv, const char *versionString)
         {
             preciseVectorData = true;
         }
+        else if(strcmp("-t",argv[i]) == 0)
+        {
+            if((i+1)<argc)
+                threadCount = std::max(atoi(argv[++i]), 1);
+            else
+                result = false;
+        }
         else
         {
             result = false;
@@ -389,10 +586,11 @@ bool processArgv(int argc, char ** argv, const char *versionString)
     if(!result)
     {
         printf("Extract %s.\n",versionString);
-        printf("%s [-?][-s][-l][-d <path>]\n", argv[0]);
+        printf("%s [-?][-s][-l][-d <path>][-t <threads>]\n", argv[0]);
         printf("   -s : (default) small size (data size optimization), ~500MB less vmap data.\n");
         printf("   -l : large size, ~500MB more vmap data. (might contain more details)\n");
         printf("   -d <path>: Path to the vector data source folder.\n");
+        printf("   -t <threads>: Number of threads extracting models, default %u.\n", threadCount);
         printf("   -? : This message.\n");
     }
     return result;
@@ -422,7 +620,15 @@ int main(int argc, char ** argv)
     if (!processArgv(argc, argv, versionString))
         return 1;
 
-    // some simple check if working dir is dirty
+    // some simple check if working dir is dirty, unless it was left by a run that recorded its models
+    std::string manifestPath = std::string(szWorkDirWmo) + ".manifest";
+    if (boost::filesystem::exists(manifestPath))
+    {
+        // placements are always written again
+        printf("Resuming extraction recorded in %s\n", manifestPath.c_str());
+        boost::filesystem::remove(std::string(szWorkDirWmo) + "/dir_bin");
+        boost::filesystem::remove(std::string(szWorkDirWmo) + "/temp_gameobject_models");
+    }
     else
     {
         std::string sdir = std::string(szWorkDirWmo) + "/dir";
@@ -450,12 +656,7 @@ int main(int argc, char ** argv)
     // prepare archive name list
     std::vector<std::string> archiveNames;
     fillArchiveNameVector(archiveNames);
-    for (size_t i = 0; i < archiveNames.size(); ++i)
-    {
-        MPQArchive *archive = new MPQArchive(archiveNames[i].c_str());
-        if (gOpenArchives.empty() || gOpenArchives.front() != archive)
-            delete archive;
-    }
+    OpenArchives(archiveNames);
 
     if (gOpenArchives.empty())
     {
@@ -495,6 +696,16 @@ int main(int argc, char ** argv)
         }
 
         delete dbc;
+
+        Trinity::Crypto::SHA1 settings;
+        settings.UpdateData(Trinity::StringFormat("{} {} {}", versionString, VMAP::RAW_VMAP_MAGIC, preciseVectorData));
+        settings.Finalize();
+
+        Trinity::ExtractorManifest manifest;
+        if (std::size_t previousModels = manifest.Open(manifestPath, settings.GetDigest()))
+            printf("Found %u models extracted by a previous run\n", uint32(previousModels));
+
+        ExtractModels(archiveNames, manifest);
         ParsMapFiles();
         //nError = ERROR_SUCCESS;
         // Extract models, listed in DameObjectDisplayInfo.dbc
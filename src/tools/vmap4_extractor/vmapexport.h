@@ -21,6 +21,12 @@
 #include "Define.h"
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+namespace Trinity
+{
+    class ExtractorManifest;
+}
 
 enum ModelFlags
 {
@@ -31,6 +37,13 @@ enum ModelFlags
 
 struct WMODoodadData;
 
+// Model file referenced by map or gameobject data, with its path exactly as passed to ExtractSingleWmo or ExtractSingleModel
+struct ModelSource
+{
+    std::string Path;
+    bool IsWmo;
+};
+
 extern const char * szWorkDirWmo;
 extern std::unordered_map<std::string, WMODoodadData> WmoDoodads;
 
@@ -39,9 +52,16 @@ uint32 GenerateUniqueObjectId(uint32 clientId, uint16 clientDoodadId);
 bool FileExists(const char * file);
 void strToLower(char* str);
 
-bool ExtractSingleWmo(std::string& fname);
-bool ExtractSingleModel(std::string& fname);
+// With a manifest files are converted again unless it records them as up to date, without one existing files are kept
+bool ExtractSingleWmo(std::string& fname, Trinity::ExtractorManifest* manifest = nullptr);
+bool ExtractSingleModel(std::string& fname, Trinity::ExtractorManifest* manifest = nullptr);
+
+// Name of the file the model is extracted to
+std::string GetWmoOutputName(std::string fname);
+std::string GetModelOutputName(std::string fname);
+std::string GetManifestName(char const* outputName);
 
+void CollectGameobjectModels(std::vector<ModelSource>& models);
 void ExtractGameobjectModels();
 
 #endif
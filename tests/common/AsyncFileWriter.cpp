@@ -0,0 +1,124 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "AsyncFileWriter.h"
+#include "StringFormat.h"
+#include <map>
+#include <sstream>
+
+namespace
+{
+    // Lines per thread in the order the sink received them
+    std::map<uint32, std::vector<uint32>> ParseLines(std::string const& output)
+    {
+        std::map<uint32, std::vector<uint32>> lines;
+        std::istringstream stream(output);
+        uint32 thread, line;
+        while (stream >> thread >> line)
+            lines[thread].push_back(line);
+
+        return lines;
+    }
+}
+
+TEST_CASE("Lines reach the sink in order", "[AsyncFileWriter]")
+{
+    std::string output;
+    uint32 batches = 0;
+    {
+        AsyncFileWriter writer(64, AsyncLogFullPolicy::Block, [&](std::string_view batch)
+        {
+            REQUIRE(batch.size() <= AsyncFileWriter::MaxBatchSize);
+            output.append(batch);
+            ++batches;
+        });
+
+        std::vector<std::thread> threads;
+        for (uint32 thread = 0; thread < 4; ++thread)
+        {
+            threads.emplace_back([&writer, thread]()
+            {
+                for (uint32 line = 0; line < 10000; ++line)
+                    writer.Write(Trinity::StringFormat("{} {}\n", thread, line));
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        writer.Flush();
+        REQUIRE(writer.GetDroppedLines() == 0);
+    }
+
+    std::map<uint32, std::vector<uint32>> lines = ParseLines(output);
+    REQUIRE(lines.size() == 4);
+    for (auto const& [thread, threadLines] : lines)
+    {
+        REQUIRE(threadLines.size() == 10000);
+        for (uint32 line = 0; line < threadLines.size(); ++line)
+            REQUIRE(threadLines[line] == line);
+    }
+
+    // lines are grouped, not written one by one
+    REQUIRE(batches < 40000);
+}
+
+TEST_CASE("Full queue drops and reports", "[AsyncFileWriter]")
+{
+    std::mutex sinkLock;
+    std::unique_lock<std::mutex> blockSink(sinkLock);
+    std::string output;
+
+    AsyncFileWriter writer(4, AsyncLogFullPolicy::Drop, [&](std::string_view batch)
+    {
+        std::lock_guard<std::mutex> lock(sinkLock);
+        output.append(batch);
+    });
+
+    // the sink is blocked, at most one drained ring worth of lines plus the ring itself fit
+    for (uint32 line = 0; line < 100; ++line)
+        writer.Write(Trinity::StringFormat("0 {}\n", line));
+
+    REQUIRE(writer.GetDroppedLines() > 0);
+
+    blockSink.unlock();
+    writer.Flush();
+
+    // drops are reported with the batch following them, possibly split over several batches
+    uint64 reported = 0;
+    std::string_view const report = "AsyncFileWriter: ";
+    for (std::size_t pos = output.find(report); pos != std::string::npos; pos = output.find(report, pos + 1))
+        reported += std::stoull(output.substr(pos + report.size()));
+
+    REQUIRE(reported == writer.GetDroppedLines());
+}
+
+TEST_CASE("Flush waits for written lines", "[AsyncFileWriter]")
+{
+    std::string output;
+    AsyncFileWriter writer(16, AsyncLogFullPolicy::Block, [&](std::string_view batch) { output.append(batch); });
+
+    writer.Write("first\n");
+    writer.Flush();
+    REQUIRE(output == "first\n");
+
+    writer.Write("second\n");
+    writer.Flush();
+    REQUIRE(output == "first\nsecond\n");
+}
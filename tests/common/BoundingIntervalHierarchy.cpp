@@ -0,0 +1,185 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "BoundingIntervalHierarchy.h"
+#include "WorldModel.h"
+#include <random>
+
+namespace
+{
+    struct Sphere
+    {
+        G3D::Vector3 Center;
+        float Radius;
+    };
+
+    struct SphereBounds
+    {
+        void operator()(Sphere const& sphere, G3D::AABox& out) const
+        {
+            G3D::Vector3 extent(sphere.Radius, sphere.Radius, sphere.Radius);
+            out = G3D::AABox(sphere.Center - extent, sphere.Center + extent);
+        }
+    };
+
+    struct SphereRayCallback
+    {
+        explicit SphereRayCallback(std::vector<Sphere> const& spheres) : Spheres(&spheres) { }
+
+        bool operator()(G3D::Ray const& ray, uint32 entry, float& distance, bool /*stopAtFirst*/)
+        {
+            Sphere const& sphere = (*Spheres)[entry];
+            G3D::Vector3 toCenter = sphere.Center - ray.origin();
+            float along = toCenter.dot(ray.direction());
+            float squaredMiss = toCenter.squaredLength() - along * along;
+            if (squaredMiss > sphere.Radius * sphere.Radius)
+                return false;
+
+            float t = along - std::sqrt(sphere.Radius * sphere.Radius - squaredMiss);
+            if (t <= 0.0f || t >= distance)
+                return false;
+
+            distance = t;
+            Hit = true;
+            return true;
+        }
+
+        std::vector<Sphere> const* Spheres;
+        bool Hit = false;
+    };
+
+    G3D::Vector3 RandomPoint(std::mt19937& random, float extent)
+    {
+        std::uniform_real_distribution<float> coord(-extent, extent);
+        return G3D::Vector3(coord(random), coord(random), coord(random));
+    }
+}
+
+TEST_CASE("Ray packets find the same hits as single rays", "[BIH]")
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> radius(0.5f, 3.0f);
+    std::vector<Sphere> spheres;
+    for (uint32 i = 0; i < 500; ++i)
+        spheres.push_back({ RandomPoint(random, 100.0f), radius(random) });
+
+    SphereBounds bounds;
+    BIH tree;
+    tree.build(spheres, bounds);
+
+    for (bool stopAtFirst : { false, true })
+    {
+        for (uint32 packet = 0; packet < 500; ++packet)
+        {
+            uint32 count = packet % BIH::RayPacketSize + 1;
+            G3D::Ray rays[BIH::RayPacketSize];
+            float maxDistance[BIH::RayPacketSize];
+            for (uint32 lane = 0; lane < count; ++lane)
+            {
+                G3D::Vector3 from = RandomPoint(random, 120.0f);
+                G3D::Vector3 to = RandomPoint(random, 120.0f);
+                // some rays are axis aligned
+                if (lane == 1)
+                    to.z = from.z;
+                rays[lane] = G3D::Ray::fromOriginAndDirection(from, (to - from).direction());
+                maxDistance[lane] = (to - from).magnitude();
+            }
+
+            float packetDistance[BIH::RayPacketSize];
+            std::copy(std::begin(maxDistance), std::end(maxDistance), std::begin(packetDistance));
+            std::vector<SphereRayCallback> packetCallbacks(BIH::RayPacketSize, SphereRayCallback(spheres));
+            tree.intersectRayPacket(rays, packetCallbacks.data(), packetDistance, count, stopAtFirst);
+
+            for (uint32 lane = 0; lane < count; ++lane)
+            {
+                SphereRayCallback callback(spheres);
+                float distance = maxDistance[lane];
+                tree.intersectRay(rays[lane], callback, distance, stopAtFirst);
+                REQUIRE(packetCallbacks[lane].Hit == callback.Hit);
+                // the first hit found depends on the traversal order
+                if (!stopAtFirst)
+                    REQUIRE(packetDistance[lane] == distance);
+            }
+        }
+    }
+}
+
+TEST_CASE("Leaf batches find the closest triangle", "[BIH]")
+{
+    std::mt19937 random(7);
+    std::vector<G3D::Vector3> vertices;
+    std::vector<VMAP::MeshTriangle> triangles;
+    for (uint32 i = 0; i < 300; ++i)
+    {
+        G3D::Vector3 corner = RandomPoint(random, 50.0f);
+        uint32 first = uint32(vertices.size());
+        vertices.push_back(corner);
+        vertices.push_back(corner + RandomPoint(random, 4.0f));
+        vertices.push_back(corner + RandomPoint(random, 4.0f));
+        triangles.emplace_back(first, first + 1, first + 2);
+    }
+
+    std::vector<G3D::Vector3> meshVertices = vertices;
+    std::vector<VMAP::MeshTriangle> meshTriangles = triangles;
+    VMAP::GroupModel model(0, 0, G3D::AABox(G3D::Vector3(-60.0f, -60.0f, -60.0f), G3D::Vector3(60.0f, 60.0f, 60.0f)));
+    model.setMeshData(meshVertices, meshTriangles);
+
+    uint32 hits = 0;
+    for (uint32 i = 0; i < 2000; ++i)
+    {
+        G3D::Vector3 from = RandomPoint(random, 70.0f);
+        G3D::Ray ray = G3D::Ray::fromOriginAndDirection(from, (RandomPoint(random, 30.0f) - from).direction());
+
+        // every triangle tested on its own
+        float expected = 200.0f;
+        for (VMAP::MeshTriangle const& tri : triangles)
+        {
+            G3D::Vector3 const e1 = vertices[tri.idx1] - vertices[tri.idx0];
+            G3D::Vector3 const e2 = vertices[tri.idx2] - vertices[tri.idx0];
+            G3D::Vector3 const p(ray.direction().cross(e2));
+            float const a = e1.dot(p);
+            if (std::fabs(a) < 1e-5f)
+                continue;
+
+            float const f = 1.0f / a;
+            G3D::Vector3 const s(ray.origin() - vertices[tri.idx0]);
+            float const u = f * s.dot(p);
+            if (u < 0.0f || u > 1.0f)
+                continue;
+
+            G3D::Vector3 const q(s.cross(e1));
+            float const v = f * ray.direction().dot(q);
+            if (v < 0.0f || u + v > 1.0f)
+                continue;
+
+            float const t = f * e2.dot(q);
+            if (t > 0.0f && t < expected)
+                expected = t;
+        }
+
+        float distance = 200.0f;
+        bool hit = model.IntersectRay(ray, distance, false);
+        REQUIRE(hit == (expected < 200.0f));
+        REQUIRE(distance == Approx(expected).epsilon(1e-5));
+        if (hit)
+            ++hits;
+    }
+
+    REQUIRE(hits > 0);
+}
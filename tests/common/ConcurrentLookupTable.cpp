@@ -0,0 +1,139 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ConcurrentLookupTable.h"
+#include <chrono>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+
+TEST_CASE("Insert and find", "[ConcurrentLookupTable]")
+{
+    Trinity::Containers::ConcurrentLookupTable<int> table;
+    int values[3] = { 1, 2, 3 };
+
+    REQUIRE(table.Find(1) == nullptr);
+
+    table.Insert(1, &values[0]);
+    table.Insert(2, &values[1]);
+    REQUIRE(table.Find(1) == &values[0]);
+    REQUIRE(table.Find(2) == &values[1]);
+    REQUIRE(table.Size() == 2);
+
+    table.Insert(1, &values[2]);
+    REQUIRE(table.Find(1) == &values[2]);
+    REQUIRE(table.Size() == 2);
+}
+
+TEST_CASE("Remove", "[ConcurrentLookupTable]")
+{
+    Trinity::Containers::ConcurrentLookupTable<int> table;
+    int values[2] = { 1, 2 };
+
+    table.Insert(1, &values[0]);
+    REQUIRE(table.Remove(1) == true);
+    REQUIRE(table.Remove(1) == false);
+    REQUIRE(table.Find(1) == nullptr);
+    REQUIRE(table.Size() == 0);
+
+    table.Insert(1, &values[1]);
+    REQUIRE(table.Find(1) == &values[1]);
+}
+
+TEST_CASE("Duplicate keys", "[ConcurrentLookupTable]")
+{
+    Trinity::Containers::ConcurrentLookupTable<int> table;
+    int values[2] = { 1, 2 };
+
+    table.Add(5, &values[0]);
+    table.Add(5, &values[1]);
+    REQUIRE(table.Find(5, [](int const* value) { return *value == 2; }) == &values[1]);
+
+    REQUIRE(table.Remove(5, &values[0]) == true);
+    REQUIRE(table.Find(5) == &values[1]);
+    REQUIRE(table.Find(5, [](int const* value) { return *value == 1; }) == nullptr);
+}
+
+TEST_CASE("Rehash keeps entries", "[ConcurrentLookupTable]")
+{
+    Trinity::Containers::ConcurrentLookupTable<int> table;
+    std::vector<int> values(10000);
+
+    for (uint64 i = 1; i < values.size(); ++i)
+        table.Insert(i, &values[i]);
+
+    for (uint64 i = 1; i < values.size(); i += 2)
+        table.Remove(i);
+
+    for (uint64 i = 1; i < values.size(); ++i)
+        REQUIRE(table.Find(i) == (i % 2 ? nullptr : &values[i]));
+
+    REQUIRE(table.Size() == values.size() / 2 - 1 + values.size() % 2);
+}
+
+TEST_CASE("Lookup contention", "[ConcurrentLookupTable][.benchmark]")
+{
+    constexpr uint32 Threads = 16;
+    constexpr uint64 Entries = 5000;
+    constexpr uint32 LookupsPerThread = 2000000;
+
+    std::vector<int> values(Entries);
+    Trinity::Containers::ConcurrentLookupTable<int> table;
+    std::unordered_map<uint64, int*> map;
+    std::shared_mutex lock;
+    for (uint64 i = 0; i < Entries; ++i)
+    {
+        table.Insert(i + 1, &values[i]);
+        map[i + 1] = &values[i];
+    }
+
+    auto run = [&](auto&& lookup)
+    {
+        std::vector<std::thread> threads;
+        std::atomic<uint64> found = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 t = 0; t < Threads; ++t)
+        {
+            threads.emplace_back([&, t]()
+            {
+                uint64 threadFound = 0;
+                for (uint32 i = 0; i < LookupsPerThread; ++i)
+                    threadFound += lookup((i * 7 + t) % Entries + 1) != nullptr;
+
+                found += threadFound;
+            });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        REQUIRE(found == uint64(Threads) * LookupsPerThread);
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    };
+
+    auto lockFree = run([&](uint64 key) { return table.Find(key); });
+    auto locked = run([&](uint64 key)
+    {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        auto itr = map.find(key);
+        return itr != map.end() ? itr->second : nullptr;
+    });
+
+    WARN(Threads << " threads x " << LookupsPerThread << " lookups: ConcurrentLookupTable " << lockFree.count() << " ms, shared_mutex + unordered_map " << locked.count() << " ms");
+}
@@ -0,0 +1,126 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "DBCFileLoader.h"
+#include "MappedFile.h"
+#include <boost/filesystem/operations.hpp>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    struct TestEntry
+    {
+        uint32 ID;
+        int32 Value;
+        float Scale;
+    };
+
+    // Writes a WDBC file with records { id, id * 10, id / 2 } for the given ids and an empty string table
+    std::string WriteTestFile(std::vector<uint32> const& ids)
+    {
+        std::string fileName = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%%%%%.dbc")).string();
+        std::ofstream file(fileName, std::ios::binary);
+
+        auto write = [&](auto value) { file.write(reinterpret_cast<char const*>(&value), sizeof(value)); };
+        write(uint32(0x43424457));                  // 'WDBC'
+        write(uint32(ids.size()));
+        write(uint32(3));                           // fields
+        write(uint32(sizeof(TestEntry)));
+        write(uint32(1));                           // string table size
+        for (uint32 id : ids)
+        {
+            write(id);
+            write(int32(id * 10));
+            write(float(id) / 2.0f);
+        }
+
+        write(uint8(0));
+        return fileName;
+    }
+}
+
+TEST_CASE("Layout identical records are used in place", "[DBCFileLoader]")
+{
+    std::string fileName = WriteTestFile({ 1, 3, 7 });
+
+    DBCFileLoader loader;
+    REQUIRE(loader.LoadMapped(fileName.c_str(), "nif"));
+
+    uint32 count = 0;
+    char** indexTable = loader.ProduceInPlaceIndex("nif", alignof(TestEntry), count);
+    REQUIRE(indexTable);
+    REQUIRE(count == 8);
+
+    std::unique_ptr<Trinity::MappedFile> mapping = loader.ReleaseMapping();
+    REQUIRE(mapping);
+    unsigned char const* begin = mapping->GetData();
+    unsigned char const* end = begin + mapping->GetSize();
+
+    for (uint32 id = 0; id < count; ++id)
+    {
+        TestEntry const* entry = reinterpret_cast<TestEntry const*>(indexTable[id]);
+        if (id != 1 && id != 3 && id != 7)
+        {
+            REQUIRE(!entry);
+            continue;
+        }
+
+        REQUIRE(entry);
+        REQUIRE(reinterpret_cast<unsigned char const*>(entry) >= begin);
+        REQUIRE(reinterpret_cast<unsigned char const*>(entry + 1) <= end);
+        REQUIRE(entry->ID == id);
+        REQUIRE(entry->Value == int32(id * 10));
+        REQUIRE(entry->Scale == float(id) / 2.0f);
+    }
+
+    delete[] indexTable;
+    mapping.reset();
+    boost::filesystem::remove(fileName);
+}
+
+TEST_CASE("Records needing conversion are not used in place", "[DBCFileLoader]")
+{
+    REQUIRE(DBCFileLoader::IsInPlaceFormat("nif"));
+    REQUIRE(!DBCFileLoader::IsInPlaceFormat("nis"));
+    REQUIRE(!DBCFileLoader::IsInPlaceFormat("nxf"));
+    REQUIRE(!DBCFileLoader::IsInPlaceFormat("dif"));
+
+    std::string fileName = WriteTestFile({ 2, 4 });
+
+    {
+        DBCFileLoader loader;
+        REQUIRE(loader.LoadMapped(fileName.c_str(), "nxf"));
+
+        uint32 count = 0;
+        REQUIRE(!loader.ProduceInPlaceIndex("nxf", alignof(TestEntry), count));
+
+        // the regular conversion still works on mapped data
+        char** indexTable = nullptr;
+        char* data = loader.AutoProduceData("nxf", count, indexTable);
+        REQUIRE(data);
+        REQUIRE(count == 5);
+        REQUIRE(indexTable[4]);
+        REQUIRE(*reinterpret_cast<uint32 const*>(indexTable[4]) == 4);
+        delete[] indexTable;
+        delete[] data;
+    }
+
+    boost::filesystem::remove(fileName);
+}
@@ -19,6 +19,10 @@
 #include "tc_catch2.h"
 
 #include "EventMap.h"
+#include "Random.h"
+#include <chrono>
+#include <map>
+#include <vector>
 
 enum EVENTS
 {
@@ -384,3 +388,192 @@ TEST_CASE("Reset map", "[EventMap]")
 
     REQUIRE(eventMap.Empty());
 }
+
+TEST_CASE("Events with equal times keep their order", "[EventMap]")
+{
+    EventMap eventMap;
+    eventMap.ScheduleEvent(EVENT_2, 1s);
+    eventMap.ScheduleEvent(EVENT_1, 1s);
+    eventMap.ScheduleEvent(EVENT_3, 500ms);
+
+    eventMap.Update(5000);
+
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_3);
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_1);
+    REQUIRE(eventMap.ExecuteEvent() == 0);
+}
+
+TEST_CASE("Delayed group events move behind events with equal times", "[EventMap]")
+{
+    EventMap eventMap;
+    eventMap.ScheduleEvent(EVENT_1, 1s, GROUP_1);
+    eventMap.ScheduleEvent(EVENT_2, 1s);
+    eventMap.DelayEvents(0s, GROUP_1);
+    eventMap.Update(1000);
+
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_1);
+    REQUIRE(eventMap.ExecuteEvent() == 0);
+}
+
+TEST_CASE("Event scheduled during execution", "[EventMap]")
+{
+    EventMap eventMap;
+    eventMap.ScheduleEvent(EVENT_1, 1s);
+    eventMap.ScheduleEvent(EVENT_2, 2s);
+    eventMap.Update(3000);
+
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_1);
+    eventMap.ScheduleEvent(EVENT_3, 0s);
+    eventMap.Repeat(500ms);
+
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_2);
+    REQUIRE(eventMap.ExecuteEvent() == EVENT_3);
+    REQUIRE(eventMap.ExecuteEvent() == 0);
+    REQUIRE(eventMap.GetTimeUntilEvent(EVENT_1) == 500ms);
+}
+
+TEST_CASE("Events far in the future", "[EventMap]")
+{
+    EventMap eventMap;
+    eventMap.ScheduleEvent(EVENT_1, 24h);
+    eventMap.ScheduleEvent(EVENT_2, 5h);
+    eventMap.ScheduleEvent(EVENT_3, 90s);
+
+    REQUIRE(eventMap.GetTimeUntilEvent(EVENT_1) == 24h);
+
+    uint32 executed = 0;
+    std::vector<uint32> order;
+    Milliseconds elapsed = 0ms;
+    while (elapsed < 25h)
+    {
+        eventMap.Update(1min);
+        elapsed += 1min;
+        while (uint32 eventId = eventMap.ExecuteEvent())
+        {
+            order.push_back(eventId);
+            ++executed;
+            if (eventId == EVENT_2)
+                REQUIRE(elapsed == 5h);
+            if (eventId == EVENT_1)
+                REQUIRE(elapsed == 24h);
+        }
+    }
+
+    REQUIRE(executed == 3);
+    REQUIRE(order == std::vector<uint32>{ EVENT_3, EVENT_2, EVENT_1 });
+    REQUIRE(eventMap.Empty());
+}
+
+TEST_CASE("Copied map keeps its events", "[EventMap]")
+{
+    EventMap eventMap;
+    eventMap.ScheduleEvent(EVENT_1, 1s);
+    eventMap.ScheduleEvent(EVENT_2, 2s);
+
+    EventMap copy = eventMap;
+    copy.CancelEvent(EVENT_1);
+    copy.Update(2000);
+
+    REQUIRE(copy.ExecuteEvent() == EVENT_2);
+    REQUIRE(eventMap.GetTimeUntilEvent(EVENT_1) == 1s);
+    REQUIRE(eventMap.GetTimeUntilEvent(EVENT_2) == 2s);
+}
+
+TEST_CASE("Matches a sorted reference", "[EventMap]")
+{
+    EventMap eventMap;
+    std::multimap<Milliseconds, uint32> reference;
+    Milliseconds now = 0ms;
+
+    for (uint32 step = 0; step < 2000; ++step)
+    {
+        uint32 eventId = urand(1, 50);
+        Milliseconds time = Milliseconds(urand(0, 200000));
+        eventMap.ScheduleEvent(eventId, time);
+        reference.emplace(now + time, eventId);
+
+        Milliseconds diff = Milliseconds(urand(0, 300));
+        eventMap.Update(diff);
+        now += diff;
+
+        while (uint32 executed = eventMap.ExecuteEvent())
+        {
+            REQUIRE(!reference.empty());
+            REQUIRE(reference.begin()->first <= now);
+            REQUIRE(reference.begin()->second == executed);
+            reference.erase(reference.begin());
+        }
+
+        REQUIRE((reference.empty() || reference.begin()->first > now));
+    }
+}
+
+TEST_CASE("Cancelling keeps the other events in order", "[EventMap]")
+{
+    EventMap eventMap;
+    std::multimap<Milliseconds, uint32> reference;
+    Milliseconds now = 0ms;
+
+    for (uint32 round = 0; round < 3; ++round)
+    {
+        for (uint32 i = 0; i < 500; ++i)
+        {
+            uint32 eventId = urand(1, 50);
+            Milliseconds time = Milliseconds(urand(0, 100000000));
+            eventMap.ScheduleEvent(eventId, time);
+            reference.emplace(now + time, eventId);
+        }
+
+        for (uint32 eventId = 1; eventId <= 50; eventId += urand(1, 4))
+        {
+            eventMap.CancelEvent(eventId);
+            std::erase_if(reference, [eventId](std::pair<Milliseconds const, uint32> const& entry) { return entry.second == eventId; });
+        }
+
+        for (uint32 step = 0; step < 200; ++step)
+        {
+            Milliseconds diff = Milliseconds(urand(0, 100000));
+            eventMap.Update(diff);
+            now += diff;
+
+            while (uint32 executed = eventMap.ExecuteEvent())
+            {
+                REQUIRE(!reference.empty());
+                REQUIRE(reference.begin()->second == executed);
+                reference.erase(reference.begin());
+            }
+        }
+
+        // an emptied map gives its memory back and must work the same when reused
+        for (uint32 eventId = 1; eventId <= 50; ++eventId)
+            eventMap.CancelEvent(eventId);
+
+        reference.clear();
+        REQUIRE(eventMap.Empty());
+    }
+}
+
+TEST_CASE("100k timers", "[EventMap][.benchmark]")
+{
+    EventMap eventMap;
+    for (uint32 i = 0; i < 100000; ++i)
+        eventMap.ScheduleEvent(uint16(urand(1, 1000)), Milliseconds(urand(0, 60000)));
+
+    uint32 executed = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (!eventMap.Empty())
+    {
+        eventMap.Update(50);
+        while (eventMap.ExecuteEvent())
+        {
+            ++executed;
+            if (executed <= 300000)
+                eventMap.Repeat(Milliseconds(urand(0, 60000)));
+        }
+    }
+
+    REQUIRE(executed == 400000);
+    WARN("400k executions of 100k timers: " << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() << " ms");
+}
@@ -0,0 +1,74 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "LineOfSightCache.h"
+#include <limits>
+
+using VMAP::LineOfSightCache;
+
+TEST_CASE("Nearby rays share an entry", "[LineOfSightCache]")
+{
+    LineOfSightCache cache(64);
+
+    LineOfSightCache::Key key;
+    REQUIRE(LineOfSightCache::MakeKey(10.01f, 20.01f, 5.01f, 30.01f, 40.01f, 6.01f, 1, key));
+    REQUIRE(!cache.Find(key, 1));
+
+    cache.Store(key, 1, false);
+
+    LineOfSightCache::Key nearby;
+    REQUIRE(LineOfSightCache::MakeKey(10.1f, 20.1f, 5.1f, 30.1f, 40.1f, 6.1f, 1, nearby));
+    REQUIRE(cache.Find(nearby, 1) == false);
+
+    LineOfSightCache::Key farther;
+    REQUIRE(LineOfSightCache::MakeKey(10.5f, 20.1f, 5.1f, 30.1f, 40.1f, 6.1f, 1, farther));
+    REQUIRE(!cache.Find(farther, 1));
+}
+
+TEST_CASE("Entries of other generations and filters miss", "[LineOfSightCache]")
+{
+    LineOfSightCache cache(64);
+
+    LineOfSightCache::Key key;
+    REQUIRE(LineOfSightCache::MakeKey(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 1, key));
+    cache.Store(key, 7, true);
+    REQUIRE(cache.Find(key, 7) == true);
+    REQUIRE(!cache.Find(key, 8));
+
+    LineOfSightCache::Key otherPhase;
+    REQUIRE(LineOfSightCache::MakeKey(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 2, otherPhase));
+    REQUIRE(!cache.Find(otherPhase, 7));
+
+    cache.Clear();
+    REQUIRE(!cache.Find(key, 7));
+}
+
+TEST_CASE("Disabled cache and invalid coordinates", "[LineOfSightCache]")
+{
+    LineOfSightCache disabled(0);
+    REQUIRE(!disabled.IsEnabled());
+
+    LineOfSightCache::Key key;
+    REQUIRE(LineOfSightCache::MakeKey(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 1, key));
+    disabled.Store(key, 1, true);
+    REQUIRE(!disabled.Find(key, 1));
+
+    REQUIRE(!LineOfSightCache::MakeKey(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1, key));
+    REQUIRE(!LineOfSightCache::MakeKey(1e30f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1, key));
+}
@@ -0,0 +1,235 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "BoundedThreadPool.h"
+#include "CryptoRandom.h"
+#include "SRP6.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <unordered_map>
+
+using SHA1 = Trinity::Crypto::SHA1;
+using SRP6 = Trinity::Crypto::SRP6;
+
+namespace
+{
+// Client side of the SRP6 exchange, the inverse of what authserver does
+struct SRP6Client
+{
+    SRP6Client(std::string const& username, std::string const& password) : Username(username), Password(password), _a(Trinity::Crypto::GetRandomBytes<19>())
+    {
+        A = BigNumber(SRP6::g).ModExp(_a, BigNumber(SRP6::N)).ToByteArray<SRP6::EPHEMERAL_KEY_LENGTH>();
+    }
+
+    SHA1::Digest CalculateProof(SRP6::Salt const& s, SRP6::EphemeralKey const& B)
+    {
+        BigNumber const N(SRP6::N);
+        BigNumber const x(SHA1::GetDigestOf(s, SHA1::GetDigestOf(Username, ":", Password)));
+        BigNumber const u(SHA1::GetDigestOf(A, B));
+        BigNumber const v = BigNumber(SRP6::g).ModExp(x, N);
+
+        // S = (B - 3v) ^ (a + ux), kept positive before exponentiation
+        BigNumber const base = (BigNumber(B) + N - (v * 3) % N) % N;
+        SRP6::EphemeralKey const S = base.ModExp(_a + u * x, N).ToByteArray<SRP6::EPHEMERAL_KEY_LENGTH>();
+
+        std::array<uint8, SRP6::EPHEMERAL_KEY_LENGTH / 2> buf0, buf1;
+        for (size_t i = 0; i < buf0.size(); ++i)
+        {
+            buf0[i] = S[2 * i + 0];
+            buf1[i] = S[2 * i + 1];
+        }
+
+        size_t p = 0;
+        while (p < S.size() && !S[p]) ++p;
+        if (p & 1) ++p;
+        p /= 2;
+
+        SHA1::Digest const hash0 = SHA1::GetDigestOf(buf0.data() + p, buf0.size() - p);
+        SHA1::Digest const hash1 = SHA1::GetDigestOf(buf1.data() + p, buf1.size() - p);
+        for (size_t i = 0; i < SHA1::DIGEST_LENGTH; ++i)
+        {
+            K[2 * i + 0] = hash0[i];
+            K[2 * i + 1] = hash1[i];
+        }
+
+        SHA1::Digest const NHash = SHA1::GetDigestOf(SRP6::N);
+        SHA1::Digest const gHash = SHA1::GetDigestOf(SRP6::g);
+        SHA1::Digest NgHash;
+        std::transform(NHash.begin(), NHash.end(), gHash.begin(), NgHash.begin(), std::bit_xor<>());
+
+        return SHA1::GetDigestOf(NgHash, SHA1::GetDigestOf(Username), s, A, B, K);
+    }
+
+    std::string Username;
+    std::string Password;
+    SRP6::EphemeralKey A;
+    SessionKey K = { };
+
+private:
+    BigNumber _a;
+};
+
+// Stands in for the account table, keyed by username
+using StubLoginDatabase = std::unordered_map<std::string, std::pair<SRP6::Salt, SRP6::Verifier>>;
+
+StubLoginDatabase MakeAccounts(uint32 count)
+{
+    StubLoginDatabase accounts;
+    for (uint32 i = 0; i < count; ++i)
+    {
+        std::string username = "ACCOUNT" + std::to_string(i);
+        accounts[username] = SRP6::MakeRegistrationData(username, "PASSWORD" + std::to_string(i));
+    }
+    return accounts;
+}
+
+// Runs challenge + proof for every client through the pool, resubmitting work the pool rejected
+uint32 RunLogins(Trinity::BoundedThreadPool& pool, StubLoginDatabase const& accounts, std::vector<SRP6Client>& clients, uint32& rejected)
+{
+    std::vector<std::future<std::shared_ptr<SRP6>>> challenges(clients.size());
+    for (size_t i = 0; i < clients.size(); ++i)
+    {
+        auto const& [salt, verifier] = accounts.at(clients[i].Username);
+        while (true)
+        {
+            if (auto future = pool.TryPostWork([&username = clients[i].Username, salt = salt, verifier = verifier]() { return std::make_shared<SRP6>(username, salt, verifier); }))
+            {
+                challenges[i] = std::move(*future);
+                break;
+            }
+
+            ++rejected;
+            std::this_thread::yield();
+        }
+    }
+
+    std::vector<std::future<Optional<SessionKey>>> proofs(clients.size());
+    for (size_t i = 0; i < clients.size(); ++i)
+    {
+        std::shared_ptr<SRP6> srp6 = challenges[i].get();
+        SHA1::Digest M = clients[i].CalculateProof(srp6->s, srp6->B);
+        while (true)
+        {
+            if (auto future = pool.TryPostWork([srp6, A = clients[i].A, M]() { return srp6->VerifyChallengeResponse(A, M); }))
+            {
+                proofs[i] = std::move(*future);
+                break;
+            }
+
+            ++rejected;
+            std::this_thread::yield();
+        }
+    }
+
+    uint32 succeeded = 0;
+    for (size_t i = 0; i < clients.size(); ++i)
+        if (Optional<SessionKey> K = proofs[i].get())
+            succeeded += *K == clients[i].K;
+
+    return succeeded;
+}
+}
+
+TEST_CASE("SRP6 login round trip", "[SRP6]")
+{
+    StubLoginDatabase accounts = MakeAccounts(2);
+
+    SECTION("Correct password")
+    {
+        SRP6Client client("ACCOUNT0", "PASSWORD0");
+        SRP6 server(client.Username, accounts[client.Username].first, accounts[client.Username].second);
+        SHA1::Digest M = client.CalculateProof(server.s, server.B);
+
+        Optional<SessionKey> K = server.VerifyChallengeResponse(client.A, M);
+        REQUIRE(K);
+        REQUIRE(*K == client.K);
+    }
+
+    SECTION("Wrong password")
+    {
+        SRP6Client client("ACCOUNT1", "PASSWORD0");
+        SRP6 server(client.Username, accounts[client.Username].first, accounts[client.Username].second);
+        SHA1::Digest M = client.CalculateProof(server.s, server.B);
+
+        REQUIRE(!server.VerifyChallengeResponse(client.A, M));
+    }
+}
+
+TEST_CASE("Back-pressure", "[BoundedThreadPool]")
+{
+    Trinity::BoundedThreadPool pool(1, 2);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    auto first = pool.TryPostWork([released]() { released.wait(); return 1; });
+    auto second = pool.TryPostWork([]() { return 2; });
+    REQUIRE(first);
+    REQUIRE(second);
+    REQUIRE(pool.GetPendingTasks() == 2);
+    REQUIRE(!pool.TryPostWork([]() { return 3; }));
+
+    release.set_value();
+    REQUIRE(first->get() == 1);
+    REQUIRE(second->get() == 2);
+
+    while (pool.GetPendingTasks())
+        std::this_thread::yield();
+
+    auto third = pool.TryPostWork([]() { return 3; });
+    REQUIRE(third);
+    REQUIRE(third->get() == 3);
+    pool.Join();
+}
+
+TEST_CASE("Concurrent logins", "[SRP6][BoundedThreadPool]")
+{
+    StubLoginDatabase accounts = MakeAccounts(16);
+    std::vector<SRP6Client> clients;
+    for (uint32 i = 0; i < 16; ++i)
+        clients.emplace_back("ACCOUNT" + std::to_string(i), "PASSWORD" + std::to_string(i));
+
+    Trinity::BoundedThreadPool pool(4, 4);
+    uint32 rejected = 0;
+    REQUIRE(RunLogins(pool, accounts, clients, rejected) == clients.size());
+    pool.Join();
+}
+
+TEST_CASE("Login storm", "[SRP6][BoundedThreadPool][.benchmark]")
+{
+    constexpr uint32 Logins = 5000;
+    constexpr uint32 Threads = 4;
+    constexpr uint32 MaxQueuedTasks = 1000;
+
+    StubLoginDatabase accounts = MakeAccounts(Logins);
+    std::vector<SRP6Client> clients;
+    clients.reserve(Logins);
+    for (uint32 i = 0; i < Logins; ++i)
+        clients.emplace_back("ACCOUNT" + std::to_string(i), "PASSWORD" + std::to_string(i));
+
+    Trinity::BoundedThreadPool pool(Threads, MaxQueuedTasks);
+    uint32 rejected = 0;
+    auto start = std::chrono::steady_clock::now();
+    uint32 succeeded = RunLogins(pool, accounts, clients, rejected);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    pool.Join();
+
+    REQUIRE(succeeded == Logins);
+    WARN(Logins << " logins on " << Threads << " crypto threads: " << elapsed.count() << " ms, " << rejected << " submissions rejected by back-pressure");
+}
@@ -0,0 +1,162 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Random.h"
+#include "TimerWheel.h"
+#include <chrono>
+#include <vector>
+
+namespace
+{
+    // respawn times are unix times, far beyond the span of the wheel levels when counted from 0
+    constexpr uint64 UnixNow = 1700000000;
+    constexpr uint64 WheelSpan = uint64(1) << 24;
+}
+
+TEST_CASE("Count due entries", "[TimerWheel]")
+{
+    Trinity::TimerWheel<uint32> wheel;
+    wheel.Schedule(10, 1);
+    wheel.Schedule(20, 2);
+    wheel.Schedule(20, 3);
+    wheel.Schedule(30, 4);
+
+    REQUIRE(wheel.CountDue(5) == 0);
+    REQUIRE(wheel.CountDue(20) == 3);
+    REQUIRE(wheel.CountDue(100) == 4);
+
+    // counting does not take entries off the schedule
+    REQUIRE(wheel.Size() == 4);
+
+    wheel.Remove(wheel.PeekDue(100));
+    REQUIRE(wheel.CountDue(100) == 3);
+
+    wheel.Schedule(50, 5);
+    REQUIRE(wheel.CountDue(100) == 4);
+}
+
+TEST_CASE("Count due entries sharing a tick", "[TimerWheel]")
+{
+    Trinity::TimerWheel<uint32, 1000> wheel;
+    wheel.Schedule(1500, 1);
+    wheel.Schedule(1999, 2);
+    wheel.Schedule(2500, 3);
+
+    REQUIRE(wheel.CountDue(1499) == 0);
+    REQUIRE(wheel.CountDue(1600) == 1);
+    REQUIRE(wheel.CountDue(1999) == 2);
+    REQUIRE(wheel.CountDue(2999) == 3);
+}
+
+TEST_CASE("Unix time keys go through the overflow list", "[TimerWheel]")
+{
+    Trinity::TimerWheel<uint32> wheel;
+    wheel.Schedule(UnixNow + 30, 3);
+    wheel.Schedule(UnixNow, 1);
+    wheel.Schedule(UnixNow + WheelSpan + 5, 4);
+    wheel.Schedule(UnixNow + 10, 2);
+
+    REQUIRE(wheel.PeekDue(UnixNow - 1) == Trinity::TimerWheel<uint32>::InvalidHandle);
+    REQUIRE(wheel.CountDue(UnixNow - 1) == 0);
+    REQUIRE(wheel.CountDue(UnixNow) == 1);
+    REQUIRE(wheel.CountDue(UnixNow + 30) == 3);
+
+    // scheduled after the wheel moved to unix time, still beyond its levels
+    wheel.Schedule(UnixNow + 3 * WheelSpan, 5);
+
+    std::vector<uint32> taken;
+    wheel.TakeDue(UnixNow + 30, 0, taken);
+    REQUIRE(taken == std::vector<uint32>{ 1, 2, 3 });
+
+    REQUIRE(wheel.CountDue(UnixNow + WheelSpan + 4) == 0);
+    REQUIRE(wheel.CountDue(UnixNow + WheelSpan + 5) == 1);
+    REQUIRE(wheel.CountDue(UnixNow + 3 * WheelSpan - 1) == 1);
+
+    taken.clear();
+    wheel.TakeDue(UnixNow + 3 * WheelSpan, 0, taken);
+    REQUIRE(taken == std::vector<uint32>{ 4, 5 });
+    REQUIRE(wheel.IsEmpty());
+}
+
+TEST_CASE("Respawn wave is taken in budgeted batches", "[TimerWheel]")
+{
+    constexpr uint32 Wave = 1000;
+    constexpr std::size_t Budget = 64;
+
+    Trinity::TimerWheel<uint32> wheel;
+    for (uint32 i = 0; i < Wave; ++i)
+        wheel.Schedule(UnixNow + i % 3, i);
+
+    wheel.Schedule(UnixNow + 10, Wave);
+
+    uint64 const now = UnixNow + 5;
+    std::vector<uint32> taken;
+    std::size_t checks = 0;
+    while (std::size_t count = wheel.TakeDue(now, Budget, taken))
+    {
+        REQUIRE(count <= Budget);
+        REQUIRE(wheel.CountDue(now) == Wave - taken.size());
+        ++checks;
+    }
+
+    REQUIRE(checks == (Wave + Budget - 1) / Budget);
+    REQUIRE(taken.size() == Wave);
+
+    // expiry order: by respawn time, then in scheduling order
+    for (std::size_t i = 1; i < taken.size(); ++i)
+        REQUIRE(((taken[i - 1] % 3) < (taken[i] % 3) || ((taken[i - 1] % 3) == (taken[i] % 3) && taken[i - 1] < taken[i])));
+
+    // entries not yet due stay scheduled
+    REQUIRE(wheel.Size() == 1);
+    REQUIRE(wheel.CountDue(UnixNow + 10) == 1);
+
+    // no budget takes everything that is due
+    for (uint32 i = 0; i < Wave; ++i)
+        wheel.Schedule(UnixNow + 10, i);
+
+    taken.clear();
+    REQUIRE(wheel.TakeDue(UnixNow + 10, 0, taken) == Wave + 1);
+    REQUIRE(wheel.IsEmpty());
+}
+
+TEST_CASE("Respawn wave", "[TimerWheel][.benchmark]")
+{
+    constexpr uint32 Wave = 100000;
+    constexpr std::size_t Budget = 1000;
+
+    Trinity::TimerWheel<uint32> wheel;
+    for (uint32 i = 0; i < Wave; ++i)
+        wheel.Schedule(UnixNow + urand(0, 60), i);
+
+    std::vector<uint32> taken;
+    std::size_t maxBacklog = 0;
+    uint32 checks = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64 now = UnixNow; !wheel.IsEmpty(); ++now)
+    {
+        taken.clear();
+        wheel.TakeDue(now, Budget, taken);
+        maxBacklog = std::max(maxBacklog, wheel.CountDue(now));
+        ++checks;
+    }
+
+    REQUIRE(checks >= 61);
+    WARN(Wave << " respawns over a minute, " << Budget << " per check: " << checks << " checks, backlog up to " << maxBacklog << ", "
+        << std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() << " ms");
+}
@@ -0,0 +1,157 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "ByteBuffer.h"
+#include "ByteBufferPool.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+TEST_CASE("Storage is rounded to its size class", "[ByteBufferPool]")
+{
+    REQUIRE(ByteBufferPool::Acquire(0).capacity() == 0);
+    REQUIRE(ByteBufferPool::Acquire(1).capacity() >= ByteBufferPool::MinPooledSize);
+    REQUIRE(ByteBufferPool::Acquire(300).capacity() >= 512);
+    REQUIRE(ByteBufferPool::Acquire(ByteBufferPool::MaxPooledSize + 1).capacity() >= ByteBufferPool::MaxPooledSize + 1);
+}
+
+TEST_CASE("Released storage is reused", "[ByteBufferPool]")
+{
+    std::vector<uint8> storage = ByteBufferPool::Acquire(3000);
+    storage.push_back(1);
+    uint8 const* data = storage.data();
+    ByteBufferPool::Release(std::move(storage));
+
+    std::vector<uint8> reused = ByteBufferPool::Acquire(4096);
+    REQUIRE(reused.data() == data);
+    REQUIRE(reused.empty());
+    ByteBufferPool::Release(std::move(reused));
+}
+
+TEST_CASE("Buffers recycle their storage", "[ByteBufferPool]")
+{
+    uint8 const* data;
+    {
+        ByteBuffer buffer(100);
+        buffer << uint32(1);
+        data = buffer.contents();
+    }
+
+    ByteBuffer buffer(200);
+    buffer << uint32(2);
+    REQUIRE(buffer.contents() == data);
+
+    SECTION("Growing keeps the contents")
+    {
+        for (uint32 i = 0; i < 1000; ++i)
+            buffer << i;
+
+        REQUIRE(buffer.size() == 1001 * sizeof(uint32));
+        REQUIRE(buffer.read<uint32>() == 2);
+        REQUIRE(buffer.read<uint32>() == 0);
+        REQUIRE(buffer.read<uint32>(buffer.size() - sizeof(uint32)) == 999);
+    }
+
+    SECTION("Copies own their storage")
+    {
+        ByteBuffer copy(buffer);
+        REQUIRE(copy.contents() != buffer.contents());
+        REQUIRE(copy.read<uint32>() == 2);
+    }
+}
+
+TEST_CASE("Storage released on another thread joins that thread's pool", "[ByteBufferPool]")
+{
+    ByteBufferPool::Stats before = ByteBufferPool::GetStats();
+
+    std::vector<uint8> storage = ByteBufferPool::Acquire(1024);
+    std::thread([&storage]()
+    {
+        ByteBufferPool::Release(std::move(storage));
+        for (uint32 i = 0; i < 5000; ++i)
+            ByteBufferPool::Release(ByteBufferPool::Acquire(1024));
+    }).join();
+
+    // the thread published its counters when it exited
+    ByteBufferPool::Stats after = ByteBufferPool::GetStats();
+    REQUIRE(after.Hits - before.Hits >= 5000);
+}
+
+TEST_CASE("Storage acquired on one thread and released on another keeps circulating", "[ByteBufferPool]")
+{
+    constexpr uint32 Count = 20000;
+    constexpr std::size_t MaxInFlight = 64;
+
+    std::mutex lock;
+    std::condition_variable changed;
+    std::vector<std::vector<uint8>> inFlight;
+    bool done = false;
+
+    ByteBufferPool::Stats before = ByteBufferPool::GetStats();
+
+    // like packets built on a map thread and freed by the network thread after sending
+    std::thread sender([&]()
+    {
+        std::vector<std::vector<uint8>> sent;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                changed.wait(guard, [&]() { return !inFlight.empty() || done; });
+                if (inFlight.empty())
+                    break;
+
+                sent.swap(inFlight);
+            }
+
+            changed.notify_all();
+            for (std::vector<uint8>& storage : sent)
+                ByteBufferPool::Release(std::move(storage));
+
+            sent.clear();
+        }
+    });
+
+    std::thread builder([&]()
+    {
+        for (uint32 i = 0; i < Count; ++i)
+        {
+            std::vector<uint8> storage = ByteBufferPool::Acquire(1024);
+            storage.resize(1024);
+
+            std::unique_lock<std::mutex> guard(lock);
+            changed.wait(guard, [&]() { return inFlight.size() < MaxInFlight; });
+            inFlight.push_back(std::move(storage));
+            changed.notify_all();
+        }
+    });
+
+    builder.join();
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        done = true;
+    }
+    changed.notify_all();
+    sender.join();
+
+    // both threads published their counters when they exited
+    ByteBufferPool::Stats after = ByteBufferPool::GetStats();
+    REQUIRE(after.Hits - before.Hits >= Count * 9 / 10);
+    REQUIRE(after.Drops - before.Drops < Count / 10);
+}
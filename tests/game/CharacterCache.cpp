@@ -0,0 +1,97 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "CharacterCache.h"
+#include "SharedDefines.h"
+#include <chrono>
+
+namespace
+{
+    ObjectGuid MakeGuid(ObjectGuid::LowType counter)
+    {
+        // keep clear of anything other test cases could add to the shared cache
+        return ObjectGuid::Create<HighGuid::Player>(0x70000000 + counter);
+    }
+}
+
+TEST_CASE("Lookup by guid and name", "[CharacterCache]")
+{
+    sCharacterCache->AddCharacterCacheEntry(MakeGuid(1), 10, "Cachetesta", GENDER_FEMALE, RACE_HUMAN, CLASS_MAGE, 80);
+    sCharacterCache->AddCharacterCacheEntry(MakeGuid(2), 11, "Cachetestb", GENDER_MALE, RACE_ORC, CLASS_WARRIOR, 70);
+
+    CharacterCacheEntry const* entry = sCharacterCache->GetCharacterCacheByGuid(MakeGuid(1));
+    REQUIRE(entry != nullptr);
+    REQUIRE(entry->Name == "Cachetesta");
+    REQUIRE(entry->AccountId == 10);
+    REQUIRE(entry->Level == 80);
+
+    REQUIRE(sCharacterCache->GetCharacterCacheByName("Cachetestb") == sCharacterCache->GetCharacterCacheByGuid(MakeGuid(2)));
+    REQUIRE(sCharacterCache->GetCharacterGuidByName("Cachetestb") == MakeGuid(2));
+    REQUIRE(sCharacterCache->GetCharacterAccountIdByName("Cachetesta") == 10);
+
+    sCharacterCache->UpdateCharacterLevel(MakeGuid(2), 71);
+    REQUIRE(sCharacterCache->GetCharacterLevelByGuid(MakeGuid(2)) == 71);
+
+    sCharacterCache->DeleteCharacterCacheEntry(MakeGuid(1), "Cachetesta");
+    sCharacterCache->DeleteCharacterCacheEntry(MakeGuid(2), "Cachetestb");
+    REQUIRE(sCharacterCache->GetCharacterCacheByGuid(MakeGuid(1)) == nullptr);
+    REQUIRE(sCharacterCache->GetCharacterCacheByName("Cachetestb") == nullptr);
+}
+
+TEST_CASE("Re-adding a guid replaces its name", "[CharacterCache]")
+{
+    sCharacterCache->AddCharacterCacheEntry(MakeGuid(3), 12, "Cachetestc", GENDER_MALE, RACE_DWARF, CLASS_PRIEST, 1);
+    sCharacterCache->AddCharacterCacheEntry(MakeGuid(3), 12, "Cachetestd", GENDER_MALE, RACE_DWARF, CLASS_PRIEST, 2);
+
+    REQUIRE(sCharacterCache->GetCharacterCacheByName("Cachetestc") == nullptr);
+    REQUIRE(sCharacterCache->GetCharacterGuidByName("Cachetestd") == MakeGuid(3));
+
+    sCharacterCache->DeleteCharacterCacheEntry(MakeGuid(3), "Cachetestd");
+    REQUIRE_FALSE(sCharacterCache->HasCharacterCacheEntry(MakeGuid(3)));
+}
+
+TEST_CASE("Character cache lookups", "[CharacterCache][.benchmark]")
+{
+    constexpr uint32 Characters = 1000000;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < Characters; ++i)
+        sCharacterCache->AddCharacterCacheEntry(MakeGuid(100 + i), i, "Bench" + std::to_string(i), GENDER_MALE, RACE_HUMAN, CLASS_WARRIOR, 80);
+
+    auto loaded = std::chrono::steady_clock::now();
+    uint64 found = 0;
+    for (uint32 i = 0; i < Characters; ++i)
+        found += sCharacterCache->GetCharacterCacheByGuid(MakeGuid(100 + (i * 7919) % Characters)) != nullptr;
+
+    auto byGuid = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < Characters; i += 10)
+        found += sCharacterCache->GetCharacterCacheByName("Bench" + std::to_string((i * 7919) % Characters)) != nullptr;
+
+    auto byName = std::chrono::steady_clock::now();
+    REQUIRE(found == Characters + Characters / 10);
+
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    WARN(Characters << " characters: fill " << duration_cast<milliseconds>(loaded - start).count()
+        << " ms, guid lookups " << duration_cast<milliseconds>(byGuid - loaded).count()
+        << " ms, " << Characters / 10 << " name lookups " << duration_cast<milliseconds>(byName - byGuid).count() << " ms");
+
+    for (uint32 i = 0; i < Characters; ++i)
+        sCharacterCache->DeleteCharacterCacheEntry(MakeGuid(100 + i), "Bench" + std::to_string(i));
+}
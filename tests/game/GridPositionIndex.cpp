@@ -0,0 +1,150 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "GridPositionIndex.h"
+#include "Object.h"
+#include "Random.h"
+#include <chrono>
+#include <memory>
+#include <set>
+
+namespace
+{
+    class TestObject : public WorldObject
+    {
+    public:
+        TestObject(float x, float y, uint32 phaseMask) : WorldObject(false)
+        {
+            Relocate(x, y, 0.0f);
+            SetPhaseMask(phaseMask, false);
+        }
+
+        bool AddToObjectUpdate() override { return false; }
+        void RemoveFromObjectUpdate() override { }
+        ObjectGuid GetOwnerGUID() const override { return ObjectGuid::Empty; }
+        uint32 GetFaction() const override { return 0; }
+    };
+
+    std::set<WorldObject*> Search(GridPositionIndex const& index, GridSearchArea const& area, Optional<uint32> phaseMask)
+    {
+        std::set<WorldObject*> found;
+        index.VisitInRange(area, phaseMask, [&](WorldObject* object)
+        {
+            found.insert(object);
+            return true;
+        });
+        return found;
+    }
+}
+
+TEST_CASE("Range and phase filtering", "[GridPositionIndex]")
+{
+    GridPositionIndex index;
+    TestObject near(1.0f, 1.0f, 1);
+    TestObject otherPhase(2.0f, 0.0f, 2);
+    TestObject far(50.0f, 50.0f, 1);
+
+    index.Insert(&near);
+    index.Insert(&otherPhase);
+    index.Insert(&far);
+
+    REQUIRE(Search(index, { 0.0f, 0.0f, 5.0f }, 1) == std::set<WorldObject*>{ &near });
+    REQUIRE(Search(index, { 0.0f, 0.0f, 5.0f }, {}) == std::set<WorldObject*>{ &near, &otherPhase });
+
+    SECTION("Relocation and phase changes are tracked")
+    {
+        far.Relocate(3.0f, 3.0f);
+        otherPhase.SetPhaseMask(3, false);
+        REQUIRE(Search(index, { 0.0f, 0.0f, 5.0f }, 1) == std::set<WorldObject*>{ &near, &otherPhase, &far });
+    }
+
+    SECTION("Removal keeps remaining slots valid")
+    {
+        GridPositionIndex::Remove(&near);
+        REQUIRE(index.GetSize() == 2);
+        REQUIRE(Search(index, { 50.0f, 50.0f, 1.0f }, {}) == std::set<WorldObject*>{ &far });
+
+        far.Relocate(0.0f, 1.0f);
+        REQUIRE(Search(index, { 0.0f, 0.0f, 5.0f }, {}) == std::set<WorldObject*>{ &otherPhase, &far });
+    }
+}
+
+TEST_CASE("Matches a linear scan", "[GridPositionIndex]")
+{
+    GridPositionIndex index;
+    std::vector<std::unique_ptr<TestObject>> objects;
+    for (uint32 i = 0; i < 1000; ++i)
+    {
+        objects.push_back(std::make_unique<TestObject>(frand(0.0f, 66.0f), frand(0.0f, 66.0f), 1u << urand(0, 3)));
+        index.Insert(objects.back().get());
+    }
+
+    for (uint32 i = 0; i < 100; ++i)
+    {
+        GridSearchArea area{ frand(0.0f, 66.0f), frand(0.0f, 66.0f), frand(1.0f, 30.0f) };
+        uint32 phaseMask = urand(1, 15);
+
+        std::set<WorldObject*> expected;
+        for (std::unique_ptr<TestObject> const& object : objects)
+            if (object->InSamePhase(phaseMask) && object->IsInDist2d(area.X, area.Y, area.Range))
+                expected.insert(object.get());
+
+        // the index may return a few extra candidates within its slack, never miss any
+        std::set<WorldObject*> found = Search(index, area, phaseMask);
+        for (WorldObject* object : expected)
+            REQUIRE(found.count(object));
+        for (WorldObject* object : found)
+            REQUIRE(object->IsInDist2d(area.X, area.Y, area.Range + GridPositionIndex::SearchSlack + 0.001f));
+    }
+}
+
+TEST_CASE("Range search", "[GridPositionIndex][.benchmark]")
+{
+    GridPositionIndex index;
+    std::vector<std::unique_ptr<TestObject>> objects;
+    for (uint32 i = 0; i < 512; ++i)
+    {
+        objects.push_back(std::make_unique<TestObject>(frand(0.0f, 66.0f), frand(0.0f, 66.0f), PHASEMASK_NORMAL));
+        index.Insert(objects.back().get());
+    }
+
+    uint32 found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < 100000; ++i)
+    {
+        index.VisitInRange({ 33.0f, 33.0f, 8.0f }, PHASEMASK_NORMAL, [&](WorldObject* /*object*/)
+        {
+            ++found;
+            return true;
+        });
+    }
+    auto indexTime = std::chrono::steady_clock::now() - start;
+
+    uint32 scanned = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < 100000; ++i)
+        for (std::unique_ptr<TestObject> const& object : objects)
+            if (object->InSamePhase(PHASEMASK_NORMAL) && object->IsInDist2d(33.0f, 33.0f, 8.0f + GridPositionIndex::SearchSlack))
+                ++scanned;
+    auto scanTime = std::chrono::steady_clock::now() - start;
+
+    REQUIRE(found >= scanned);
+    WARN("index: " << std::chrono::duration_cast<std::chrono::milliseconds>(indexTime).count() << " ms, "
+        << "object scan: " << std::chrono::duration_cast<std::chrono::milliseconds>(scanTime).count() << " ms");
+}
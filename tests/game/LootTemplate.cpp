@@ -0,0 +1,62 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Loot.h"
+#include "LootMgr.h"
+#include <chrono>
+
+TEST_CASE("Grouped entries survive flattening", "[LootTemplate]")
+{
+    LootTemplate lootTemplate;
+    lootTemplate.AddEntry(LootStoreItem(1, 0, 0.0f, false, LOOT_MODE_DEFAULT, 3, 1, 1));
+    lootTemplate.AddEntry(LootStoreItem(2, 0, 10.0f, true, LOOT_MODE_DEFAULT, 3, 1, 1));
+    lootTemplate.AddEntry(LootStoreItem(3, 0, 50.0f, false, LOOT_MODE_DEFAULT, 0, 1, 1));
+    lootTemplate.Finalize();
+
+    LootTemplateMap store;
+    REQUIRE(lootTemplate.HasQuestDrop(store));
+    REQUIRE(lootTemplate.HasQuestDrop(store, 3));
+    REQUIRE(!lootTemplate.HasQuestDrop(store, 1));
+    REQUIRE(!lootTemplate.HasQuestDrop(store, 4));
+}
+
+TEST_CASE("Loot generation", "[LootTemplate][.benchmark]")
+{
+    constexpr uint32 Kills = 1000000;
+
+    // shaped like a raid boss table: a few guaranteed drops, a large explicitly chanced group and an equal chanced one
+    LootTemplate lootTemplate;
+    for (uint32 i = 0; i < 4; ++i)
+        lootTemplate.AddEntry(LootStoreItem(100 + i, 0, 100.0f, false, LOOT_MODE_DEFAULT, 0, 1, 1));
+    for (uint32 i = 0; i < 40; ++i)
+        lootTemplate.AddEntry(LootStoreItem(200 + i, 0, 2.0f, false, LOOT_MODE_DEFAULT, 1, 1, 1));
+    for (uint32 i = 0; i < 20; ++i)
+        lootTemplate.AddEntry(LootStoreItem(300 + i, 0, 0.0f, false, LOOT_MODE_DEFAULT, 2, 1, 1));
+    lootTemplate.Finalize();
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < Kills; ++i)
+    {
+        Loot loot;
+        lootTemplate.Process(loot, false, LOOT_MODE_DEFAULT);
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    WARN(Kills << " kills: " << elapsed.count() << " ms");
+}
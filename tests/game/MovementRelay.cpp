@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Opcodes.h"
+#include "WorldSession.h"
+#include <vector>
+
+namespace
+{
+    constexpr uint32 HeartbeatPeriod = 500;
+
+    struct RelayedPacket
+    {
+        uint16 Opcode;
+        uint32 Time;
+    };
+
+    // Times of the packets that reach distant observers, tracking the last full relay like WorldSession::RelayMovement
+    std::vector<uint32> RelayToDistantObservers(std::vector<RelayedPacket> const& packets, uint32 outerInterval)
+    {
+        std::vector<uint32> relayed;
+        uint32 lastFullRelay = 0;
+        for (RelayedPacket const& packet : packets)
+        {
+            if (!WorldSession::IsFullMovementRelay(packet.Opcode, lastFullRelay, packet.Time, outerInterval))
+                continue;
+
+            if (packet.Opcode == MSG_MOVE_HEARTBEAT)
+                lastFullRelay = packet.Time;
+            relayed.push_back(packet.Time);
+        }
+        return relayed;
+    }
+
+    std::vector<RelayedPacket> Heartbeats(uint32 start, uint32 count)
+    {
+        std::vector<RelayedPacket> packets;
+        for (uint32 i = 0; i < count; ++i)
+            packets.push_back({ MSG_MOVE_HEARTBEAT, start + i * HeartbeatPeriod });
+        return packets;
+    }
+}
+
+TEST_CASE("Movement state changes reach every observer", "[MovementRelay]")
+{
+    REQUIRE(WorldSession::IsFullMovementRelay(MSG_MOVE_START_FORWARD, 1000, 1000, 1500));
+    REQUIRE(WorldSession::IsFullMovementRelay(MSG_MOVE_SET_FACING, 1000, 1001, 1500));
+    REQUIRE_FALSE(WorldSession::IsFullMovementRelay(MSG_MOVE_HEARTBEAT, 1000, 1001, 1500));
+    REQUIRE(WorldSession::IsFullMovementRelay(MSG_MOVE_HEARTBEAT, 1000, 2500, 1500));
+
+    // game time wrapping around
+    REQUIRE(WorldSession::IsFullMovementRelay(MSG_MOVE_HEARTBEAT, 0xFFFFFF00, 1500, 1500));
+    REQUIRE_FALSE(WorldSession::IsFullMovementRelay(MSG_MOVE_HEARTBEAT, 0xFFFFFF00, 100, 1500));
+}
+
+TEST_CASE("Distant observers get every third heartbeat", "[MovementRelay]")
+{
+    // a minute of running
+    std::vector<RelayedPacket> packets = Heartbeats(10000, 120);
+
+    REQUIRE(RelayToDistantObservers(packets, HeartbeatPeriod).size() == 120);
+
+    std::vector<uint32> relayed = RelayToDistantObservers(packets, 1500);
+    REQUIRE(relayed.size() == 40);
+    for (std::size_t i = 1; i < relayed.size(); ++i)
+        REQUIRE(relayed[i] - relayed[i - 1] == 1500);
+}
+
+TEST_CASE("State changes do not shift the heartbeat pace", "[MovementRelay]")
+{
+    std::vector<RelayedPacket> packets = Heartbeats(10000, 12);
+    packets.insert(packets.begin() + 2, { MSG_MOVE_SET_FACING, 10000 + 2 * HeartbeatPeriod - 10 });
+    packets.insert(packets.begin() + 8, { MSG_MOVE_START_STRAFE_LEFT, 10000 + 6 * HeartbeatPeriod + 250 });
+
+    std::vector<uint32> relayed = RelayToDistantObservers(packets, 1500);
+    REQUIRE(relayed == std::vector<uint32>{ 10000, 10990, 11500, 13000, 13250, 14500 });
+}
@@ -0,0 +1,148 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef ELUNA
+
+#include "tc_catch2.h"
+
+#include "BindingMap.h"
+#include "Hooks.h"
+
+extern "C"
+{
+#include "lauxlib.h"
+};
+
+namespace
+{
+    typedef EntryKey<Hooks::PacketEvents> PacketKey;
+
+    constexpr uint32 OpcodeCount = 16;
+
+    // Binds and dispatches packet events the way Eluna::Register, the cancel callback and the packet hooks do
+    class PacketBindings
+    {
+    public:
+        PacketBindings() : L(luaL_newstate()), Bindings(new BindingMap<PacketKey>(L)), Flags(OpcodeCount) { }
+
+        ~PacketBindings()
+        {
+            delete Bindings;
+            lua_close(L);
+        }
+
+        uint64 Bind(uint32 opcode, uint32 shots)
+        {
+            lua_pushboolean(L, 1);
+            uint64 id = Bindings->Insert(PacketKey(Hooks::PACKET_EVENT_ON_PACKET_SEND, opcode), luaL_ref(L, LUA_REGISTRYINDEX), shots);
+            Flags.SetBound(opcode, true);
+            return id;
+        }
+
+        void Cancel(uint64 id)
+        {
+            Bindings->Remove(id);
+            Update();
+        }
+
+        void Dispatch(uint32 opcode)
+        {
+            PacketKey key(Hooks::PACKET_EVENT_ON_PACKET_SEND, opcode);
+            if (!Flags.IsBound(opcode) || !Bindings->HasBindingsFor(key))
+                return;
+
+            int top = lua_gettop(L);
+            Bindings->PushRefsFor(key);
+            lua_settop(L, top);
+
+            if (!Bindings->HasBindingsFor(key))
+                Flags.SetBound(opcode, false);
+        }
+
+        void Update()
+        {
+            Flags.Update(false, [this](uint32 opcode)
+            {
+                return Bindings->HasBindingsFor(PacketKey(Hooks::PACKET_EVENT_ON_PACKET_SEND, opcode));
+            });
+        }
+
+        lua_State* L;
+        BindingMap<PacketKey>* Bindings;
+        PacketBindingFlags Flags;
+    };
+}
+
+TEST_CASE("Only subscribed opcodes are flagged", "[PacketBindingFlags]")
+{
+    PacketBindings bindings;
+    REQUIRE_FALSE(bindings.Flags.IsBound(3));
+
+    bindings.Bind(3, 0);
+    REQUIRE(bindings.Flags.IsBound(3));
+    REQUIRE_FALSE(bindings.Flags.IsBound(4));
+    REQUIRE_FALSE(bindings.Flags.IsBound(OpcodeCount + 3));
+
+    bindings.Dispatch(3);
+    REQUIRE(bindings.Flags.IsBound(3));
+}
+
+TEST_CASE("Cancelling the last binding clears the flag", "[PacketBindingFlags]")
+{
+    PacketBindings bindings;
+    uint64 first = bindings.Bind(3, 0);
+    uint64 second = bindings.Bind(3, 0);
+
+    bindings.Cancel(first);
+    REQUIRE(bindings.Flags.IsBound(3));
+
+    bindings.Cancel(second);
+    REQUIRE_FALSE(bindings.Flags.IsBound(3));
+}
+
+TEST_CASE("Bindings running out of shots clear the flag", "[PacketBindingFlags]")
+{
+    PacketBindings bindings;
+    bindings.Bind(3, 2);
+    bindings.Bind(5, 1);
+    bindings.Bind(5, 0);
+
+    bindings.Dispatch(3);
+    REQUIRE(bindings.Flags.IsBound(3));
+
+    bindings.Dispatch(3);
+    REQUIRE_FALSE(bindings.Flags.IsBound(3));
+
+    // a binding without shots keeps the opcode flagged
+    bindings.Dispatch(5);
+    REQUIRE(bindings.Flags.IsBound(5));
+}
+
+TEST_CASE("Catch-all bindings flag every opcode", "[PacketBindingFlags]")
+{
+    PacketBindings bindings;
+    bindings.Bind(3, 0);
+    bindings.Flags.SetAnyBound(true);
+    REQUIRE(bindings.Flags.IsBound(4));
+    REQUIRE(bindings.Flags.IsBound(OpcodeCount + 3));
+
+    bindings.Update();
+    REQUIRE_FALSE(bindings.Flags.IsBound(4));
+    REQUIRE(bindings.Flags.IsBound(3));
+}
+
+#endif
@@ -0,0 +1,94 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "LFGScripts.h"
+#include "ScriptMgr.h"
+
+namespace
+{
+    class DamageScript : public UnitScript
+    {
+    public:
+        DamageScript() : UnitScript("DamageScript") { }
+
+        void OnDamage(Unit* /*attacker*/, Unit* /*victim*/, uint32& /*damage*/) override { }
+    };
+
+    class DerivedDamageScript : public DamageScript
+    {
+    public:
+        void ModifyMeleeDamage(Unit* /*target*/, Unit* /*attacker*/, uint32& /*damage*/) override { }
+    };
+
+    class GroupChatScript : public PlayerScript
+    {
+    public:
+        GroupChatScript() : PlayerScript("GroupChatScript") { }
+
+        void OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Group* /*group*/) override { }
+        void OnLogin(Player* /*player*/, bool /*firstLogin*/) override { }
+    };
+
+    class AllChatScript : public PlayerScript
+    {
+    public:
+        AllChatScript() : PlayerScript("AllChatScript") { }
+
+        using PlayerScript::OnChat;
+        void OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/) override { }
+        void OnChat(Player* /*player*/, uint32 /*type*/, uint32 /*lang*/, std::string& /*msg*/, Channel* /*channel*/) override { }
+    };
+}
+
+TEST_CASE("Overridden UnitScript hooks", "[ScriptHooks]")
+{
+    UnitScript::HookMask hooks = UnitScript::GetOverriddenHooks<DamageScript>();
+    REQUIRE(hooks.count() == 1);
+    REQUIRE(hooks[UNIT_HOOK_ON_DAMAGE]);
+
+    hooks = UnitScript::GetOverriddenHooks<DerivedDamageScript>();
+    REQUIRE(hooks.count() == 2);
+    REQUIRE(hooks[UNIT_HOOK_ON_DAMAGE]);
+    REQUIRE(hooks[UNIT_HOOK_MODIFY_MELEE_DAMAGE]);
+}
+
+TEST_CASE("Overloaded PlayerScript hooks", "[ScriptHooks]")
+{
+    // the other chat overloads are hidden by the group one and kept to be safe
+    PlayerScript::HookMask hooks = PlayerScript::GetOverriddenHooks<GroupChatScript>();
+    REQUIRE(hooks.count() == 6);
+    REQUIRE(hooks[PLAYER_HOOK_ON_CHAT_GROUP]);
+    REQUIRE(hooks[PLAYER_HOOK_ON_CHAT_WHISPER]);
+    REQUIRE(hooks[PLAYER_HOOK_ON_LOGIN]);
+    REQUIRE_FALSE(hooks[PLAYER_HOOK_ON_LOGOUT]);
+
+    hooks = PlayerScript::GetOverriddenHooks<AllChatScript>();
+    REQUIRE(hooks.count() == 2);
+    REQUIRE(hooks[PLAYER_HOOK_ON_CHAT]);
+    REQUIRE(hooks[PLAYER_HOOK_ON_CHAT_CHANNEL]);
+}
+
+TEST_CASE("In-tree PlayerScript hooks", "[ScriptHooks]")
+{
+    PlayerScript::HookMask hooks = PlayerScript::GetOverriddenHooks<lfg::LFGPlayerScript>();
+    REQUIRE(hooks.count() == 3);
+    REQUIRE(hooks[PLAYER_HOOK_ON_LOGOUT]);
+    REQUIRE(hooks[PLAYER_HOOK_ON_LOGIN]);
+    REQUIRE(hooks[PLAYER_HOOK_ON_MAP_CHANGED]);
+}
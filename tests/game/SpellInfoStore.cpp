@@ -0,0 +1,130 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "DBCStructure.h"
+#include "DummyData.h"
+#include "Random.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+namespace
+{
+    // the checks every cast runs on its own spell and on the spells of the caster's spell mods
+    uint32 RunCastChecks(std::vector<SpellInfo const*> const& spells, uint32 count)
+    {
+        uint32 result = 0;
+        for (uint32 i = 0; i < count; ++i)
+        {
+            SpellInfo const* spellInfo = spells[urand(0, spells.size() - 1)];
+            SpellInfo const* modSpell = spells[urand(0, spells.size() - 1)];
+            if (spellInfo->HasAttribute(SPELL_ATTR0_PASSIVE) || spellInfo->HasAttribute(SPELL_ATTR4_NOT_CHECK_SELFCAST_POWER))
+                ++result;
+            if (spellInfo->IsAffected(modSpell->SpellFamilyName, modSpell->SpellFamilyFlags))
+                ++result;
+            if (spellInfo->GetEffect(EFFECT_0).IsEffect(SPELL_EFFECT_SCHOOL_DAMAGE) && (spellInfo->SchoolMask & SPELL_SCHOOL_MASK_FIRE))
+                ++result;
+            if (spellInfo->Targets & TARGET_FLAG_UNIT)
+                ++result;
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("SpellInfo store keeps spells in id order", "[SpellMgr]")
+{
+    UnitTestDataLoader::LoadSpellInfo();
+
+    SpellInfo const* tidalWaves1 = sSpellMgr->GetSpellInfo(51562);
+    REQUIRE(tidalWaves1);
+    REQUIRE(tidalWaves1->Id == 51562);
+
+    // consecutive ids are neighbours in memory
+    for (uint32 spellId = 51563; spellId <= 51566; ++spellId)
+    {
+        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
+        REQUIRE(spellInfo);
+        REQUIRE(spellInfo->Id == spellId);
+        REQUIRE(spellInfo == tidalWaves1 + (spellId - 51562));
+    }
+
+    REQUIRE(!sSpellMgr->GetSpellInfo(51567));
+}
+
+TEST_CASE("Casting path checks", "[SpellMgr][.benchmark]")
+{
+    constexpr uint32 SpellCount = 30000;
+    constexpr uint32 Checks = 2000000;
+
+    std::vector<SpellEntry> entries(SpellCount);
+    for (uint32 i = 0; i < SpellCount; ++i)
+    {
+        SpellEntry& entry = entries[i];
+        entry = {};
+        entry.ID = i + 1;
+        entry.Attributes = urand(0, 0xFFFFFFFF);
+        entry.AttributesExD = urand(0, 0xFFFFFFFF);
+        entry.SpellClassSet = urand(0, 17);
+        entry.SpellClassMask = flag96(urand(0, 0xFFFFFFFF), urand(0, 0xFFFFFFFF), urand(0, 0xFFFFFFFF));
+        entry.SchoolMask = 1 << urand(0, 6);
+        entry.Targets = urand(0, 0xFFFF);
+        entry.Effect[0] = urand(0, 10);
+        entry.EquippedItemClass = -1;
+    }
+
+    // spells allocated one by one while the server loads end up spread over the heap
+    std::vector<std::unique_ptr<SpellInfo>> scattered;
+    std::vector<std::unique_ptr<uint8[]>> otherAllocations;
+    for (SpellEntry const& entry : entries)
+    {
+        scattered.push_back(std::make_unique<SpellInfo>(&entry));
+        otherAllocations.push_back(std::make_unique<uint8[]>(urand(64, 4096)));
+    }
+
+    std::vector<SpellInfo const*> scatteredSpells;
+    for (std::unique_ptr<SpellInfo> const& spellInfo : scattered)
+        scatteredSpells.push_back(spellInfo.get());
+
+    // SpellMgr constructs them in one block in id order
+    std::allocator<SpellInfo> allocator;
+    SpellInfo* storage = allocator.allocate(SpellCount);
+    std::vector<SpellInfo const*> contiguousSpells;
+    for (uint32 i = 0; i < SpellCount; ++i)
+        contiguousSpells.push_back(std::construct_at(storage + i, &entries[i]));
+
+    auto start = std::chrono::steady_clock::now();
+    uint32 scatteredResult = RunCastChecks(scatteredSpells, Checks);
+    auto scatteredTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    uint32 contiguousResult = RunCastChecks(contiguousSpells, Checks);
+    auto contiguousTime = std::chrono::steady_clock::now() - start;
+
+    REQUIRE(scatteredResult > 0);
+    REQUIRE(contiguousResult > 0);
+    WARN("scattered: " << std::chrono::duration_cast<std::chrono::milliseconds>(scatteredTime).count() << " ms, "
+        << "contiguous: " << std::chrono::duration_cast<std::chrono::milliseconds>(contiguousTime).count() << " ms, "
+        << "sizeof(SpellInfo): " << sizeof(SpellInfo));
+
+    std::destroy_n(storage, SpellCount);
+    allocator.deallocate(storage, SpellCount);
+}
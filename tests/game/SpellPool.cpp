@@ -0,0 +1,149 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "Spell.h"
+#include "SpellPool.h"
+#include "UniqueTrackablePtr.h"
+#include <boost/container/small_vector.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // stand-in for Spell::TargetInfo
+    struct TestTarget
+    {
+        ObjectGuid TargetGUID;
+        uint64 TimeDelay = 0;
+        uint8 Data[64] = { };
+    };
+
+    // runs on a new thread, counters are published when it exits
+    template <typename Work>
+    SpellPool::Stats RunOnThread(Work work)
+    {
+        SpellPool::Stats before = SpellPool::GetStats();
+        std::thread(work).join();
+        SpellPool::Stats after = SpellPool::GetStats();
+        return { after.Hits - before.Hits, after.Misses - before.Misses, after.Drops - before.Drops };
+    }
+}
+
+TEST_CASE("Freed blocks are reused", "[SpellPool]")
+{
+    void* block = SpellPool::Allocate(200);
+    SpellPool::Deallocate(block, 200);
+
+    // other sizes have their own lists
+    void* other = SpellPool::Allocate(300);
+    REQUIRE(other != block);
+
+    REQUIRE(SpellPool::Allocate(200) == block);
+    SpellPool::Deallocate(block, 200);
+    SpellPool::Deallocate(other, 300);
+}
+
+TEST_CASE("Spells and their tracking use the pool", "[SpellPool]")
+{
+    void* memory = Spell::operator new(sizeof(Spell));
+    Spell::operator delete(memory, sizeof(Spell));
+    REQUIRE(SpellPool::Allocate(sizeof(Spell)) == memory);
+    SpellPool::Deallocate(memory, sizeof(Spell));
+
+    SpellPool::Stats stats = RunOnThread([]()
+    {
+        for (uint32 i = 0; i < 100; ++i)
+            Trinity::unique_trackable_ptr<int> tracked(new int(5), std::default_delete<int>(), SpellPool::Allocator<int>());
+    });
+
+    // only the first control block needed new memory
+    REQUIRE(stats.Misses == 1);
+    REQUIRE(stats.Hits == 99);
+}
+
+TEST_CASE("Blocks freed on another thread join that thread's pool", "[SpellPool]")
+{
+    void* block = SpellPool::Allocate(128);
+    SpellPool::Stats stats = RunOnThread([block]()
+    {
+        SpellPool::Deallocate(block, 128);
+        REQUIRE(SpellPool::Allocate(128) == block);
+        SpellPool::Deallocate(block, 128);
+    });
+
+    REQUIRE(stats.Hits == 1);
+    REQUIRE(stats.Misses == 0);
+}
+
+TEST_CASE("Allocations per cast", "[SpellPool][.benchmark]")
+{
+    constexpr uint32 Casts = 200000;
+
+    // a cast allocates the spell, its SpellValue, its SpellEvent, the control block tracking the spell and its target list
+    uint64 globalAllocations = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < Casts; ++i)
+    {
+        char* spell = new char[sizeof(Spell)];
+        char* value = new char[sizeof(SpellValue)];
+        char* event = new char[64];
+        Trinity::unique_trackable_ptr<char> tracked(spell, std::default_delete<char[]>());
+        globalAllocations += 4;
+
+        std::vector<TestTarget> targets;
+        for (uint32 target = 0; target <= i % 5; ++target)
+        {
+            if (targets.size() == targets.capacity())
+                ++globalAllocations;
+            targets.emplace_back();
+        }
+
+        delete[] event;
+        delete[] value;
+    }
+    auto globalTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    SpellPool::Stats stats = RunOnThread([]()
+    {
+        for (uint32 i = 0; i < Casts; ++i)
+        {
+            char* spell = static_cast<char*>(SpellPool::Allocate(sizeof(Spell)));
+            void* value = SpellPool::Allocate(sizeof(SpellValue));
+            void* event = SpellPool::Allocate(64);
+            Trinity::unique_trackable_ptr<char> tracked(spell, [](char* ptr) { SpellPool::Deallocate(ptr, sizeof(Spell)); }, SpellPool::Allocator<char>());
+
+            boost::container::small_vector<TestTarget, 5> targets;
+            for (uint32 target = 0; target <= i % 5; ++target)
+                targets.emplace_back();
+
+            SpellPool::Deallocate(event, 64);
+            SpellPool::Deallocate(value, sizeof(SpellValue));
+        }
+    });
+    auto poolTime = std::chrono::steady_clock::now() - start;
+
+    // only the first cast of the thread needs new memory
+    REQUIRE(stats.Misses <= 4);
+    WARN("global allocator: " << double(globalAllocations) / Casts << " allocations per cast, "
+        << std::chrono::duration_cast<std::chrono::milliseconds>(globalTime).count() << " ms; "
+        << "pooled: " << double(stats.Misses) / Casts << " allocations per cast, "
+        << std::chrono::duration_cast<std::chrono::milliseconds>(poolTime).count() << " ms");
+}
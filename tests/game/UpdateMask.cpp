@@ -0,0 +1,106 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
+#include <vector>
+
+TEST_CASE("Packed bits", "[UpdateMask]")
+{
+    UpdateMask mask;
+    mask.SetCount(UNIT_END);
+    REQUIRE(mask.GetBlockCount() == UpdateMask::CalculateBlockCount(UNIT_END));
+
+    mask.SetBit(0);
+    mask.SetBit(31);
+    mask.SetBit(32);
+    mask.SetBit(UNIT_END - 1);
+    REQUIRE(mask.GetBit(31));
+    REQUIRE(mask.GetBit(32));
+    REQUIRE_FALSE(mask.GetBit(33));
+    REQUIRE(mask.GetBlock(0) == 0x80000001);
+    REQUIRE(mask.GetBlock(1) == 1);
+
+    mask.UnsetBit(31);
+    REQUIRE_FALSE(mask.GetBit(31));
+    REQUIRE(mask.GetBit(UNIT_END - 1));
+
+    mask.Clear();
+    for (uint32 block = 0; block < mask.GetBlockCount(); ++block)
+        REQUIRE(mask.GetBlock(block) == 0);
+}
+
+TEST_CASE("Packet mask", "[UpdateMask]")
+{
+    SECTION("Trailing empty blocks are not sent")
+    {
+        UpdateMaskPacketBuilder updateMask(PLAYER_END);
+        updateMask.SetBit(1);
+        updateMask.SetBit(40);
+
+        ByteBuffer data;
+        updateMask.AppendToPacket(&data);
+        REQUIRE(data.size() == 1 + 2 * sizeof(uint32));
+        REQUIRE(data.read<uint8>() == 2);
+        REQUIRE(data.read<uint32>() == 2);
+        REQUIRE(data.read<uint32>() == 0x100);
+    }
+
+    SECTION("Empty mask still sends one block")
+    {
+        ByteBuffer data;
+        UpdateMaskPacketBuilder(GAMEOBJECT_END).AppendToPacket(&data);
+        REQUIRE(data.size() == 1 + sizeof(uint32));
+        REQUIRE(data.read<uint8>() == 1);
+    }
+
+    SECTION("Block bits past the value count are dropped")
+    {
+        UpdateMaskPacketBuilder updateMask(40);
+        updateMask.SetBlockBits(1, ~0u);
+
+        std::vector<uint16> fields;
+        updateMask.VisitSetBits([&](uint16 index) { fields.push_back(index); });
+        REQUIRE(fields.size() == 8);
+        REQUIRE(fields.front() == 32);
+        REQUIRE(fields.back() == 39);
+    }
+}
+
+TEST_CASE("Flag blocks match the flag arrays", "[UpdateMask]")
+{
+    uint32 const observers[] =
+    {
+        UF_FLAG_PUBLIC,
+        UF_FLAG_PUBLIC | UF_FLAG_PRIVATE,
+        UF_FLAG_PUBLIC | UF_FLAG_OWNER | UF_FLAG_PARTY_MEMBER,
+        UF_FLAG_PUBLIC | UF_FLAG_SPECIAL_INFO,
+        UF_FLAG_DYNAMIC,
+    };
+
+    for (uint32 visibleFlag : observers)
+    {
+        for (uint32 index = 0; index < PLAYER_END; ++index)
+        {
+            uint32 block = UpdateMask::GetBlockIndex(index);
+            bool visible = (UnitUpdateFieldFlagBlocks.GetFieldsWithFlags(block, visibleFlag) & UpdateMask::GetBlockFlag(index)) != 0;
+            REQUIRE(visible == ((UnitUpdateFieldFlags[index] & visibleFlag) != 0));
+        }
+    }
+}
@@ -0,0 +1,288 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tc_catch2.h"
+
+#include "HMAC.h"
+#include "OpenSSLCrypto.h"
+#include "WardenCheckMgr.h"
+#include "WardenWin.h"
+#include "World.h"
+#include "WorldSession.h"
+#include <future>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+    constexpr char LuaEvalPrefix[] = "local S,T,R=SendAddonMessage,function()";
+    constexpr char LuaEvalMidfix[] = " end R=S and T()if R then S('_TW',";
+    constexpr char LuaEvalPostfix[] = ",'GUILD')end";
+
+    // Check request bytes as WardenWin::RequestChecks built them for every request before they were cached
+    void AppendChecksUncached(ByteBuffer& buff, std::vector<WardenCheck const*> const& checks, std::unordered_map<WardenCheck const*, uint8> const& resultLengths, uint8 xorByte)
+    {
+        for (WardenCheck const* check : checks)
+        {
+            if (check->Type == LUA_EVAL_CHECK)
+            {
+                buff << uint8(sizeof(LuaEvalPrefix) - 1 + check->Str.size() + sizeof(LuaEvalMidfix) - 1 + check->IdStr.size() + sizeof(LuaEvalPostfix) - 1);
+                buff.append(LuaEvalPrefix, sizeof(LuaEvalPrefix) - 1);
+                buff.append(check->Str.data(), check->Str.size());
+                buff.append(LuaEvalMidfix, sizeof(LuaEvalMidfix) - 1);
+                buff.append(check->IdStr.data(), check->IdStr.size());
+                buff.append(LuaEvalPostfix, sizeof(LuaEvalPostfix) - 1);
+            }
+            else if (!check->Str.empty())
+            {
+                buff << uint8(check->Str.size());
+                buff.append(check->Str.data(), check->Str.size());
+            }
+        }
+
+        buff << uint8(0x00);
+        buff << uint8(TIMING_CHECK ^ xorByte);
+
+        uint8 index = 1;
+
+        for (WardenCheck const* check : checks)
+        {
+            buff << uint8(check->Type ^ xorByte);
+            switch (check->Type)
+            {
+                case MEM_CHECK:
+                    buff << uint8(0x00);
+                    buff << uint32(check->Address);
+                    buff << uint8(resultLengths.at(check));
+                    break;
+                case PAGE_CHECK_A:
+                case PAGE_CHECK_B:
+                    buff.append(check->Data.data(), check->Data.size());
+                    buff << uint32(check->Address);
+                    buff << uint8(check->Length);
+                    break;
+                case MPQ_CHECK:
+                case LUA_EVAL_CHECK:
+                    buff << uint8(index++);
+                    break;
+                case DRIVER_CHECK:
+                    buff.append(check->Data.data(), check->Data.size());
+                    buff << uint8(index++);
+                    break;
+                default:
+                    break;
+            }
+        }
+        buff << uint8(xorByte);
+    }
+
+    WardenCheck MakeCheck(WardenCheckType type, uint32 address, uint8 length, std::string str, std::vector<uint8> data = {})
+    {
+        WardenCheck check;
+        check.Type = type;
+        check.Address = address;
+        check.Length = length;
+        check.Str = std::move(str);
+        check.Data = std::move(data);
+        return check;
+    }
+
+    // the session destructor writes to the login database, so it is never destroyed
+    WorldSession* GetTestSession()
+    {
+        static WorldSession* session = new WorldSession(1, "TEST", nullptr, SEC_PLAYER, 2, 0, Minutes(0), LOCALE_enUS, 0, false);
+        return session;
+    }
+
+    // the warden stream ciphers need the legacy provider, load it before constructing a warden
+    void LoadCryptoProviders()
+    {
+        static bool const loaded = []()
+        {
+            OpenSSLCrypto::threadsSetup(boost::filesystem::path());
+            return true;
+        }();
+        (void)loaded;
+    }
+
+    class TestWarden : public Warden
+    {
+    public:
+        TestWarden()
+        {
+            _session = GetTestSession();
+            _initialized = true;
+        }
+
+        void Init(WorldSession* /*session*/, SessionKey const& /*K*/) override { }
+        void InitializeModule() override { }
+        void RequestHash() override { }
+        void HandleHashResult(ByteBuffer& /*buff*/) override { }
+        void HandleCheckResult(ByteBuffer& /*buff*/) override { }
+        void InitializeModuleForClient(ClientWardenModule& /*module*/) override { }
+        void RequestChecks() override { ++Requests; }
+        size_t DEBUG_ForceSpecificChecks(std::vector<uint16> const& /*checks*/) override { return 0; }
+
+        using Warden::QueueVerification;
+        using Warden::ApplyVerdict;
+        using Warden::_checkTimer;
+        using Warden::_verifyProcessor;
+
+        uint32 Requests = 0;
+    };
+}
+
+TEST_CASE("Cached check requests match the requests built per session", "[Warden]")
+{
+    std::vector<WardenCheck> checks;
+    checks.push_back(MakeCheck(MEM_CHECK, 0x00CF0000, 0, ""));
+    checks.push_back(MakeCheck(MEM_CHECK, 0x00D41234, 0, "Wow.exe"));
+    checks.push_back(MakeCheck(PAGE_CHECK_A, 0x0012AB00, 16, "", std::vector<uint8>(24, 0x5A)));
+    checks.push_back(MakeCheck(PAGE_CHECK_B, 0x0034CD00, 32, "", std::vector<uint8>(24, 0xA5)));
+    checks.push_back(MakeCheck(MPQ_CHECK, 0, 0, "Interface\\FrameXML\\FrameXML.toc"));
+    checks.push_back(MakeCheck(LUA_EVAL_CHECK, 0, 0, "return GetCVar('ScriptErrors')"));
+    checks.back().IdStr = { '0', '1', '2', '3' };
+    checks.push_back(MakeCheck(DRIVER_CHECK, 0, 0, "\\Driver\\Beep", std::vector<uint8>(28, 0x11)));
+    checks.push_back(MakeCheck(MPQ_CHECK, 0, 0, "World\\Maps\\Azeroth\\Azeroth.wdt"));
+
+    std::unordered_map<WardenCheck const*, uint8> resultLengths;
+    resultLengths[&checks[0]] = 4;
+    resultLengths[&checks[1]] = 20;
+
+    std::vector<WardenCheckRequest> requests;
+    for (WardenCheck const& check : checks)
+        requests.emplace_back(check, check.Type == MEM_CHECK ? resultLengths[&check] : 0);
+
+    std::vector<WardenCheck const*> sentChecks;
+    std::vector<WardenCheckRequest const*> sentRequests;
+    for (std::size_t i : { 6, 0, 4, 2, 5, 1, 7, 3 })
+    {
+        sentChecks.push_back(&checks[i]);
+        sentRequests.push_back(&requests[i]);
+    }
+
+    for (uint8 xorByte : { 0x00, 0x3C, 0xFF })
+    {
+        ByteBuffer expected;
+        AppendChecksUncached(expected, sentChecks, resultLengths, xorByte);
+
+        ByteBuffer cached;
+        WardenWin::AppendCheckRequests(cached, sentRequests, xorByte);
+
+        REQUIRE(cached.size() == expected.size());
+        REQUIRE(std::equal(cached.contents(), cached.contents() + cached.size(), expected.contents()));
+    }
+}
+
+TEST_CASE("Cached module check requests are signed per request", "[Warden]")
+{
+    WardenCheck check = MakeCheck(MODULE_CHECK, 0, 0, "KERNEL32.DLL");
+    WardenCheckRequest request(check, 0);
+    REQUIRE(request.Body.empty());
+
+    uint8 const xorByte = 0x3C;
+    ByteBuffer buff;
+    WardenWin::AppendCheckRequests(buff, { &request }, xorByte);
+
+    // string entry, timing check, module check type, seed, digest, closing byte
+    std::size_t const checkOffset = 1 + check.Str.size() + 2;
+    REQUIRE(buff.size() == checkOffset + 1 + 4 + Trinity::Crypto::HMAC_SHA1::DIGEST_LENGTH + 1);
+    REQUIRE(buff[0] == check.Str.size());
+    REQUIRE(std::equal(check.Str.begin(), check.Str.end(), buff.contents() + 1));
+    REQUIRE(buff[checkOffset - 2] == 0x00);
+    REQUIRE(buff[checkOffset - 1] == (TIMING_CHECK ^ xorByte));
+    REQUIRE(buff[checkOffset] == (MODULE_CHECK ^ xorByte));
+    REQUIRE(buff[buff.size() - 1] == xorByte);
+
+    std::array<uint8, 4> seed;
+    std::copy_n(buff.contents() + checkOffset + 1, seed.size(), seed.begin());
+    Trinity::Crypto::HMAC_SHA1::Digest digest = Trinity::Crypto::HMAC_SHA1::GetDigestOf(seed, check.Str);
+    REQUIRE(std::equal(digest.begin(), digest.end(), buff.contents() + checkOffset + 1 + seed.size()));
+}
+
+TEST_CASE("Invalid responses do not start the hold off", "[Warden]")
+{
+    sWorld->setIntConfig(CONFIG_WARDEN_CLIENT_CHECK_HOLDOFF, 30);
+    sWorld->setIntConfig(CONFIG_WARDEN_CLIENT_FAIL_ACTION, WARDEN_ACTION_LOG);
+
+    LoadCryptoProviders();
+    TestWarden warden;
+    warden._checkTimer = 0;
+
+    WardenCheckVerdict failure;
+    failure.Failure = "failed checksum";
+    warden.ApplyVerdict(failure);
+    REQUIRE(warden._checkTimer == 0);
+
+    warden.Update(0);
+    REQUIRE(warden.Requests == 1);
+
+    warden.ApplyVerdict(WardenCheckVerdict());
+    REQUIRE(warden._checkTimer == 30 * IN_MILLISECONDS);
+
+    // minimum hold off
+    sWorld->setIntConfig(CONFIG_WARDEN_CLIENT_CHECK_HOLDOFF, 0);
+    warden.ApplyVerdict(WardenCheckVerdict());
+    REQUIRE(warden._checkTimer == 1 * IN_MILLISECONDS);
+}
+
+TEST_CASE("Responses are verified in place while the pool is full", "[Warden]")
+{
+    sWorld->setIntConfig(CONFIG_WARDEN_CLIENT_CHECK_HOLDOFF, 30);
+    sWorld->setIntConfig(CONFIG_WARDEN_CLIENT_FAIL_ACTION, WARDEN_ACTION_LOG);
+    Warden::StartVerificationPool(1, 1);
+
+    LoadCryptoProviders();
+    TestWarden warden;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    warden._checkTimer = 0;
+    warden.QueueVerification([released]()
+    {
+        released.wait();
+        return WardenCheckVerdict();
+    });
+    REQUIRE(warden._verifyProcessor.HasPendingCallbacks());
+    REQUIRE(warden._checkTimer == 0);
+
+    std::thread::id verifiedOn;
+    warden.QueueVerification([&verifiedOn]()
+    {
+        verifiedOn = std::this_thread::get_id();
+        return WardenCheckVerdict();
+    });
+    REQUIRE(verifiedOn == std::this_thread::get_id());
+    REQUIRE(warden._checkTimer == 30 * IN_MILLISECONDS);
+
+    // no new request while a response is still being verified
+    warden._checkTimer = 0;
+    warden.Update(100);
+    REQUIRE(warden.Requests == 0);
+
+    release.set_value();
+    while (warden._verifyProcessor.HasPendingCallbacks())
+    {
+        std::this_thread::yield();
+        warden.Update(0);
+    }
+
+    REQUIRE(warden.Requests == 0);
+    REQUIRE(warden._checkTimer == 30 * IN_MILLISECONDS);
+
+    Warden::StopVerificationPool();
+}